@@ -0,0 +1,101 @@
+//
+// Physics Simulation Program
+// File: client.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Command line client submitting scenario runs to a daemon started with Simulation_program --daemon
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include "config/path_config.h"
+#include "simulation/daemon/daemon_client.h"
+
+namespace {
+    void printUsage() {
+        std::cerr << "Usage: Simulation_client [--socket <path>] <scenario.json> [--seed <n>] [--end-time <seconds>]"
+                     " [--time-step <seconds>] [--threads <n>]\n"
+                     "       Simulation_client [--socket <path>] ping|clear-cache|shutdown\n";
+    }
+
+    nlohmann::json secondsQuantity(const std::string& value) {
+        return {{"value", std::stod(value)}, {"unit", "s"}};
+    }
+
+    // One line per reply; the raw JSON stays greppable while progress lines remain readable
+    void printReply(const nlohmann::json& reply) {
+        const auto event = reply.value("event", "");
+        if (event == "progress") {
+            std::cout << "t = " << reply.value("time_seconds", 0.0) << " s, " << reply.value("particles_alive", 0)
+                      << " particles, " << reply.value("steps", std::uint64_t{0}) << " steps\n";
+        } else if (event == "error") {
+            std::cerr << "error: " << reply.value("message", "unknown") << "\n";
+        } else {
+            std::cout << reply.dump() << "\n";
+        }
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string socketPath(config::paths::daemonSocketPath);
+    nlohmann::json request = nlohmann::json::object();
+    nlohmann::json run = nlohmann::json::object();
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            const auto next = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument(std::string(argument) + " needs a value");
+                }
+                return argv[++i];
+            };
+
+            if (argument == "--socket") {
+                socketPath = next();
+            } else if (argument == "--seed") {
+                request["seed"] = std::stoull(next());
+            } else if (argument == "--end-time") {
+                run["end_time"] = secondsQuantity(next());
+            } else if (argument == "--time-step") {
+                run["time_step"] = secondsQuantity(next());
+            } else if (argument == "--threads") {
+                request["threads"] = std::stoull(next());
+            } else if (argument == "ping" || argument == "clear-cache" || argument == "shutdown") {
+                request["command"] = argument;
+            } else if (!argument.starts_with("--") && !request.contains("scenario")) {
+                // Sent inline, so the daemon's working directory does not matter
+                std::ifstream file{std::string(argument)};
+                if (!file) {
+                    throw std::invalid_argument("Cannot open scenario file '" + std::string(argument) + "'");
+                }
+                request["scenario"] = nlohmann::json::parse(file);
+            } else {
+                throw std::invalid_argument("Unexpected argument '" + std::string(argument) + "'");
+            }
+        }
+        if (!request.contains("scenario") && !request.contains("command")) {
+            printUsage();
+            return 2;
+        }
+        if (!run.empty()) {
+            request["run"] = run;
+        }
+
+        return daemon_client::submit(socketPath, request, printReply) ? 0 : 1;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << "\n";
+        return 1;
+    }
+}
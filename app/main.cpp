@@ -15,20 +15,68 @@
 //      Improve compile time
 
 #include <chrono>
+#include <exception>
 #include <iomanip>
 #include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
 
+#include "config/path_config.h"
+#include "config/program_config.h"
 #include "core/linear-algebra/matrix.h"
 #include "core/linear-algebra/vector.h"
 #include "core/random/random_manager.h"
+#include "core/tracing/lock_profiling.h"
+#include "core/tracing/memory_accounting.h"
+#include "core/tracing/metrics.h"
+#include "core/tracing/tracing.h"
 #include "objects/object.h"
 #include "objects/object_manager.h"
 #include "objects/object-types/box.h"
 #include "particles/particle_manager.h"
 #include "particles/particle_source.h"
+#include "simulation/daemon/run_daemon.h"
+#include "simulation/scenarios/sweep_runner.h"
 #include "simulation/stepping/step_manager.h"
+#include "simulation/stepping/step_statistics.h"
+
+int main(int argc, char* argv[]) {
+    // Live metrics for scraping while the run is in progress
+    std::optional<metrics::MetricsServer> metricsServer;
+    if constexpr (config::program::metricsServerPort != 0) {
+        metricsServer.emplace(config::program::metricsServerPort);
+        std::cout << "Serving metrics at http://127.0.0.1:" << metricsServer->port() << "/metrics\n";
+    }
+
+    // Daemon mode keeps the databases and built worlds loaded between runs submitted by Simulation_client
+    if (argc > 1 && std::string_view(argv[1]) == "--daemon") {
+        try {
+            run_daemon::RunDaemon daemon(argc > 2 ? argv[2] : config::paths::daemonSocketPath);
+            std::cout << "Daemon listening on " << daemon.socketPath().string() << "\n";
+            daemon.serve();
+            std::cout << "Daemon finished " << daemon.jobsCompleted() << " job(s)\n";
+        } catch (const std::exception& error) {
+            std::cerr << error.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    // A scenario or sweep file on the command line replaces the built-in setup below
+    if (argc > 1) {
+        try {
+            const auto sweep = sweep_runner::load(argv[1]);
+            const auto results = sweep_runner::run(sweep, std::cout);
+            std::cout << "Sweep '" << sweep.name << "' finished " << results.size() << " variant(s); results in "
+                      << config::paths::outputDirectory << "/" << sweep.name << "/results.json\n";
+        } catch (const std::exception& error) {
+            std::cerr << error.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
 
-int main() {
     // constexpr std::uint64_t masterSeed = 0x123456789ABCDEFull;
     // random_manager::setMasterSeed(masterSeed);
     // random_manager::setStreamSeed(random_manager::Stream::DiscreteInteractions, masterSeed + 1);
@@ -104,8 +152,25 @@ int main() {
 
     const auto end = std::chrono::steady_clock::now();
 
-    const auto duration = std::chrono::duration_cast<std::chrono::seconds>(end - start);
+    const auto duration = std::chrono::duration<double>(end - start);
     std::cout << "Elapsed time: " << duration.count() << " seconds\n";
 
+    std::cout << "\nStep telemetry:\n";
+    g_stepStatistics.printReport(std::cout);
+
+    std::cout << "\nMemory by subsystem:\n";
+    memory_accounting::printMemoryReport(std::cout);
+
+#ifdef SIMULATION_ENABLE_TRACING
+    const auto tracePath = std::string(config::paths::outputDirectory) + "/trace.json";
+    tracing::exportChromeTrace(tracePath);
+    std::cout << "Wrote " << tracing::recordedEventCount() << " trace events to " << tracePath << "\n";
+#endif
+
+#ifdef SIMULATION_PROFILE_LOCKS
+    std::cout << "\nLock contention:\n";
+    lock_profiling::printReport(std::cout);
+#endif
+
     return 0;
 }
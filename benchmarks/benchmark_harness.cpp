@@ -0,0 +1,257 @@
+//
+// Physics Simulation Program
+// File: benchmark_harness.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of benchmark_harness.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "benchmarks/benchmark_harness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+namespace benchmark_harness {
+    namespace {
+        struct RegisteredBenchmark {
+            std::string name;
+            BenchmarkFunction function;
+        };
+
+        std::vector<RegisteredBenchmark>& registry() {
+            static std::vector<RegisteredBenchmark> benchmarks;
+            return benchmarks;
+        }
+
+        double timeIterations(const BenchmarkFunction& function, const std::size_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            function(iterations);
+            const auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration<double>(end - start).count();
+        }
+
+        // Run for the warmup duration, doubling the iteration count until a batch takes at least the minimum
+        // repetition time; returns the calibrated iterations per repetition
+        std::size_t warmupAndCalibrate(const BenchmarkFunction& function, const BenchmarkOptions& options) {
+            std::size_t iterations = 1;
+            double elapsedTotal = 0.0;
+            while (true) {
+                const double elapsed = timeIterations(function, iterations);
+                elapsedTotal += elapsed;
+                if (elapsed >= options.minRepetitionTime) {
+                    if (elapsedTotal >= options.warmupTime) {
+                        return iterations;
+                    }
+                    continue; // Calibrated but still warming up
+                }
+                iterations = elapsed > 0.0
+                    ? std::max(iterations * 2, static_cast<std::size_t>(static_cast<double>(iterations) * 1.2 * options.minRepetitionTime / elapsed))
+                    : iterations * 10;
+            }
+        }
+
+        BenchmarkResult summarise(std::string name, const std::size_t iterations, std::vector<double> samples) {
+            BenchmarkResult result;
+            result.name = std::move(name);
+            result.iterationsPerRepetition = iterations;
+            result.nanosecondsPerIteration = std::move(samples);
+
+            auto sorted = result.nanosecondsPerIteration;
+            std::ranges::sort(sorted);
+            const auto count = static_cast<double>(sorted.size());
+            result.min = sorted.front();
+            result.max = sorted.back();
+            result.median = sorted.size() % 2 == 1
+                ? sorted[sorted.size() / 2]
+                : 0.5 * (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]);
+            result.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / count;
+            double sumSquares = 0.0;
+            for (const double sample : sorted) {
+                sumSquares += (sample - result.mean) * (sample - result.mean);
+            }
+            result.standardDeviation = sorted.size() > 1 ? std::sqrt(sumSquares / (count - 1.0)) : 0.0;
+            return result;
+        }
+
+        std::string requireValue(const int argc, char** argv, int& index) {
+            if (index + 1 >= argc) {
+                throw std::invalid_argument(std::format("Option '{}' requires a value", argv[index]));
+            }
+            return argv[++index];
+        }
+    } // namespace
+
+    void registerBenchmark(std::string name, BenchmarkFunction function) {
+        if (!function) {
+            throw std::invalid_argument(std::format("Benchmark '{}' has no function", name));
+        }
+        registry().push_back({std::move(name), std::move(function)});
+    }
+
+    BenchmarkOptions parseOptions(const int argc, char** argv) {
+        BenchmarkOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument == "--filter") {
+                options.filter = requireValue(argc, argv, i);
+            } else if (argument == "--json") {
+                options.jsonPath = requireValue(argc, argv, i);
+            } else if (argument == "--repetitions") {
+                options.repetitions = std::stoul(requireValue(argc, argv, i));
+                if (options.repetitions == 0) {
+                    throw std::invalid_argument("--repetitions must be at least 1");
+                }
+            } else if (argument == "--min-time") {
+                options.minRepetitionTime = std::stod(requireValue(argc, argv, i));
+            } else if (argument == "--warmup") {
+                options.warmupTime = std::stod(requireValue(argc, argv, i));
+            } else if (argument == "--perf") {
+                options.perf = true;
+            } else if (argument == "--list") {
+                options.list = true;
+            } else {
+                throw std::invalid_argument(std::format("Unknown option '{}'", argument));
+            }
+        }
+        return options;
+    }
+
+    std::vector<BenchmarkResult> runBenchmarks(const BenchmarkOptions& options) {
+        std::vector<BenchmarkResult> results;
+        std::unique_ptr<perf_counters::CounterSet> counters;
+        if (options.perf) {
+            counters = std::make_unique<perf_counters::CounterSet>();
+            if (!counters->unavailableReason().empty()) {
+                std::cout << std::format("Performance counters: {}\n", counters->unavailableReason());
+            }
+            if (!counters->available()) {
+                counters.reset();
+            }
+        }
+
+        for (const auto& [name, function] : registry()) {
+            if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            const auto iterations = warmupAndCalibrate(function, options);
+            std::vector<double> samples;
+            samples.reserve(options.repetitions);
+            if (counters) {
+                counters->start();
+            }
+            for (std::size_t repetition = 0; repetition < options.repetitions; ++repetition) {
+                samples.push_back(timeIterations(function, iterations) * 1e9 / static_cast<double>(iterations));
+            }
+            std::optional<perf_counters::Readings> readings;
+            if (counters) {
+                readings = counters->stop();
+            }
+            results.push_back(summarise(name, iterations, std::move(samples)));
+            auto& result = results.back();
+            result.perf = readings;
+            std::cout << std::format(
+                "{:<48} {:>12.2f} ns  (median {:>10.2f}, sd {:>8.2f}, {} x {})\n",
+                result.name,
+                result.mean,
+                result.median,
+                result.standardDeviation,
+                options.repetitions,
+                result.iterationsPerRepetition
+            );
+            if (result.perf) {
+                const auto measured = static_cast<double>(options.repetitions * iterations);
+                std::cout << std::format("{:<48} {}\n", "", perf_counters::summary(*result.perf, measured));
+            }
+        }
+        return results;
+    }
+
+    void printResults(const std::vector<BenchmarkResult>& results) {
+        std::cout << std::format("\n{:<48} {:>12} {:>12} {:>12}\n", "Benchmark", "Min (ns)", "Median (ns)", "Max (ns)");
+        for (const auto& result : results) {
+            std::cout << std::format(
+                "{:<48} {:>12.2f} {:>12.2f} {:>12.2f}\n",
+                result.name,
+                result.min,
+                result.median,
+                result.max
+            );
+        }
+    }
+
+    void writeJson(const std::vector<BenchmarkResult>& results, const std::string& path) {
+        nlohmann::json document;
+        document["context"] = {
+            {"hardware_concurrency", std::thread::hardware_concurrency()},
+#ifdef NDEBUG
+            {"build_type", "release"},
+#else
+            {"build_type", "debug"},
+#endif
+            {"timestamp", std::format("{:%FT%TZ}", std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()))}
+        };
+        auto& entries = document["benchmarks"] = nlohmann::json::array();
+        for (const auto& result : results) {
+            entries.push_back({
+                {"name", result.name},
+                {"iterations", result.iterationsPerRepetition},
+                {"repetitions", result.nanosecondsPerIteration.size()},
+                {"mean_ns", result.mean},
+                {"median_ns", result.median},
+                {"min_ns", result.min},
+                {"max_ns", result.max},
+                {"stddev_ns", result.standardDeviation},
+                {"samples_ns", result.nanosecondsPerIteration}
+            });
+            if (result.perf) {
+                const auto measured = static_cast<double>(result.nanosecondsPerIteration.size() * result.iterationsPerRepetition);
+                entries.back()["perf_per_iteration"] = perf_counters::toJson(*result.perf, measured);
+            }
+        }
+
+        std::ofstream out(path);
+        if (!out) {
+            throw std::runtime_error(std::format("Cannot open file '{}'", path));
+        }
+        out << document.dump(2) << '\n';
+    }
+
+    int runMain(const int argc, char** argv) {
+        try {
+            const auto options = parseOptions(argc, argv);
+            if (options.list) {
+                for (const auto& benchmark : registry()) {
+                    std::cout << benchmark.name << '\n';
+                }
+                return 0;
+            }
+            const auto results = runBenchmarks(options);
+            printResults(results);
+            if (!options.jsonPath.empty()) {
+                writeJson(results, options.jsonPath);
+                std::cout << std::format("\nWrote {} results to '{}'\n", results.size(), options.jsonPath);
+            }
+            return 0;
+        } catch (const std::exception& error) {
+            std::cerr << std::format("Benchmark run failed: {}\n", error.what());
+            return 1;
+        }
+    }
+} // namespace benchmark_harness
@@ -0,0 +1,118 @@
+//
+// Physics Simulation Program
+// File: benchmark_harness.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Minimal self-contained micro-benchmark harness (warmup, repetitions, summary statistics and JSON output)
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_BENCHMARK_HARNESS_H
+#define PHYSICS_SIMULATION_PROGRAM_BENCHMARK_HARNESS_H
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmarks/perf_counters.h"
+
+// benchmark_harness
+//
+// Notes on initialisation:
+//   - Benchmarks are registered by name with a callable taking an iteration count; the callable performs the measured
+//     operation that many times so timer overhead is amortised
+//   - Setup belongs outside the callable (captured by reference), teardown per iteration belongs inside it
+//
+// Notes on algorithms:
+//   - Each benchmark is first run for the warmup time, which also calibrates the iteration count so a single
+//     repetition lasts at least the minimum repetition time
+//   - Repetitions are timed with std::chrono::steady_clock and reduced to ns per iteration statistics
+//   - doNotOptimise() is a compiler barrier that forces a value to be materialised so measured work is not removed
+//   - With --perf, hardware counters (see perf_counters.h) are enabled around the timed repetitions only and reported
+//     per iteration; if the counters cannot be opened (e.g. in a container) the run continues without them
+//
+// Notes on output:
+//   - A human-readable table is printed to std::cout
+//   - With --json <path> the results (and run context) are also written as JSON
+//
+// Command line:
+//   --filter <text>         Only run benchmarks whose name contains text
+//   --json <path>           Write results as JSON
+//   --repetitions <n>       Timed repetitions per benchmark (default 10)
+//   --min-time <seconds>    Minimum duration of one repetition (default 0.05)
+//   --warmup <seconds>      Warmup duration before timing (default 0.1)
+//   --perf                  Collect hardware performance counters (Linux perf_event_open)
+//   --list                  List registered benchmarks and exit
+//
+// Example usage:
+//   benchmark_harness::registerBenchmark("quantity/add", [](const std::size_t iterations) {
+//       Quantity a(1.0, "m");
+//       for (std::size_t i = 0; i < iterations; ++i) {
+//           a += Quantity(1.0, Unit::lengthDimension());
+//           benchmark_harness::doNotOptimise(a);
+//       }
+//   });
+//   return benchmark_harness::runMain(argc, argv);
+namespace benchmark_harness {
+    using BenchmarkFunction = std::function<void(std::size_t iterations)>;
+
+    struct BenchmarkOptions {
+        std::string filter;
+        std::string jsonPath;
+        std::size_t repetitions = 10;
+        double minRepetitionTime = 0.05; // s
+        double warmupTime = 0.1;         // s
+        bool perf = false;
+        bool list = false;
+    };
+
+    struct BenchmarkResult {
+        std::string name;
+        std::size_t iterationsPerRepetition = 0;
+        std::vector<double> nanosecondsPerIteration; // One entry per repetition
+        double mean = 0.0;                           // ns
+        double median = 0.0;                         // ns
+        double min = 0.0;                            // ns
+        double max = 0.0;                            // ns
+        double standardDeviation = 0.0;              // ns
+        std::optional<perf_counters::Readings> perf; // Summed over all timed repetitions
+    };
+
+    // Compiler barrier
+    //
+    // Forces value to be treated as read (and possibly modified) so the computation producing it is kept
+    template<typename T>
+    inline void doNotOptimise(T& value) noexcept {
+        asm volatile("" : "+m"(value) : : "memory");
+    }
+
+    template<typename T>
+    inline void doNotOptimise(const T& value) noexcept {
+        asm volatile("" : : "m"(value) : "memory");
+    }
+
+    // Registration
+    void registerBenchmark(std::string name, BenchmarkFunction function);
+
+    // Command line parsing
+    //
+    // Throws std::invalid_argument on unknown or malformed options
+    [[nodiscard]] BenchmarkOptions parseOptions(int argc, char** argv);
+
+    // Run every registered benchmark matching the filter
+    [[nodiscard]] std::vector<BenchmarkResult> runBenchmarks(const BenchmarkOptions& options);
+
+    // Output
+    void printResults(const std::vector<BenchmarkResult>& results);
+    void writeJson(const std::vector<BenchmarkResult>& results, const std::string& path);
+
+    // Convenience entry point: parse, run, print and optionally write JSON; returns a process exit code
+    int runMain(int argc, char** argv);
+} // namespace benchmark_harness
+
+#endif //PHYSICS_SIMULATION_PROGRAM_BENCHMARK_HARNESS_H
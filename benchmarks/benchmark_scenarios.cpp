@@ -0,0 +1,416 @@
+//
+// Physics Simulation Program
+// File: benchmark_scenarios.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of benchmark_scenarios.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "benchmarks/benchmark_scenarios.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <stdexcept>
+
+#include <sys/resource.h>
+
+#include "core/linear-algebra/vector.h"
+#include "core/random/random_manager.h"
+#include "objects/object_manager.h"
+#include "objects/object-types/box.h"
+#include "particles/particle_manager.h"
+#include "particles/particle_source.h"
+#include "simulation/data-collection/particle_collection.h"
+#include "simulation/simulation_clock.h"
+#include "simulation/stepping/step_manager.h"
+
+namespace benchmark_scenarios {
+    namespace {
+        // Photon resonant with the 780 nm line of the test gas travelling along +x
+        Quantity resonantEnergy() { return Quantity(2.5468e-19, "J"); }
+        Vector<3> resonantMomentumX() { return Vector<3>({8.4953e-28, 0.0, 0.0}, "kg m s^-1"); }
+        Vector<4> circularPolarisation() { return Vector<4>({1.0, 0.0, 0.0, 1.0}); }
+
+        double secondsSince(const std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Destroys the run's world and closes the detector streams its hits opened
+        struct RunCleanup {
+            const Object* world = nullptr;
+
+            ~RunCleanup() {
+                closeDetectorLogs();
+                if (this->world != nullptr) {
+                    g_objectManager.destroyWorld(this->world);
+                }
+            }
+        };
+
+        Object* activateNewWorld(const std::string& worldName, const Vector<3>& worldSize) {
+            auto* world = g_objectManager.createWorld<Box>(
+                name(worldName),
+                material("vacuum"),
+                size(worldSize)
+            );
+            g_objectManager.setActiveWorld(world);
+            return world;
+        }
+
+        const Object* buildPhotonCell() {
+            auto* world = activateNewWorld("Photon Cell World", Vector<3>({100.0, 50.0, 50.0}, "mm"));
+            const auto cell = world->addChild<Box>(
+                name("Cell"),
+                material("glass"),
+                size(Vector<3>({25.0, 15.0, 15.0}, "mm"))
+            );
+            (void)cell->addChild<Box>(
+                name("Vapour Cell"),
+                material("gas"),
+                size(Vector<3>({3.0, 3.0, 3.0}, "mm"))
+            );
+            const auto collection = world->addChild<Box>(
+                name("Collection"),
+                material("vacuum"),
+                position(Vector<3>({25.0/2 + 37.5/2, 0.0, 0.0}, "mm")),
+                size(Vector<3>({37.5, 50.0, 50.0}, "mm"))
+            );
+            return collection;
+        }
+
+        void generatePhotonCell(const std::size_t particleCount) {
+            ParticleSource source;
+            source.generateParticles(
+                "photon",
+                particleCount,
+                Quantity(0.0, "s"),
+                Vector<3>({-(25.0/2 + 10), 0, 0}, "mm"),
+                Quantity(1.0, "J"),
+                Vector<3>({1, 0, 0}, "kg m s^-1"),
+                circularPolarisation()
+            );
+        }
+
+        // Gas cube of the given edge with a collection slab on +x
+        const Object* buildGasVolume(const std::string& worldName, const double gasEdge) {
+            const double worldEdge = 1.5 * gasEdge;
+            auto* world = activateNewWorld(worldName, Vector<3>({worldEdge, worldEdge, worldEdge}, "m"));
+            (void)world->addChild<Box>(
+                name("Gas"),
+                material("gas"),
+                size(Vector<3>({gasEdge, gasEdge, gasEdge}, "m"))
+            );
+            const double slab = 0.2 * gasEdge;
+            const auto collection = world->addChild<Box>(
+                name("Collection"),
+                material("vacuum"),
+                position(Vector<3>({0.5 * gasEdge + 0.5 * slab, 0.0, 0.0}, "m")),
+                size(Vector<3>({slab, worldEdge, worldEdge}, "m"))
+            );
+            return collection;
+        }
+
+        // Resonant photons started at the origin heading along +x
+        void generateResonantPhotons(const std::size_t particleCount) {
+            ParticleSource source;
+            source.generateParticles(
+                "photon",
+                particleCount,
+                Quantity(0.0, "s"),
+                Vector<3>({0.0, 0.0, 0.0}, "m"),
+                resonantEnergy(),
+                resonantMomentumX(),
+                circularPolarisation()
+            );
+        }
+
+        const Object* buildDeepGeometry() {
+            constexpr std::size_t depth = 32;
+            auto* world = activateNewWorld("Deep Geometry World", Vector<3>({200.0, 200.0, 200.0}, "mm"));
+            Object* parent = world;
+            double edge = 100.0;
+            for (std::size_t level = 0; level < depth; ++level) {
+                parent = parent->addChild<Box>(
+                    name(std::format("Shell {}", level)),
+                    material(level % 2 == 0 ? "glass" : "vacuum"),
+                    size(Vector<3>({edge, edge, edge}, "mm"))
+                );
+                edge *= 0.9;
+            }
+            const auto collection = world->addChild<Box>(
+                name("Collection"),
+                material("vacuum"),
+                position(Vector<3>({80.0, 0.0, 0.0}, "mm")),
+                size(Vector<3>({40.0, 200.0, 200.0}, "mm"))
+            );
+            return collection;
+        }
+
+        // Empty vacuum world; the detector sits off-axis so photons leave the world without being logged
+        const Object* buildPhotonVacuum() {
+            auto* world = activateNewWorld("Photon Vacuum World", Vector<3>({1.0, 1.0, 1.0}, "m"));
+            const auto detector = world->addChild<Box>(
+                name("Off-axis Detector"),
+                material("vacuum"),
+                position(Vector<3>({0.0, 0.4, 0.0}, "m")),
+                size(Vector<3>({0.1, 0.1, 0.1}, "m"))
+            );
+            return detector;
+        }
+
+        // Resonant photons from the origin fanned out around +x so their paths cross different faces
+        void generateFannedPhotons(const std::size_t particleCount) {
+            ParticleSource source;
+            source.generateParticles(
+                "photon",
+                particleCount,
+                Quantity(0.0, "s"),
+                Vector<3>({0.0, 0.0, 0.0}, "mm"),
+                resonantEnergy(),
+                std::pair{resonantMomentumX(), Vector<3>({0.0, 2e-28, 2e-28}, "kg m s^-1")},
+                circularPolarisation()
+            );
+        }
+    } // namespace
+
+    double ScenarioResult::particlesPerSecond() const noexcept {
+        return this->steppingSeconds > 0.0 ? static_cast<double>(this->particles) / this->steppingSeconds : 0.0;
+    }
+
+    double ScenarioResult::stepsPerSecond() const noexcept {
+        return this->steppingSeconds > 0.0 ? static_cast<double>(this->counters.steps) / this->steppingSeconds : 0.0;
+    }
+
+    const std::vector<Scenario>& scenarios() {
+        static const std::vector<Scenario> registered{
+            {
+                "photon_cell",
+                "Photons crossing the glass/vapour cell into the collection region (app/main.cpp setup)",
+                2000,
+                Quantity(1e-13, "s"),
+                buildPhotonCell,
+                generatePhotonCell
+            },
+            {
+                "photon_vacuum",
+                "Photons crossing an empty vacuum world (steady-state step path with no interactions or detector hits)",
+                2000,
+                Quantity(1e-10, "s"),
+                buildPhotonVacuum,
+                generateResonantPhotons
+            },
+            {
+                "vapour_absorption",
+                "Resonant photons from the centre of a 10 cm gas volume",
+                2000,
+                Quantity(1e-11, "s"),
+                [] { return buildGasVolume("Vapour Absorption World", 0.1); },
+                generateResonantPhotons
+            },
+            {
+                "deep_geometry",
+                "Photons crossing 32 nested alternating glass/vacuum boxes",
+                2000,
+                Quantity(1e-12, "s"),
+                buildDeepGeometry,
+                generateFannedPhotons
+            },
+            {
+                "secondary_heavy",
+                "Resonant photons in a 2 m gas volume with repeated absorption and re-emission",
+                500,
+                Quantity(1e-10, "s"),
+                [] { return buildGasVolume("Secondary Heavy World", 2.0); },
+                generateResonantPhotons
+            }
+        };
+        return registered;
+    }
+
+    const Scenario& findScenario(const std::string_view name) {
+        for (const auto& scenario : scenarios()) {
+            if (scenario.name == name) {
+                return scenario;
+            }
+        }
+        std::string valid;
+        for (const auto& scenario : scenarios()) {
+            valid += valid.empty() ? scenario.name : ", " + scenario.name;
+        }
+        throw std::invalid_argument(std::format("Unknown scenario '{}' (valid: {})", name, valid));
+    }
+
+    ScenarioResult runScenario(
+        const Scenario& scenario,
+        const std::size_t particles,
+        const std::uint64_t seed,
+        perf_counters::CounterSet* perfCounters
+    ) {
+        if (!g_particleManager.empty()) {
+            throw std::runtime_error(std::format("Cannot run scenario '{}' while particles remain from a previous run", scenario.name));
+        }
+
+        random_manager::setMasterSeed(seed);
+        random_manager::resetCachedEngines();
+        simulation_clock::reset();
+        g_stepStatistics.reset();
+        lock_profiling::reset();
+        memory_accounting::resetPeaks();
+
+        ScenarioResult result;
+        result.name = scenario.name;
+        result.particles = particles;
+        result.seed = seed;
+        result.threads = workerThreadCount();
+
+        RunCleanup cleanup;
+        const auto setupStart = std::chrono::steady_clock::now();
+        const Object* detector = scenario.buildGeometry();
+        cleanup.world = g_objectManager.getActiveWorld("clean up after a benchmark scenario");
+        result.setupSeconds = secondsSince(setupStart);
+
+        const auto generationStart = std::chrono::steady_clock::now();
+        scenario.generateParticles(particles);
+        result.generationSeconds = secondsSince(generationStart);
+
+        if (perfCounters != nullptr) {
+            perfCounters->start();
+        }
+        const auto steppingStart = std::chrono::steady_clock::now();
+        stepUntilEmpty(detector, scenario.timeStep);
+        result.steppingSeconds = secondsSince(steppingStart);
+        if (perfCounters != nullptr) {
+            result.perf = perfCounters->stop();
+        }
+
+        result.counters = g_stepStatistics.totals();
+        for (std::size_t i = 0; i < k_maxTrackedMedia; ++i) {
+            if (const auto* medium = result.counters.limitersByMedium[i].medium; medium != nullptr) {
+                result.mediumLabels[i] = std::format("{} ({})", medium->getName(), medium->getMaterial());
+            }
+        }
+        if (lock_profiling::enabled()) {
+            result.locks = lock_profiling::snapshot();
+        }
+        result.memory = memory_accounting::memoryReport();
+        result.peakResidentSetKiB = peakResidentSetKiB();
+        return result;
+    }
+
+    long peakResidentSetKiB() noexcept {
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+        return usage.ru_maxrss; // KiB on Linux
+    }
+
+    nlohmann::json toJson(const ScenarioResult& result) {
+        const auto& counters = result.counters;
+        const auto tracked = static_cast<double>(result.particles + counters.secondaries);
+        const auto perParticle = [tracked](const std::uint64_t count) {
+            return tracked > 0.0 ? static_cast<double>(count) / tracked : 0.0;
+        };
+        const auto phaseSeconds = [&counters](const StepPhase phase) {
+            return static_cast<double>(counters.phaseNanoseconds[static_cast<std::size_t>(phase)]) * 1e-9;
+        };
+
+        nlohmann::json entry{
+            {"scenario", result.name},
+            {"particles", result.particles},
+            {"seed", result.seed},
+            {"threads", result.threads},
+            {"particles_per_second", result.particlesPerSecond()},
+            {"steps_per_second", result.stepsPerSecond()},
+            {"steps", counters.steps},
+            {"secondaries", counters.secondaries},
+            {"step_all_calls", counters.stepAllCalls},
+            {"allocations_per_step", counters.steps > 0 ? static_cast<double>(counters.allocations) / static_cast<double>(counters.steps) : 0.0},
+            {"allocated_bytes_per_step", counters.steps > 0 ? static_cast<double>(counters.allocatedBytes) / static_cast<double>(counters.steps) : 0.0},
+            {"steps_per_particle", {
+                {"total", perParticle(counters.steps)},
+                {"time", perParticle(counters.stepsByLimiter[0])},
+                {"boundary", perParticle(counters.stepsByLimiter[1])},
+                {"decay", perParticle(counters.stepsByLimiter[2])},
+                {"interaction", perParticle(counters.stepsByLimiter[3])}
+            }},
+            {"peak_rss_kib", result.peakResidentSetKiB},
+            {"phases_seconds", {
+                {"setup", result.setupSeconds},
+                {"generation", result.generationSeconds},
+                {"stepping", result.steppingSeconds},
+                {"parallel_stepping", phaseSeconds(StepPhase::ParallelStepping)},
+                {"spawn_processing", phaseSeconds(StepPhase::SpawnProcessing)},
+                {"clock_update", phaseSeconds(StepPhase::ClockUpdate)},
+                {"purge", phaseSeconds(StepPhase::Purge)},
+                {"worker_busy", static_cast<double>(counters.workerBusyNanoseconds) * 1e-9},
+                {"worker_idle", static_cast<double>(counters.workerIdleNanoseconds) * 1e-9},
+                {"detector_lock_wait", static_cast<double>(counters.detectorLockWaitNanoseconds) * 1e-9}
+            }}
+        };
+        auto limitersByMedium = nlohmann::json::object();
+        const auto limiterJson = [](const std::array<std::uint64_t, k_stepLimiterCount>& steps) {
+            return nlohmann::json{{"time", steps[0]}, {"boundary", steps[1]}, {"decay", steps[2]}, {"interaction", steps[3]}};
+        };
+        for (std::size_t i = 0; i < k_maxTrackedMedia; ++i) {
+            if (const auto& slot = counters.limitersByMedium[i]; slot.medium != nullptr) {
+                limitersByMedium[result.mediumLabels[i]] = limiterJson(slot.steps);
+            }
+        }
+        limitersByMedium["(other media)"] = limiterJson(counters.limitersOtherMedia);
+        auto timeSteps = nlohmann::json::object();
+        for (std::size_t i = 0; i < k_timeStepBuckets; ++i) {
+            if (counters.timeSteps[i] != 0) {
+                timeSteps[std::format("1e{}", static_cast<int>(i) + k_timeStepMinExponent)] = counters.timeSteps[i];
+            }
+        }
+        entry["telemetry"] = {
+            {"boundary_fallbacks", counters.boundaryFallbacks},
+            {"analytic_bounces", counters.analyticBounces},
+            {"max_steps_per_visit", counters.maxStepsPerVisit},
+            {"watchdog_trips", counters.watchdogTrips},
+            {"steps_per_visit_log2", counters.stepsPerVisit},
+            {"time_step_decades", std::move(timeSteps)},
+            {"secondaries_per_discrete_step", counters.secondariesPerDiscreteStep},
+            {"limiters_by_medium", std::move(limitersByMedium)}
+        };
+
+        auto memory = nlohmann::json::object();
+        for (std::size_t i = 0; i < memory_accounting::k_categoryCount; ++i) {
+            const auto& usage = result.memory.categories[i];
+            memory[std::string(memory_accounting::categoryName(static_cast<memory_accounting::Category>(i)))] = {
+                {"peak_bytes", usage.peakBytes},
+                {"peak_objects", usage.peakObjects}
+            };
+        }
+        memory["total_peak_bytes"] = result.memory.peakBytes;
+        entry["memory"] = std::move(memory);
+        if (lock_profiling::enabled()) {
+            auto locks = nlohmann::json::array();
+            for (const auto& lock : result.locks) {
+                locks.push_back({
+                    {"name", lock.name},
+                    {"acquisitions", lock.acquisitions},
+                    {"contentions", lock.contentions},
+                    {"wait_seconds", static_cast<double>(lock.waitNanoseconds) * 1e-9},
+                    {"max_wait_seconds", static_cast<double>(lock.maxWaitNanoseconds) * 1e-9},
+                    {"hold_seconds", static_cast<double>(lock.holdNanoseconds) * 1e-9},
+                    {"max_hold_seconds", static_cast<double>(lock.maxHoldNanoseconds) * 1e-9},
+                    {"shared_acquisitions", lock.sharedAcquisitions},
+                    {"shared_contentions", lock.sharedContentions},
+                    {"shared_wait_seconds", static_cast<double>(lock.sharedWaitNanoseconds) * 1e-9}
+                });
+            }
+            entry["locks"] = std::move(locks);
+        }
+        if (result.perf) {
+            entry["perf_per_step"] = perf_counters::toJson(*result.perf, std::max<double>(1.0, static_cast<double>(counters.steps)));
+        }
+        return entry;
+    }
+} // namespace benchmark_scenarios
@@ -0,0 +1,112 @@
+//
+// Physics Simulation Program
+// File: benchmark_scenarios.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes reproducible end-to-end stepping scenarios shared by the scenario and thread-scaling benchmarks
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_BENCHMARK_SCENARIOS_H
+#define PHYSICS_SIMULATION_PROGRAM_BENCHMARK_SCENARIOS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "benchmarks/perf_counters.h"
+#include "core/quantities/quantity.h"
+#include "core/tracing/lock_profiling.h"
+#include "core/tracing/memory_accounting.h"
+#include "objects/object.h"
+#include "simulation/stepping/step_statistics.h"
+
+// benchmark_scenarios
+//
+// Notes on initialisation:
+//   - Each scenario builds a fresh world (made active in g_objectManager) and returns the detector, then generates its
+//     particles; when the run ends (or throws) the world is destroyed and the detector logs closed, so repeated runs in
+//     one process do not accumulate worlds or open files. Results keep medium labels, never pointers into the world
+//   - Runs use the current workerThreadCount() (see setWorkerThreadCount)
+//   - Runs reseed random_manager with a fixed seed and reset the clock and step statistics so repeated runs of the
+//     same scenario step identical particle histories
+//
+// Notes on algorithms:
+//   - Phase times: setup (geometry), generation (particle source) and stepping (stepUntilEmpty), with stepping split
+//     further by StepPhase from g_stepStatistics
+//   - Step telemetry (limiter mix per medium, histograms, boundary fallbacks) is copied from g_stepStatistics
+//   - Allocations per step are only counted when SIMULATION_TRACK_ALLOCATIONS is defined (see allocation_tracking.h)
+//   - Per-lock wait/hold totals are only recorded when SIMULATION_PROFILE_LOCKS is defined (see lock_profiling.h)
+//   - Hardware counters, when a CounterSet is passed, cover the stepping phase only and are reported per step
+//   - Memory per subsystem (memory_accounting) has its peaks reset at the start of each run, unlike RSS
+//   - Peak RSS is the process high-water mark from getrusage; it never decreases so run one scenario per process when
+//     comparing memory
+//
+// Scenarios:
+//   - photon_cell          Photons crossing the vapour cell setup from app/main.cpp into the collection region
+//   - photon_vacuum        Photons crossing an empty vacuum world; the steady-state step path expected to be allocation
+//                          free
+//   - vapour_absorption    Resonant photons started inside a 10 cm gas volume (about one absorption length)
+//   - deep_geometry        Photons crossing 32 nested alternating vacuum/glass boxes
+//   - secondary_heavy      Photons in a 2 m gas volume giving long absorption/re-emission chains
+namespace benchmark_scenarios {
+    struct Scenario {
+        std::string name;
+        std::string description;
+        std::size_t defaultParticles = 0;
+        Quantity timeStep;
+        std::function<const Object*()> buildGeometry;             // Builds and activates the world, returns the detector
+        std::function<void(std::size_t count)> generateParticles; // Adds the initial particles
+    };
+
+    struct ScenarioResult {
+        std::string name;
+        std::size_t particles = 0;
+        std::uint64_t seed = 0;
+        std::size_t threads = 0;
+        double setupSeconds = 0.0;
+        double generationSeconds = 0.0;
+        double steppingSeconds = 0.0;
+        long peakResidentSetKiB = 0;
+        StepCounters counters; // Medium pointers dangle once the run returns; use mediumLabels
+        std::array<std::string, k_maxTrackedMedia> mediumLabels; // "name (material)" per used limitersByMedium slot
+        std::optional<perf_counters::Readings> perf; // Stepping phase, if counters were requested
+        memory_accounting::MemoryReport memory;       // Peaks since the start of the scenario
+        std::vector<lock_profiling::LockReport> locks; // Generation and stepping, empty unless lock profiling is built in
+
+        [[nodiscard]] double particlesPerSecond() const noexcept;
+        [[nodiscard]] double stepsPerSecond() const noexcept;
+    };
+
+    // Registered scenarios in a fixed order
+    [[nodiscard]] const std::vector<Scenario>& scenarios();
+
+    // Lookup by name; throws std::invalid_argument listing the valid names if not found
+    [[nodiscard]] const Scenario& findScenario(std::string_view name);
+
+    // Run a scenario to completion (until no particles remain), optionally reading hardware counters while stepping
+    [[nodiscard]] ScenarioResult runScenario(
+        const Scenario& scenario,
+        std::size_t particles,
+        std::uint64_t seed,
+        perf_counters::CounterSet* perfCounters = nullptr
+    );
+
+    // Process peak resident set size in KiB
+    [[nodiscard]] long peakResidentSetKiB() noexcept;
+
+    // JSON representation of a result
+    [[nodiscard]] nlohmann::json toJson(const ScenarioResult& result);
+} // namespace benchmark_scenarios
+
+#endif //PHYSICS_SIMULATION_PROGRAM_BENCHMARK_SCENARIOS_H
@@ -0,0 +1,424 @@
+//
+// Physics Simulation Program
+// File: core_benchmarks.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Micro-benchmarks for the core kernels used while stepping
+//         -> Quantity/Vector arithmetic, unit parsing, geometry queries, random sampling, math kernels, database
+//            lookups, detector logging and field map evaluation
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmarks/benchmark_harness.h"
+#include "core/linear-algebra/vector.h"
+#include "core/maths/vector_math.h"
+#include "core/quantities/quantity.h"
+#include "core/quantities/utilities/unit_utilities.h"
+#include "core/random/random_manager.h"
+#include "databases/material-data/material_database.h"
+#include "databases/particle-data/particle_database.h"
+#include "objects/object.h"
+#include "objects/object-types/box.h"
+#include "objects/object-types/sphere.h"
+#include "particles/particle-types/photon.h"
+#include "physics/distributions.h"
+#include "physics/fields/field_map.h"
+#include "simulation/data-collection/particle_collection.h"
+
+namespace {
+    using benchmark_harness::doNotOptimise;
+    using benchmark_harness::registerBenchmark;
+
+    constexpr std::size_t k_sampleCount = 1024; // Power of two so indices wrap with a mask
+    constexpr std::size_t k_sampleMask = k_sampleCount - 1;
+    constexpr std::uint32_t k_inputSeed = 0x5EED;
+
+    // Points spread over [-extent, extent]^3 (m) so geometry branches are not trivially predicted
+    std::vector<Vector<3>> makePoints(const double extent) {
+        std::mt19937 generator(k_inputSeed);
+        std::uniform_real_distribution distribution(-extent, extent);
+        std::vector<Vector<3>> points;
+        points.reserve(k_sampleCount);
+        for (std::size_t i = 0; i < k_sampleCount; ++i) {
+            points.emplace_back(
+                std::array{distribution(generator), distribution(generator), distribution(generator)},
+                Unit::lengthDimension()
+            );
+        }
+        return points;
+    }
+
+    // Nested boxes each 90% the size of their parent; returns the root, the deepest volume is the final child
+    std::unique_ptr<Box> makeDeepTree(const std::size_t depth) {
+        auto root = construct<Box>(
+            name("Depth 0"),
+            material("vacuum"),
+            size(Vector<3>({100.0, 100.0, 100.0}, "mm"))
+        );
+        Object* parent = root.get();
+        double edge = 100.0;
+        for (std::size_t level = 1; level < depth; ++level) {
+            edge *= 0.9;
+            parent = parent->addChild<Box>(
+                name(std::format("Depth {}", level)),
+                material(level % 2 == 0 ? "vacuum" : "glass"),
+                size(Vector<3>({edge, edge, edge}, "mm"))
+            );
+        }
+        return root;
+    }
+
+    void registerQuantityBenchmarks() {
+        registerBenchmark("quantity/add", [](const std::size_t iterations) {
+            Quantity sum(0.0, Unit::lengthDimension());
+            const Quantity step(1e-3, Unit::lengthDimension());
+            for (std::size_t i = 0; i < iterations; ++i) {
+                sum = sum + step;
+                doNotOptimise(sum);
+            }
+        });
+        registerBenchmark("quantity/multiply", [](const std::size_t iterations) {
+            const Quantity length(2.0, Unit::lengthDimension());
+            Quantity time(3.0, Unit::timeDimension());
+            for (std::size_t i = 0; i < iterations; ++i) {
+                doNotOptimise(time);
+                auto product = length * time;
+                doNotOptimise(product);
+            }
+        });
+        registerBenchmark("quantity/divide", [](const std::size_t iterations) {
+            const Quantity length(2.0, Unit::lengthDimension());
+            Quantity time(3.0, Unit::timeDimension());
+            for (std::size_t i = 0; i < iterations; ++i) {
+                doNotOptimise(time);
+                auto ratio = length / time;
+                doNotOptimise(ratio);
+            }
+        });
+    }
+
+    void registerVectorBenchmarks() {
+        static const auto points = makePoints(0.05);
+        registerBenchmark("vector/add", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto sum = points[i & k_sampleMask] + points[(i + 1) & k_sampleMask];
+                doNotOptimise(sum);
+            }
+        });
+        registerBenchmark("vector/scale", [](const std::size_t iterations) {
+            const Quantity time(1e-13, Unit::timeDimension());
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto scaled = points[i & k_sampleMask] * time;
+                doNotOptimise(scaled);
+            }
+        });
+        registerBenchmark("vector/dot", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto product = points[i & k_sampleMask].dot(points[(i + 1) & k_sampleMask]);
+                doNotOptimise(product);
+            }
+        });
+        registerBenchmark("vector/cross", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto product = points[i & k_sampleMask].cross(points[(i + 1) & k_sampleMask]);
+                doNotOptimise(product);
+            }
+        });
+        registerBenchmark("vector/length", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto length = points[i & k_sampleMask].length();
+                doNotOptimise(length);
+            }
+        });
+    }
+
+    void registerUnitBenchmarks() {
+        registerBenchmark("units/parseUnits_simple", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto info = parseUnits("mm");
+                doNotOptimise(info);
+            }
+        });
+        registerBenchmark("units/parseUnits_compound", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto info = parseUnits("kg m^2 s^-2 / mol");
+                doNotOptimise(info);
+            }
+        });
+    }
+
+    void registerGeometryBenchmarks() {
+        static const auto points = makePoints(0.02);
+        static const auto box = construct<Box>(
+            name("Benchmark Box"),
+            material("glass"),
+            size(Vector<3>({25.0, 15.0, 15.0}, "mm"))
+        );
+        static const auto sphere = construct<Sphere>(
+            name("Benchmark Sphere"),
+            material("glass"),
+            size(Quantity(10.0, "mm"))
+        );
+        static const Vector<3> displacement({0.03, 0.01, -0.005}, "m");
+
+        registerBenchmark("box/contains", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                bool inside = box->contains(points[i & k_sampleMask]);
+                doNotOptimise(inside);
+            }
+        });
+        registerBenchmark("box/localIntersection", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto hit = box->localIntersection(points[i & k_sampleMask], displacement);
+                doNotOptimise(hit);
+            }
+        });
+        registerBenchmark("sphere/contains", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                bool inside = sphere->contains(points[i & k_sampleMask]);
+                doNotOptimise(inside);
+            }
+        });
+        registerBenchmark("sphere/localIntersection", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto hit = sphere->localIntersection(points[i & k_sampleMask], displacement);
+                doNotOptimise(hit);
+            }
+        });
+
+        for (const std::size_t depth : {4, 16, 32}) {
+            auto tree = std::shared_ptr<Box>(makeDeepTree(depth));
+            registerBenchmark(std::format("object/findObjectContaining_depth{}", depth), [tree](const std::size_t iterations) {
+                static const auto treePoints = makePoints(0.05);
+                for (std::size_t i = 0; i < iterations; ++i) {
+                    auto medium = tree->findObjectContaining(treePoints[i & k_sampleMask]);
+                    doNotOptimise(medium);
+                }
+            });
+        }
+    }
+
+    void registerRandomBenchmarks() {
+        registerBenchmark("random/engine_draw", [](const std::size_t iterations) {
+            auto& engine = random_manager::engine(random_manager::Stream::UserDefined0);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto value = engine();
+                doNotOptimise(value);
+            }
+        });
+        registerBenchmark("random/engine_lookup_and_draw", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto value = random_manager::engine(random_manager::Stream::UserDefined0)();
+                doNotOptimise(value);
+            }
+        });
+        registerBenchmark("random/uniform_real", [](const std::size_t iterations) {
+            auto& engine = random_manager::engine(random_manager::Stream::UserDefined0);
+            std::uniform_real_distribution distribution(0.0, 1.0);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto value = distribution(engine);
+                doNotOptimise(value);
+            }
+        });
+        registerBenchmark("distributions/sampleThermalVelocity", [](const std::size_t iterations) {
+            const Quantity temperature(293.0, Unit::temperatureDimension());
+            const auto mass = g_particleDatabase.getRestMass("gas");
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto velocity = sampleThermalVelocity(temperature, mass);
+                doNotOptimise(velocity);
+            }
+        });
+        registerBenchmark("distributions/sampleIsotropicDirection", [](const std::size_t iterations) {
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto direction = sampleIsotropicDirection();
+                doNotOptimise(direction);
+            }
+        });
+    }
+
+    // Batch kernels against the libm loops they replace, over k_sampleCount inputs per iteration
+    void registerMathBenchmarks() {
+        static const auto inputs = [] {
+            std::mt19937 generator(k_inputSeed);
+            std::uniform_real_distribution distribution(1e-12, 1.0);
+            std::vector<double> values(k_sampleCount);
+            for (auto& value : values) {
+                value = distribution(generator);
+            }
+            return values;
+        }();
+        registerBenchmark("maths/log_batch", [](const std::size_t iterations) {
+            std::vector<double> output(k_sampleCount);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                vector_math::log(inputs, output);
+                doNotOptimise(output);
+            }
+        });
+        registerBenchmark("maths/log_libm", [](const std::size_t iterations) {
+            std::vector<double> output(k_sampleCount);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                for (std::size_t n = 0; n < k_sampleCount; ++n) {
+                    output[n] = std::log(inputs[n]);
+                }
+                doNotOptimise(output);
+            }
+        });
+        registerBenchmark("maths/sincos_batch", [](const std::size_t iterations) {
+            std::vector<double> sine(k_sampleCount);
+            std::vector<double> cosine(k_sampleCount);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                vector_math::sincos(inputs, sine, cosine);
+                doNotOptimise(sine);
+                doNotOptimise(cosine);
+            }
+        });
+        registerBenchmark("maths/sincos_libm", [](const std::size_t iterations) {
+            std::vector<double> sine(k_sampleCount);
+            std::vector<double> cosine(k_sampleCount);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                for (std::size_t n = 0; n < k_sampleCount; ++n) {
+                    sine[n] = std::sin(inputs[n]);
+                    cosine[n] = std::cos(inputs[n]);
+                }
+                doNotOptimise(sine);
+                doNotOptimise(cosine);
+            }
+        });
+        registerBenchmark("distributions/sampleIsotropicDirections_batch", [](const std::size_t iterations) {
+            std::vector<Vector<3>> directions(k_sampleCount);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                sampleIsotropicDirections(directions);
+                doNotOptimise(directions);
+            }
+        });
+    }
+
+    void registerDatabaseBenchmarks() {
+        registerBenchmark("database/material_numeric_lookup", [](const std::size_t iterations) {
+            const std::string glass = "glass";
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto permeability = g_materialDatabase.getRelativePermeability(glass);
+                doNotOptimise(permeability);
+            }
+        });
+        registerBenchmark("database/material_quantity_lookup", [](const std::size_t iterations) {
+            const std::string gas = "gas";
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto density = g_materialDatabase.getNumberDensity(gas);
+                doNotOptimise(density);
+            }
+        });
+        registerBenchmark("database/particle_quantity_lookup", [](const std::size_t iterations) {
+            const std::string photon = "photon";
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto mass = g_particleDatabase.getRestMass(photon);
+                doNotOptimise(mass);
+            }
+        });
+    }
+
+    void registerCollectionBenchmarks() {
+        static const auto detector = construct<Box>(
+            name("Benchmark Detector"),
+            material("vacuum"),
+            size(Vector<3>({10.0, 10.0, 10.0}, "mm"))
+        );
+        static const auto outputFolder = (std::filesystem::temp_directory_path() / "simulation_benchmarks").string();
+
+        const auto makePhoton = [](const Vector<3>& position) -> std::unique_ptr<Particle> {
+            return std::make_unique<Photon>(
+                "photon",
+                Quantity(0.0, "s"),
+                position,
+                Quantity(1.0, "J"),
+                Vector<3>({1.0, 0.0, 0.0}, "kg m s^-1"),
+                Vector<4>({1.0, 0.0, 0.0, 1.0})
+            );
+        };
+
+        registerBenchmark("collection/logEnergyIfInside_miss", [makePhoton](const std::size_t iterations) {
+            auto particle = makePhoton(Vector<3>({0.5, 0.0, 0.0}, "m"));
+            for (std::size_t i = 0; i < iterations; ++i) {
+                logEnergyIfInside(particle, detector.get(), outputFolder);
+                doNotOptimise(particle);
+            }
+        });
+        registerBenchmark("collection/logEnergyIfInside_hit", [makePhoton](const std::size_t iterations) {
+            const Vector<3> inside({0.0, 0.0, 0.0}, "m");
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto particle = makePhoton(inside); // Logging consumes the particle
+                logEnergyIfInside(particle, detector.get(), outputFolder);
+                doNotOptimise(particle);
+            }
+        });
+    }
+
+    void registerFieldMapBenchmarks() {
+        static const auto points = makePoints(1.4e-3);
+        const auto fieldAt = [](const double x, const double y, const double z) {
+            return std::array{1e-6 * y, -1e-6 * x, 1e-6 * (1.0 + 100.0 * z)};
+        };
+        static const auto trilinear = FieldMap::fromFunction(
+            Vector<3>({-1.5, -1.5, -1.5}, "mm"),
+            Vector<3>({1.5, 1.5, 1.5}, "mm"),
+            {33, 33, 33},
+            fieldAt
+        );
+        static const auto tricubic = FieldMap::fromFunction(
+            Vector<3>({-1.5, -1.5, -1.5}, "mm"),
+            Vector<3>({1.5, 1.5, 1.5}, "mm"),
+            {33, 33, 33},
+            fieldAt,
+            FieldInterpolation::Tricubic
+        );
+
+        registerBenchmark("field_map/trilinear", [](const std::size_t iterations) {
+            std::array<double, 3> field{};
+            for (std::size_t i = 0; i < iterations; ++i) {
+                const auto& point = points[i & k_sampleMask];
+                bool inside = trilinear.evaluate(point[0].asDouble(), point[1].asDouble(), point[2].asDouble(), field);
+                doNotOptimise(inside);
+                doNotOptimise(field);
+            }
+        });
+        registerBenchmark("field_map/tricubic", [](const std::size_t iterations) {
+            std::array<double, 3> field{};
+            for (std::size_t i = 0; i < iterations; ++i) {
+                const auto& point = points[i & k_sampleMask];
+                bool inside = tricubic.evaluate(point[0].asDouble(), point[1].asDouble(), point[2].asDouble(), field);
+                doNotOptimise(inside);
+                doNotOptimise(field);
+            }
+        });
+    }
+} // namespace
+
+int main(const int argc, char** argv) {
+    random_manager::setMasterSeed(k_inputSeed);
+
+    registerQuantityBenchmarks();
+    registerVectorBenchmarks();
+    registerUnitBenchmarks();
+    registerGeometryBenchmarks();
+    registerRandomBenchmarks();
+    registerMathBenchmarks();
+    registerDatabaseBenchmarks();
+    registerCollectionBenchmarks();
+    registerFieldMapBenchmarks();
+
+    return benchmark_harness::runMain(argc, argv);
+}
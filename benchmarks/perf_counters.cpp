@@ -0,0 +1,230 @@
+//
+// Physics Simulation Program
+// File: perf_counters.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of perf_counters.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "benchmarks/perf_counters.h"
+
+#include <cerrno>
+#include <cstring>
+#include <format>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace perf_counters {
+    namespace {
+#ifdef __linux__
+        struct CounterConfig {
+            std::uint32_t type;
+            std::uint64_t config;
+        };
+
+        constexpr std::uint64_t cacheConfig(const std::uint64_t cache, const std::uint64_t operation, const std::uint64_t result) {
+            return cache | (operation << 8) | (result << 16);
+        }
+
+        constexpr std::array<CounterConfig, k_counterCount> k_counterConfigs{{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+            {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)}
+        }};
+
+        int openCounter(const CounterConfig& counter) {
+            perf_event_attr attributes{};
+            attributes.size = sizeof(attributes);
+            attributes.type = counter.type;
+            attributes.config = counter.config;
+            attributes.disabled = 1;
+            attributes.inherit = 1;        // Include threads spawned while counting
+            attributes.exclude_kernel = 1; // Permitted at perf_event_paranoid 2
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        }
+#endif
+
+        std::optional<double> ratio(const std::optional<double> numerator, const std::optional<double> denominator) {
+            if (!numerator || !denominator || *denominator <= 0.0) {
+                return std::nullopt;
+            }
+            return *numerator / *denominator;
+        }
+    } // namespace
+
+    std::string_view counterName(const Counter counter) noexcept {
+        switch (counter) {
+            case Counter::Cycles:               return "cycles";
+            case Counter::Instructions:         return "instructions";
+            case Counter::Branches:             return "branches";
+            case Counter::BranchMisses:         return "branch_misses";
+            case Counter::L1DataMisses:         return "l1d_misses";
+            case Counter::LastLevelCacheMisses: return "llc_misses";
+            default:                            return "unknown";
+        }
+    }
+
+    bool Readings::any() const noexcept {
+        for (const auto& value : this->values) {
+            if (value) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::optional<double> Readings::get(const Counter counter) const noexcept {
+        return this->values[static_cast<std::size_t>(counter)];
+    }
+
+    std::optional<double> Readings::instructionsPerCycle() const noexcept {
+        return ratio(this->get(Counter::Instructions), this->get(Counter::Cycles));
+    }
+
+    std::optional<double> Readings::perThousandInstructions(const Counter counter) const noexcept {
+        const auto rate = ratio(this->get(counter), this->get(Counter::Instructions));
+        return rate ? std::optional(*rate * 1000.0) : std::nullopt;
+    }
+
+    CounterSet::CounterSet() {
+        this->m_descriptors.fill(-1);
+#ifdef __linux__
+        std::string failed;
+        int lastError = 0;
+        for (std::size_t i = 0; i < k_counterCount; ++i) {
+            this->m_descriptors[i] = openCounter(k_counterConfigs[i]);
+            if (this->m_descriptors[i] < 0) {
+                lastError = errno;
+                failed += failed.empty() ? "" : ", ";
+                failed += counterName(static_cast<Counter>(i));
+            }
+        }
+        if (!failed.empty()) {
+            this->m_unavailableReason = std::format("{} unavailable ({})", failed, std::strerror(lastError));
+        }
+#else
+        this->m_unavailableReason = "perf_event_open requires Linux";
+#endif
+    }
+
+    CounterSet::~CounterSet() {
+#ifdef __linux__
+        for (const int descriptor : this->m_descriptors) {
+            if (descriptor >= 0) {
+                close(descriptor);
+            }
+        }
+#endif
+    }
+
+    bool CounterSet::available() const noexcept {
+        for (const int descriptor : this->m_descriptors) {
+            if (descriptor >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const std::string& CounterSet::unavailableReason() const noexcept {
+        return this->m_unavailableReason;
+    }
+
+    void CounterSet::start() noexcept {
+#ifdef __linux__
+        for (const int descriptor : this->m_descriptors) {
+            if (descriptor >= 0) {
+                ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+                ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    Readings CounterSet::stop() noexcept {
+        Readings readings;
+#ifdef __linux__
+        for (const int descriptor : this->m_descriptors) {
+            if (descriptor >= 0) {
+                ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (std::size_t i = 0; i < k_counterCount; ++i) {
+            if (this->m_descriptors[i] < 0) {
+                continue;
+            }
+            std::array<std::uint64_t, 3> buffer{}; // value, time enabled, time running
+            if (read(this->m_descriptors[i], buffer.data(), sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) {
+                continue;
+            }
+            const auto [value, enabled, running] = buffer;
+            if (running == 0) {
+                continue; // Never scheduled on the PMU
+            }
+            readings.values[i] = static_cast<double>(value) * static_cast<double>(enabled) / static_cast<double>(running);
+        }
+#endif
+        return readings;
+    }
+
+    nlohmann::json toJson(const Readings& readings, const double per) {
+        nlohmann::json entry = nlohmann::json::object();
+        for (std::size_t i = 0; i < k_counterCount; ++i) {
+            if (const auto& value = readings.values[i]) {
+                entry[std::string(counterName(static_cast<Counter>(i)))] = *value / per;
+            }
+        }
+        if (const auto ipc = readings.instructionsPerCycle()) {
+            entry["ipc"] = *ipc;
+        }
+        for (const auto counter : {Counter::BranchMisses, Counter::L1DataMisses, Counter::LastLevelCacheMisses}) {
+            if (const auto rate = readings.perThousandInstructions(counter)) {
+                entry[std::format("{}_per_kilo_instruction", counterName(counter))] = *rate;
+            }
+        }
+        return entry;
+    }
+
+    std::string summary(const Readings& readings, const double per, const std::string_view perLabel) {
+        if (!readings.any()) {
+            return "counters unavailable";
+        }
+        std::string text;
+        const auto append = [&text](const std::string& item) {
+            text += text.empty() ? item : ", " + item;
+        };
+        if (const auto cycles = readings.get(Counter::Cycles)) {
+            append(std::format("{:.1f} cycles/{}", *cycles / per, perLabel));
+        }
+        if (const auto instructions = readings.get(Counter::Instructions)) {
+            append(std::format("{:.1f} instr/{}", *instructions / per, perLabel));
+        }
+        if (const auto ipc = readings.instructionsPerCycle()) {
+            append(std::format("IPC {:.2f}", *ipc));
+        }
+        if (const auto rate = readings.perThousandInstructions(Counter::BranchMisses)) {
+            append(std::format("br-miss {:.2f}/kI", *rate));
+        }
+        if (const auto rate = readings.perThousandInstructions(Counter::L1DataMisses)) {
+            append(std::format("L1D-miss {:.2f}/kI", *rate));
+        }
+        if (const auto rate = readings.perThousandInstructions(Counter::LastLevelCacheMisses)) {
+            append(std::format("LLC-miss {:.3f}/kI", *rate));
+        }
+        return text;
+    }
+} // namespace perf_counters
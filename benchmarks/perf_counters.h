@@ -0,0 +1,106 @@
+//
+// Physics Simulation Program
+// File: perf_counters.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Hardware performance counters (cycles, instructions, branches, cache misses) via Linux perf_event_open
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_PERF_COUNTERS_H
+#define PHYSICS_SIMULATION_PROGRAM_PERF_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+// perf_counters
+//
+// Notes on initialisation:
+//   - A CounterSet opens one counter per Counter for the calling process (user space only) when constructed; counters
+//     the kernel, container or CPU does not provide are skipped and reported as unavailable rather than failing
+//   - Counters are opened with inherit set, so threads created after construction (stepAll workers) are counted too
+//   - Requires Linux with perf_event_paranoid <= 2 (or CAP_PERFMON); on other platforms nothing is available
+//
+// Notes on algorithms:
+//   - Counters are opened individually rather than as a group so partial availability still yields data; when the
+//     PMU multiplexes them the readings are scaled by time enabled / time running
+//
+// Supported overloads / operations and functions / methods:
+//   - Measurement:            start(), stop()
+//   - Getters:                available(), unavailableReason()
+//   - Derived rates:          Readings::instructionsPerCycle(), Readings::perThousandInstructions()
+//   - Output:                 toJson(), summary()
+//
+// Example usage:
+//   perf_counters::CounterSet counters;
+//   counters.start();
+//   runWorkload();
+//   const auto readings = counters.stop();
+//   std::cout << perf_counters::summary(readings, iterations) << '\n';
+namespace perf_counters {
+    enum class Counter : std::uint8_t {
+        Cycles = 0,
+        Instructions,
+        Branches,
+        BranchMisses,
+        L1DataMisses,        // L1 data cache read misses
+        LastLevelCacheMisses,
+        Count
+    };
+
+    inline constexpr std::size_t k_counterCount = static_cast<std::size_t>(Counter::Count);
+
+    [[nodiscard]] std::string_view counterName(Counter counter) noexcept;
+
+    struct Readings {
+        std::array<std::optional<double>, k_counterCount> values{}; // Scaled counts; empty if unavailable
+
+        [[nodiscard]] bool any() const noexcept;
+        [[nodiscard]] std::optional<double> get(Counter counter) const noexcept;
+        [[nodiscard]] std::optional<double> instructionsPerCycle() const noexcept;
+        [[nodiscard]] std::optional<double> perThousandInstructions(Counter counter) const noexcept;
+    };
+
+    // CounterSet
+    //
+    // RAII owner of the perf event file descriptors
+    class CounterSet {
+        public:
+            CounterSet();
+            ~CounterSet();
+
+            CounterSet(const CounterSet&) = delete;
+            CounterSet& operator=(const CounterSet&) = delete;
+
+            // Getters
+            [[nodiscard]] bool available() const noexcept;
+            [[nodiscard]] const std::string& unavailableReason() const noexcept; // Empty if every counter opened
+
+            // Measurement methods
+            //
+            // start() resets and enables the counters, stop() disables and reads them
+            void start() noexcept;
+            [[nodiscard]] Readings stop() noexcept;
+
+        private:
+            std::array<int, k_counterCount> m_descriptors{};
+            std::string m_unavailableReason;
+    };
+
+    // Counts divided by per (e.g. iterations or steps) plus IPC and misses per thousand instructions
+    [[nodiscard]] nlohmann::json toJson(const Readings& readings, double per = 1.0);
+
+    // One-line human-readable summary of the same values
+    [[nodiscard]] std::string summary(const Readings& readings, double per = 1.0, std::string_view perLabel = "it");
+} // namespace perf_counters
+
+#endif //PHYSICS_SIMULATION_PROGRAM_PERF_COUNTERS_H
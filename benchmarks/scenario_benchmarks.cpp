@@ -0,0 +1,337 @@
+//
+// Physics Simulation Program
+// File: scenario_benchmarks.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - End-to-end scenario benchmarks reporting throughput, steps per particle by limiter, peak RSS, memory per subsystem
+//     and phase times
+//   - Optional comparison against a stored baseline JSON flags throughput and memory regressions
+//
+// Command line:
+//   --scenario <name>       Run only this scenario (repeatable; default all)
+//   --particles <n>         Override each scenario's default particle count
+//   --seed <n>              Master seed (default 0x5EED)
+//   --json <path>           Write results as JSON
+//   --baseline <path>       Compare against a previous --json output
+//   --tolerance <fraction>  Allowed relative change before flagging a regression (default 0.1)
+//   --perf                  Collect hardware performance counters while stepping (Linux perf_event_open)
+//   --assert-zero-allocations
+//                           Fail if any selected scenario allocates while stepping particles (needs a build with
+//                           SIMULATION_TRACK_ALLOCATIONS; use with --scenario photon_vacuum)
+//   --list                  List scenarios and exit
+//
+// Exit codes: 0 success, 1 error, 2 regression against the baseline, 3 allocation assertion failed
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "benchmarks/benchmark_scenarios.h"
+#include "core/tracing/allocation_tracking.h"
+#include "core/tracing/lock_profiling.h"
+
+namespace {
+    struct ScenarioOptions {
+        std::vector<std::string> scenarios;
+        std::optional<std::size_t> particles;
+        std::uint64_t seed = 0x5EED;
+        std::string jsonPath;
+        std::string baselinePath;
+        double tolerance = 0.1;
+        bool perf = false;
+        bool assertZeroAllocations = false;
+        bool list = false;
+    };
+
+    std::string requireValue(const int argc, char** argv, int& index) {
+        if (index + 1 >= argc) {
+            throw std::invalid_argument(std::format("Option '{}' requires a value", argv[index]));
+        }
+        return argv[++index];
+    }
+
+    ScenarioOptions parseOptions(const int argc, char** argv) {
+        ScenarioOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument == "--scenario") {
+                options.scenarios.push_back(requireValue(argc, argv, i));
+            } else if (argument == "--particles") {
+                options.particles = std::stoul(requireValue(argc, argv, i));
+            } else if (argument == "--seed") {
+                options.seed = std::stoull(requireValue(argc, argv, i), nullptr, 0);
+            } else if (argument == "--json") {
+                options.jsonPath = requireValue(argc, argv, i);
+            } else if (argument == "--baseline") {
+                options.baselinePath = requireValue(argc, argv, i);
+            } else if (argument == "--tolerance") {
+                options.tolerance = std::stod(requireValue(argc, argv, i));
+                if (options.tolerance < 0.0) {
+                    throw std::invalid_argument("--tolerance must be non-negative");
+                }
+            } else if (argument == "--perf") {
+                options.perf = true;
+            } else if (argument == "--assert-zero-allocations") {
+                options.assertZeroAllocations = true;
+            } else if (argument == "--list") {
+                options.list = true;
+            } else {
+                throw std::invalid_argument(std::format("Unknown option '{}'", argument));
+            }
+        }
+        return options;
+    }
+
+    nlohmann::json readJson(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) {
+            throw std::runtime_error(std::format("Cannot open file '{}'", path));
+        }
+        return nlohmann::json::parse(in);
+    }
+
+    void writeJson(const nlohmann::json& document, const std::string& path) {
+        std::ofstream out(path);
+        if (!out) {
+            throw std::runtime_error(std::format("Cannot open file '{}'", path));
+        }
+        out << document.dump(2) << '\n';
+    }
+
+    nlohmann::json runContext() {
+        return {
+            {"hardware_concurrency", std::thread::hardware_concurrency()},
+#ifdef NDEBUG
+            {"build_type", "release"},
+#else
+            {"build_type", "debug"},
+#endif
+            {"timestamp", std::format("{:%FT%TZ}", std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()))}
+        };
+    }
+
+    void printResults(const std::vector<benchmark_scenarios::ScenarioResult>& results) {
+        std::cout << std::format(
+            "\n{:<20} {:>10} {:>14} {:>14} {:>12} {:>14} {:>14}\n",
+            "Scenario", "Particles", "Particles/s", "Steps/s", "Steps/part", "Stepping (s)", "Peak RSS (MiB)"
+        );
+        for (const auto& result : results) {
+            const auto tracked = static_cast<double>(result.particles + result.counters.secondaries);
+            std::cout << std::format(
+                "{:<20} {:>10} {:>14.4g} {:>14.4g} {:>12.2f} {:>14.3f} {:>14.1f}\n",
+                result.name,
+                result.particles,
+                result.particlesPerSecond(),
+                result.stepsPerSecond(),
+                tracked > 0.0 ? static_cast<double>(result.counters.steps) / tracked : 0.0,
+                result.steppingSeconds,
+                static_cast<double>(result.peakResidentSetKiB) / 1024.0
+            );
+        }
+        for (const auto& result : results) {
+            const auto& particles = result.memory[memory_accounting::Category::Particles];
+            std::cout << std::format(
+                "{:<20} tracked peak {:.2f} MiB, particles peak {:.2f} MiB ({:.1f} bytes per particle)\n",
+                result.name,
+                static_cast<double>(result.memory.peakBytes) / (1024.0 * 1024.0),
+                static_cast<double>(particles.peakBytes) / (1024.0 * 1024.0),
+                particles.peakObjects > 0 ? static_cast<double>(particles.peakBytes) / static_cast<double>(particles.peakObjects) : 0.0
+            );
+        }
+        if (allocation_tracking::enabled()) {
+            for (const auto& result : results) {
+                const auto steps = std::max<double>(1.0, static_cast<double>(result.counters.steps));
+                std::cout << std::format(
+                    "{:<20} {:.3f} allocations/step, {:.1f} bytes/step\n",
+                    result.name,
+                    static_cast<double>(result.counters.allocations) / steps,
+                    static_cast<double>(result.counters.allocatedBytes) / steps
+                );
+            }
+        }
+        for (const auto& result : results) {
+            for (const auto& lock : result.locks) {
+                if (lock.acquisitions + lock.sharedAcquisitions == 0) {
+                    continue;
+                }
+                std::cout << std::format(
+                    "{:<20} {:<22} {} acquired ({} contended), wait {:.3f} ms, hold {:.3f} ms, {} shared (wait {:.3f} ms)\n",
+                    result.name,
+                    lock.name,
+                    lock.acquisitions,
+                    lock.contentions,
+                    static_cast<double>(lock.waitNanoseconds) * 1e-6,
+                    static_cast<double>(lock.holdNanoseconds) * 1e-6,
+                    lock.sharedAcquisitions,
+                    static_cast<double>(lock.sharedWaitNanoseconds) * 1e-6
+                );
+            }
+        }
+        for (const auto& result : results) {
+            if (result.perf) {
+                const auto steps = std::max<double>(1.0, static_cast<double>(result.counters.steps));
+                std::cout << std::format("{:<20} {}\n", result.name, perf_counters::summary(*result.perf, steps, "step"));
+            }
+        }
+    }
+
+    // Compare each result against the baseline entry of the same scenario; returns the number of regressions
+    //   - Throughput (particles/s, steps/s) regresses when it falls below baseline * (1 - tolerance)
+    //   - Peak RSS regresses when it rises above baseline * (1 + tolerance)
+    std::size_t compareWithBaseline(const nlohmann::json& current, const nlohmann::json& baseline, const double tolerance) {
+        struct Metric {
+            std::string_view key;
+            bool higherIsBetter;
+        };
+        constexpr Metric metrics[] = {
+            {"particles_per_second", true},
+            {"steps_per_second", true},
+            {"peak_rss_kib", false}
+        };
+
+        std::size_t regressions = 0;
+        std::cout << std::format("\nBaseline comparison (tolerance {:.1f}%)\n", tolerance * 100.0);
+        for (const auto& entry : current.at("scenarios")) {
+            const auto& name = entry.at("scenario").get_ref<const std::string&>();
+            const nlohmann::json* reference = nullptr;
+            for (const auto& candidate : baseline.at("scenarios")) {
+                if (candidate.at("scenario") == name) {
+                    reference = &candidate;
+                    break;
+                }
+            }
+            if (reference == nullptr) {
+                std::cout << std::format("  {:<20} not in baseline\n", name);
+                continue;
+            }
+            if (reference->at("particles") != entry.at("particles") || reference->at("seed") != entry.at("seed")) {
+                std::cout << std::format("  {:<20} warning: particle count or seed differs from baseline\n", name);
+            }
+
+            for (const auto& [key, higherIsBetter] : metrics) {
+                const double now = entry.at(key).get<double>();
+                const double before = reference->at(key).get<double>();
+                const double change = before != 0.0 ? (now - before) / before : 0.0;
+                const bool regressed = higherIsBetter ? now < before * (1.0 - tolerance) : now > before * (1.0 + tolerance);
+                regressions += regressed ? 1 : 0;
+                std::cout << std::format(
+                    "  {:<20} {:<22} {:>14.4g} -> {:>14.4g} ({:+.1f}%){}\n",
+                    name,
+                    key,
+                    before,
+                    now,
+                    change * 100.0,
+                    regressed ? "  REGRESSION" : ""
+                );
+            }
+        }
+        return regressions;
+    }
+} // namespace
+
+int main(const int argc, char** argv) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        if (options.list) {
+            for (const auto& scenario : benchmark_scenarios::scenarios()) {
+                std::cout << std::format("{:<20} {}\n", scenario.name, scenario.description);
+            }
+            return 0;
+        }
+
+        std::vector<const benchmark_scenarios::Scenario*> selected;
+        if (options.scenarios.empty()) {
+            for (const auto& scenario : benchmark_scenarios::scenarios()) {
+                selected.push_back(&scenario);
+            }
+        } else {
+            for (const auto& name : options.scenarios) {
+                selected.push_back(&benchmark_scenarios::findScenario(name));
+            }
+        }
+
+        if (options.assertZeroAllocations && !allocation_tracking::enabled()) {
+            throw std::invalid_argument("--assert-zero-allocations needs a build configured with SIMULATION_TRACK_ALLOCATIONS=ON");
+        }
+
+        std::unique_ptr<perf_counters::CounterSet> perfCounters;
+        if (options.perf) {
+            perfCounters = std::make_unique<perf_counters::CounterSet>();
+            if (!perfCounters->unavailableReason().empty()) {
+                std::cout << std::format("Performance counters: {}\n", perfCounters->unavailableReason());
+            }
+            if (!perfCounters->available()) {
+                perfCounters.reset();
+            }
+        }
+
+        std::vector<benchmark_scenarios::ScenarioResult> results;
+        nlohmann::json document;
+        document["context"] = runContext();
+        auto& entries = document["scenarios"] = nlohmann::json::array();
+        for (const auto* scenario : selected) {
+            const auto particles = options.particles.value_or(scenario->defaultParticles);
+            std::cout << std::format("Running {} ({} particles, seed {:#x})\n", scenario->name, particles, options.seed);
+            results.push_back(benchmark_scenarios::runScenario(*scenario, particles, options.seed, perfCounters.get()));
+            entries.push_back(benchmark_scenarios::toJson(results.back()));
+        }
+        printResults(results);
+
+        if (!options.jsonPath.empty()) {
+            writeJson(document, options.jsonPath);
+            std::cout << std::format("\nWrote {} results to '{}'\n", results.size(), options.jsonPath);
+        }
+
+        if (options.assertZeroAllocations) {
+            std::size_t failures = 0;
+            for (const auto& result : results) {
+                if (result.counters.allocations > 0) {
+                    ++failures;
+                    std::cout << std::format(
+                        "Allocation assertion failed: {} made {} allocations ({} bytes) over {} steps\n",
+                        result.name,
+                        result.counters.allocations,
+                        result.counters.allocatedBytes,
+                        result.counters.steps
+                    );
+                }
+            }
+            if (failures > 0) {
+                return 3;
+            }
+            std::cout << "\nNo heap allocations while stepping\n";
+        }
+
+        if (!options.baselinePath.empty()) {
+            const auto regressions = compareWithBaseline(document, readJson(options.baselinePath), options.tolerance);
+            if (regressions > 0) {
+                std::cout << std::format("\n{} regression(s) against '{}'\n", regressions, options.baselinePath);
+                return 2;
+            }
+            std::cout << "\nNo regressions against the baseline\n";
+        }
+        return 0;
+    } catch (const std::exception& error) {
+        std::cerr << std::format("Scenario benchmark failed: {}\n", error.what());
+        return 1;
+    }
+}
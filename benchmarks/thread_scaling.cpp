@@ -0,0 +1,261 @@
+//
+// Physics Simulation Program
+// File: thread_scaling.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Thread-scaling study for stepping: runs a scenario at 1, 2, 4, ... worker threads (up to hardware_concurrency)
+//     and prints strong- and weak-scaling tables with parallel efficiency
+//   - Loss is attributed to the serial sections of stepAll (spawn processing, clock update, purge), worker idle time
+//     at the join (load imbalance and thread start-up) and time spent waiting on detector locks
+//
+// Notes on output:
+//   - Strong scaling keeps the particle count fixed: speedup = T1 / Tn, efficiency = speedup / n
+//   - Weak scaling multiplies the particle count by n: efficiency = T1 / Tn, scaled speedup = n * T1 / Tn
+//   - Attribution columns are percentages of the stepping wall time; idle and lock waits are averaged over workers
+//     so the columns are comparable with the serial phases
+//   - Each point is the fastest of --repetitions runs
+//
+// Command line:
+//   --scenario <name>       Scenario to run (default vapour_absorption)
+//   --particles <n>         Particles for strong scaling and per thread for weak scaling (default scenario default)
+//   --max-threads <n>       Largest thread count (default hardware_concurrency)
+//   --repetitions <n>       Runs per point (default 3)
+//   --seed <n>              Master seed (default 0x5EED)
+//   --json <path>           Write both tables as JSON
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "benchmarks/benchmark_scenarios.h"
+#include "simulation/stepping/step_manager.h"
+
+namespace {
+    struct ScalingOptions {
+        std::string scenario = "vapour_absorption";
+        std::optional<std::size_t> particles;
+        std::size_t maxThreads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+        std::size_t repetitions = 3;
+        std::uint64_t seed = 0x5EED;
+        std::string jsonPath;
+    };
+
+    struct ScalingPoint {
+        std::size_t threads = 0;
+        std::size_t particles = 0;
+        double seconds = 0.0;    // Stepping wall time
+        double efficiency = 0.0; // Parallel efficiency relative to one thread
+        double speedup = 0.0;    // Strong: T1 / Tn, weak: scaled speedup n * T1 / Tn
+        benchmark_scenarios::ScenarioResult result;
+    };
+
+    std::string requireValue(const int argc, char** argv, int& index) {
+        if (index + 1 >= argc) {
+            throw std::invalid_argument(std::format("Option '{}' requires a value", argv[index]));
+        }
+        return argv[++index];
+    }
+
+    ScalingOptions parseOptions(const int argc, char** argv) {
+        ScalingOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            if (argument == "--scenario") {
+                options.scenario = requireValue(argc, argv, i);
+            } else if (argument == "--particles") {
+                options.particles = std::stoul(requireValue(argc, argv, i));
+            } else if (argument == "--max-threads") {
+                options.maxThreads = std::stoul(requireValue(argc, argv, i));
+                if (options.maxThreads == 0) {
+                    throw std::invalid_argument("--max-threads must be at least 1");
+                }
+            } else if (argument == "--repetitions") {
+                options.repetitions = std::stoul(requireValue(argc, argv, i));
+                if (options.repetitions == 0) {
+                    throw std::invalid_argument("--repetitions must be at least 1");
+                }
+            } else if (argument == "--seed") {
+                options.seed = std::stoull(requireValue(argc, argv, i), nullptr, 0);
+            } else if (argument == "--json") {
+                options.jsonPath = requireValue(argc, argv, i);
+            } else {
+                throw std::invalid_argument(std::format("Unknown option '{}'", argument));
+            }
+        }
+        return options;
+    }
+
+    // 1, 2, 4, ... below maxThreads, then maxThreads itself
+    std::vector<std::size_t> threadCounts(const std::size_t maxThreads) {
+        std::vector<std::size_t> counts;
+        for (std::size_t threads = 1; threads < maxThreads; threads *= 2) {
+            counts.push_back(threads);
+        }
+        counts.push_back(maxThreads);
+        return counts;
+    }
+
+    benchmark_scenarios::ScenarioResult fastestRun(
+        const benchmark_scenarios::Scenario& scenario,
+        const std::size_t particles,
+        const ScalingOptions& options
+    ) {
+        std::optional<benchmark_scenarios::ScenarioResult> fastest;
+        for (std::size_t repetition = 0; repetition < options.repetitions; ++repetition) {
+            auto result = benchmark_scenarios::runScenario(scenario, particles, options.seed);
+            if (!fastest || result.steppingSeconds < fastest->steppingSeconds) {
+                fastest = std::move(result);
+            }
+        }
+        return *fastest;
+    }
+
+    std::vector<ScalingPoint> runScaling(
+        const benchmark_scenarios::Scenario& scenario,
+        const std::size_t baseParticles,
+        const bool weak,
+        const ScalingOptions& options
+    ) {
+        std::vector<ScalingPoint> points;
+        for (const auto threads : threadCounts(options.maxThreads)) {
+            setWorkerThreadCount(threads);
+            ScalingPoint point;
+            point.threads = threads;
+            point.particles = weak ? baseParticles * threads : baseParticles;
+            point.result = fastestRun(scenario, point.particles, options);
+            point.seconds = point.result.steppingSeconds;
+
+            const double reference = points.empty() ? point.seconds : points.front().seconds;
+            if (point.seconds > 0.0) {
+                const double ratio = reference / point.seconds;
+                point.speedup = weak ? ratio * static_cast<double>(threads) : ratio;
+                point.efficiency = weak ? ratio : ratio / static_cast<double>(threads);
+            }
+            points.push_back(std::move(point));
+        }
+        return points;
+    }
+
+    // Percentage of the stepping wall time for each loss source
+    nlohmann::json attribution(const ScalingPoint& point) {
+        const auto& counters = point.result.counters;
+        const double wall = point.seconds * 1e9;
+        const double workers = static_cast<double>(point.threads);
+        const auto percent = [wall](const double nanoseconds) {
+            return wall > 0.0 ? 100.0 * nanoseconds / wall : 0.0;
+        };
+        const auto phase = [&counters](const StepPhase stepPhase) {
+            return static_cast<double>(counters.phaseNanoseconds[static_cast<std::size_t>(stepPhase)]);
+        };
+        return {
+            {"spawn_processing", percent(phase(StepPhase::SpawnProcessing))},
+            {"clock_update", percent(phase(StepPhase::ClockUpdate))},
+            {"purge", percent(phase(StepPhase::Purge))},
+            {"worker_idle", percent(static_cast<double>(counters.workerIdleNanoseconds) / workers)},
+            {"detector_lock_wait", percent(static_cast<double>(counters.detectorLockWaitNanoseconds) / workers)}
+        };
+    }
+
+    void printTable(const std::string_view title, const std::vector<ScalingPoint>& points, const bool weak) {
+        std::cout << std::format(
+            "\n{}\n{:>8} {:>10} {:>12} {:>9} {:>11} {:>9} {:>9} {:>9} {:>9} {:>9}\n",
+            title,
+            "Threads", "Particles", "Time (s)", weak ? "Scaled" : "Speedup", "Efficiency",
+            "Spawn %", "Clock %", "Purge %", "Idle %", "Lock %"
+        );
+        for (const auto& point : points) {
+            const auto losses = attribution(point);
+            std::cout << std::format(
+                "{:>8} {:>10} {:>12.4f} {:>9.2f} {:>10.1f}% {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f}\n",
+                point.threads,
+                point.particles,
+                point.seconds,
+                point.speedup,
+                point.efficiency * 100.0,
+                losses["spawn_processing"].get<double>(),
+                losses["clock_update"].get<double>(),
+                losses["purge"].get<double>(),
+                losses["worker_idle"].get<double>(),
+                losses["detector_lock_wait"].get<double>()
+            );
+        }
+    }
+
+    nlohmann::json toJson(const std::vector<ScalingPoint>& points) {
+        auto entries = nlohmann::json::array();
+        for (const auto& point : points) {
+            entries.push_back({
+                {"threads", point.threads},
+                {"particles", point.particles},
+                {"stepping_seconds", point.seconds},
+                {"speedup", point.speedup},
+                {"efficiency", point.efficiency},
+                {"loss_percent", attribution(point)},
+                {"result", benchmark_scenarios::toJson(point.result)}
+            });
+        }
+        return entries;
+    }
+} // namespace
+
+int main(const int argc, char** argv) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        const auto& scenario = benchmark_scenarios::findScenario(options.scenario);
+        const auto particles = options.particles.value_or(scenario.defaultParticles);
+
+        std::cout << std::format(
+            "Thread scaling for {} ({} particles, up to {} threads, best of {})\n",
+            scenario.name,
+            particles,
+            options.maxThreads,
+            options.repetitions
+        );
+
+        const auto strong = runScaling(scenario, particles, false, options);
+        const auto weak = runScaling(scenario, particles, true, options);
+        printTable("Strong scaling (fixed particle count)", strong, false);
+        printTable("Weak scaling (particles per thread fixed)", weak, true);
+
+        if (!options.jsonPath.empty()) {
+            const nlohmann::json document{
+                {"context", {
+                    {"scenario", scenario.name},
+                    {"hardware_concurrency", std::thread::hardware_concurrency()},
+                    {"seed", options.seed},
+                    {"repetitions", options.repetitions}
+                }},
+                {"strong_scaling", toJson(strong)},
+                {"weak_scaling", toJson(weak)}
+            };
+            std::ofstream out(options.jsonPath);
+            if (!out) {
+                throw std::runtime_error(std::format("Cannot open file '{}'", options.jsonPath));
+            }
+            out << document.dump(2) << '\n';
+            std::cout << std::format("\nWrote scaling results to '{}'\n", options.jsonPath);
+        }
+        return 0;
+    } catch (const std::exception& error) {
+        std::cerr << std::format("Thread scaling failed: {}\n", error.what());
+        return 1;
+    }
+}
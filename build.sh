@@ -19,8 +19,12 @@ cmake --build . --parallel "$(nproc 2>/dev/null || echo 1)" || exit 1
 
 # Find and run executable:
 
-# Look for executables in Build/ (top-level only)
-exe=$(find . -maxdepth 1 -type f ! -name "cmake*" ! -name "*.so" ! -name "*.a" -perm +111 | head -n 1)
+# Look for executables in Build/ (top-level only), preferring the main program over optional tools such as benchmarks
+if [ -x "./Simulation_program" ]; then
+    exe="./Simulation_program"
+else
+    exe=$(find . -maxdepth 1 -type f ! -name "cmake*" ! -name "*.so" ! -name "*.a" -perm +111 | head -n 1)
+fi
 
 if [ -n "$exe" ]; then
     echo ">>> Running program: $exe"
@@ -20,6 +20,8 @@ namespace config::paths {
     inline constexpr std::string_view buildDirectory = "Build";
     inline constexpr std::string_view outputDirectory = "Output";
     inline constexpr std::string_view databaseDirectory = "Databases";
+    inline constexpr std::string_view cacheDirectory = "Cache"; // Precomputed tables shared between runs (see table_cache.h)
+    inline constexpr std::string_view spillDirectory = "Spill"; // Particles spilled above the live budget (see particle_spill.h)
 
     inline constexpr std::string_view materialDatabaseJson = "databases/material-data/material_database.json";
     inline constexpr std::string_view particleDatabaseJson = "databases/particle-data/particle_database.json";
@@ -28,6 +30,8 @@ namespace config::paths {
     inline constexpr std::string_view particleDatabasePath = "Databases/particle_database.bin";
 
     inline constexpr std::string_view filenamePrefix = "Energies"; // Data output file name prefix
+
+    inline constexpr std::string_view daemonSocketPath = "/tmp/physics_simulation_program.sock"; // Unix socket of the run daemon
 } // namespace config::paths
 
 #endif //PHYSICS_SIMULATION_PROGRAM_PATH_CONFIG_H
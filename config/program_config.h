@@ -14,6 +14,7 @@
 #define PHYSICS_SIMULATION_PROGRAM_PROGRAM_CONFIG_H
 
 #include <cstddef>
+#include <cstdint>
 
 namespace config::program {
     inline constexpr std::size_t maxWorkerThreads = 0;           // 0 -> auto-detect (hardware_concurrency) else value = actual thread count set
@@ -23,10 +24,32 @@ namespace config::program {
     inline constexpr double geometryTolerance = 1e-10;           // Relative/absolute scale for geometry comparisons
     inline constexpr double boundaryFallbackScale = 5.0;         // Multiplier on geometryTolerance for no-hit step shrink
     inline constexpr double boundaryEpsilonScale = 1e-6;         // Fraction of travelledDistance used for post-hit nudging
+    inline constexpr bool analyticWallBounces = true;            // Apply whole bounce sequences of reflective particles in childless Box/Sphere media in one update
+    inline constexpr std::size_t interleavedTracks = 1;          // Particles each stepping worker advances in turn to overlap cache misses (1 -> one at a time, baseline draw order)
     inline constexpr double lorentzGammaLimit = 1e6;             // Maximum allowed Lorentz factor before clamping
     inline constexpr double timeSynchronisationTolerance = 1e-9; // Relative tolerance for Particle::synchroniseTime()
     inline constexpr double hyperfineSelectionTolerance = 1e-9;  // Relative tolerance for Atom hyperfine level matching
     inline constexpr double stepLimiterTolerance = 1e-9;         // Relative tolerance when comparing competing step events
+
+    inline constexpr std::size_t watchdogMaxSteps = 1000000;     // Steps one particle may take in one stepAll before the watchdog trips (0 -> disabled)
+    inline constexpr std::size_t watchdogProgressWindow = 10000; // Steps between watchdog progress checks (0 -> disabled)
+    inline constexpr double watchdogMinProgressFraction = 1e-6;  // Fraction of the stepAll interval a particle must advance per progress window
+    inline constexpr double watchdogNudgeScale = 1e3;            // Multiplier on geometryTolerance for the watchdog nudge distance
+
+    inline constexpr bool adaptiveTimeStep = false;              // Let step_controller choose each stepAll interval of stepUntil* (false -> fixed dt)
+    inline constexpr double adaptiveMinTimeStep = 1e-18;         // Lower bound on adaptive stepAll intervals (in seconds)
+    inline constexpr double adaptiveMaxTimeStep = 1e-9;          // Upper bound on adaptive stepAll intervals (in seconds)
+    inline constexpr double adaptiveTargetStepsPerVisit = 8.0;   // Boundary, decay and interaction steps per particle per stepAll aimed for
+    inline constexpr double adaptiveMaxSecondariesPerVisit = 0.05; // Secondaries per particle per stepAll above which the interval shrinks
+    inline constexpr double adaptiveMaxWallSeconds = 0.5;        // Wall time per stepAll above which the interval shrinks (0 -> unbounded)
+
+    inline constexpr std::uint16_t metricsServerPort = 0;        // Port for the Prometheus endpoint on 127.0.0.1 (0 -> disabled)
+    inline constexpr std::size_t daemonProgressInterval = 100;   // stepAll calls between progress messages to daemon clients
+    inline constexpr std::size_t daemonWorldCacheSize = 16;      // Built worlds the daemon keeps for reuse before evicting the least recently used (0 -> unbounded)
+    inline constexpr std::size_t liveParticleBudget = 0;         // Live particles kept in memory before spilling to disk (0 -> unbounded)
+    inline constexpr std::size_t spillPageParticles = 4096;      // Particles per spill file page (unit of disk reads and writes)
+    inline constexpr std::uint64_t cacheMaxBytes = std::uint64_t{1} << 30; // On-disk table cache size limit before LRU eviction (0 -> disabled)
+    inline constexpr std::size_t fresnelTableSamples = 513;      // Samples in cos(incidence) per optical element Fresnel table (at least 2)
 } // namespace config::program
 
 #endif //PHYSICS_SIMULATION_PROGRAM_PROGRAM_CONFIG_H
@@ -0,0 +1,339 @@
+//
+// Physics Simulation Program
+// File: table_cache.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of table_cache.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/cache/table_cache.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "config/path_config.h"
+#include "config/program_config.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace table_cache {
+    namespace {
+        constexpr std::array k_magic{'P', 'S', 'P', 'C', 'A', 'C', 'H', 'E'};
+        constexpr std::uint32_t k_containerVersion = 1;            // Bump when Header changes
+        constexpr auto k_abandonedTemporaryAge = std::chrono::hours(1); // Far beyond any write, so the writer has died
+        constexpr std::string_view k_blobExtension = ".bin";
+        constexpr std::string_view k_temporaryMarker = ".tmp-";
+
+        // FNV-1a constants
+        constexpr std::uint64_t k_hashOffset = 1469598103934665603ULL;
+        constexpr std::uint64_t k_hashPrime = 1099511628211ULL;
+
+        struct Header {
+            std::array<char, 8> magic;
+            std::uint32_t containerVersion;
+            std::uint32_t tableVersion;
+            std::uint64_t hash;
+            std::uint64_t payloadSize;
+            std::uint64_t checksum;
+        };
+        static_assert(sizeof(Header) % 8 == 0, "Payloads must start 8-byte aligned in the mapping");
+
+        std::filesystem::path& directoryStorage() {
+            static std::filesystem::path directory{config::paths::cacheDirectory};
+            return directory;
+        }
+
+        void validateKind(const std::string_view kind) {
+            const bool valid = !kind.empty() && std::ranges::all_of(kind, [](const char ch) {
+                return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == '-';
+            });
+            if (!valid) {
+                throw std::invalid_argument(std::format("Invalid table cache kind '{}'", kind));
+            }
+        }
+
+        // Everything before the version, shared by every version of one table
+        std::string blobStem(const Key& key) {
+            return std::format("{}-{:016x}.v", key.kind, key.hash);
+        }
+
+        std::string blobName(const Key& key) {
+            return std::format("{}{}{}", blobStem(key), key.version, k_blobExtension);
+        }
+
+        std::uint64_t checksum(const std::span<const std::byte> bytes) noexcept {
+            std::uint64_t hash = k_hashOffset;
+            for (const auto byte : bytes) {
+                hash ^= static_cast<std::uint64_t>(byte);
+                hash *= k_hashPrime;
+            }
+            return hash;
+        }
+
+        // Header and payload agree with the key and the file size
+        bool headerMatches(const Header& header, const Key& key, const std::size_t fileSize) noexcept {
+            return header.magic == k_magic
+                && header.containerVersion == k_containerVersion
+                && header.tableVersion == key.version
+                && header.hash == key.hash
+                && header.payloadSize == fileSize - sizeof(Header);
+        }
+
+        void removeQuietly(const std::filesystem::path& path) noexcept {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+
+        // Unique across threads and processes sharing the directory
+        std::string temporaryName(const Key& key) {
+            static std::atomic<std::uint64_t> counter{0};
+#if defined(__unix__) || defined(__APPLE__)
+            const auto process = static_cast<std::uint64_t>(getpid());
+#else
+            const auto process = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+            return std::format(
+                "{}{}{:x}-{:x}-{}",
+                blobName(key),
+                k_temporaryMarker,
+                process,
+                std::hash<std::thread::id>{}(std::this_thread::get_id()),
+                counter.fetch_add(1, std::memory_order_relaxed)
+            );
+        }
+
+        // Older or newer versions of a table whose inputs match key; only one version can be current for this binary
+        void removeOtherVersions(const Key& key) {
+            const auto stem = blobStem(key);
+            const auto current = blobName(key);
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(directory(), ec)) {
+                const auto name = entry.path().filename().string();
+                if (name.starts_with(stem) && name.ends_with(k_blobExtension) && name != current
+                    && name.find(k_temporaryMarker) == std::string::npos) {
+                    removeQuietly(entry.path());
+                }
+            }
+        }
+    } // namespace
+
+    MappedBlob::MappedBlob(MappedBlob&& other) noexcept :
+        m_mapping(std::exchange(other.m_mapping, nullptr)),
+        m_mappingSize(std::exchange(other.m_mappingSize, 0)),
+        m_fallback(std::move(other.m_fallback)),
+        m_payload(std::exchange(other.m_payload, {})) {}
+
+    MappedBlob& MappedBlob::operator=(MappedBlob&& other) noexcept {
+        if (this != &other) {
+            this->release();
+            this->m_mapping = std::exchange(other.m_mapping, nullptr);
+            this->m_mappingSize = std::exchange(other.m_mappingSize, 0);
+            this->m_fallback = std::move(other.m_fallback);
+            this->m_payload = std::exchange(other.m_payload, {});
+        }
+        return *this;
+    }
+
+    MappedBlob::~MappedBlob() {
+        this->release();
+    }
+
+    void MappedBlob::release() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+        if (this->m_mapping != nullptr) {
+            munmap(this->m_mapping, this->m_mappingSize);
+        }
+#endif
+        this->m_mapping = nullptr;
+        this->m_mappingSize = 0;
+        this->m_fallback.clear();
+        this->m_payload = {};
+    }
+
+    std::optional<MappedBlob> load(const Key& key) {
+        if constexpr (config::program::cacheMaxBytes == 0) {
+            return std::nullopt;
+        }
+        validateKind(key.kind);
+        const auto path = directory() / blobName(key);
+
+        MappedBlob blob;
+        std::span<const std::byte> file;
+#if defined(__unix__) || defined(__APPLE__)
+        const int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0) {
+            return std::nullopt;
+        }
+        struct stat status{};
+        if (fstat(descriptor, &status) < 0 || status.st_size < static_cast<off_t>(sizeof(Header))) {
+            close(descriptor);
+            removeQuietly(path);
+            return std::nullopt;
+        }
+        const auto size = static_cast<std::size_t>(status.st_size);
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor); // The mapping keeps the file open
+        if (mapping == MAP_FAILED) {
+            return std::nullopt;
+        }
+        blob.m_mapping = mapping;
+        blob.m_mappingSize = size;
+        file = {static_cast<const std::byte*>(mapping), size};
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            return std::nullopt;
+        }
+        blob.m_fallback.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(blob.m_fallback.data()), static_cast<std::streamsize>(blob.m_fallback.size()));
+        if (!in || blob.m_fallback.size() < sizeof(Header)) {
+            return std::nullopt;
+        }
+        file = blob.m_fallback;
+#endif
+
+        Header header{};
+        std::memcpy(&header, file.data(), sizeof(Header));
+        const auto payload = file.subspan(sizeof(Header));
+        if (!headerMatches(header, key, file.size()) || checksum(payload) != header.checksum) {
+            removeQuietly(path);
+            return std::nullopt;
+        }
+        blob.m_payload = payload;
+
+        std::error_code ec;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec); // Recently used for eviction
+        return blob;
+    }
+
+    bool store(const Key& key, const std::span<const std::byte> payload) {
+        validateKind(key.kind);
+        if constexpr (config::program::cacheMaxBytes == 0) {
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(directory(), ec);
+        const auto temporary = directory() / temporaryName(key);
+        const auto destination = directory() / blobName(key);
+
+        Header header{};
+        header.magic = k_magic;
+        header.containerVersion = k_containerVersion;
+        header.tableVersion = key.version;
+        header.hash = key.hash;
+        header.payloadSize = payload.size();
+        header.checksum = checksum(payload);
+        {
+            std::ofstream out(temporary, std::ios::binary);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            out.close();
+            if (!out) {
+                removeQuietly(temporary);
+                std::cerr << std::format("Failed to write table cache file '{}'\n", temporary.string());
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporary, destination, ec);
+        if (ec) {
+            removeQuietly(temporary);
+            std::cerr << std::format("Failed to publish table cache file '{}': {}\n", destination.string(), ec.message());
+            return false;
+        }
+
+        removeOtherVersions(key);
+        evict(config::program::cacheMaxBytes);
+        return true;
+    }
+
+    void evict(const std::uint64_t maxBytes) {
+        struct Entry {
+            std::filesystem::path path;
+            std::uint64_t size = 0;
+            std::filesystem::file_time_type lastUsed;
+        };
+        std::vector<Entry> blobs;
+        std::uint64_t totalBytes = 0;
+        const auto now = std::filesystem::file_time_type::clock::now();
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory(), ec)) {
+            std::error_code entryError;
+            if (!entry.is_regular_file(entryError)) {
+                continue;
+            }
+            const auto name = entry.path().filename().string();
+            const auto lastUsed = entry.last_write_time(entryError);
+            if (entryError) {
+                continue; // Removed by another process since the listing
+            }
+            if (name.find(k_temporaryMarker) != std::string::npos) {
+                if (now - lastUsed > k_abandonedTemporaryAge) {
+                    removeQuietly(entry.path());
+                }
+                continue;
+            }
+            if (!name.ends_with(k_blobExtension)) {
+                continue; // Not ours
+            }
+            const auto size = entry.file_size(entryError);
+            if (!entryError) {
+                blobs.push_back({entry.path(), size, lastUsed});
+                totalBytes += size;
+            }
+        }
+
+        if (totalBytes <= maxBytes) {
+            return;
+        }
+        std::ranges::sort(blobs, {}, &Entry::lastUsed);
+        for (const auto& blob : blobs) {
+            if (totalBytes <= maxBytes) {
+                break;
+            }
+            removeQuietly(blob.path);
+            totalBytes -= blob.size;
+        }
+    }
+
+    void clear() {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory(), ec)) {
+            const auto name = entry.path().filename().string();
+            if (name.ends_with(k_blobExtension) || name.find(k_temporaryMarker) != std::string::npos) {
+                removeQuietly(entry.path());
+            }
+        }
+    }
+
+    const std::filesystem::path& directory() {
+        return directoryStorage();
+    }
+
+    void setDirectory(std::filesystem::path directory) {
+        directoryStorage() = std::move(directory);
+    }
+} // namespace table_cache
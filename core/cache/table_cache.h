@@ -0,0 +1,113 @@
+//
+// Physics Simulation Program
+// File: table_cache.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Content-addressed on-disk cache for expensive precomputed tables, shared between runs and processes
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_TABLE_CACHE_H
+#define PHYSICS_SIMULATION_PROGRAM_TABLE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// table_cache
+//
+// Notes on initialisation:
+//   - Blobs live in config::paths::cacheDirectory (created on first store) unless setDirectory() picks another; the
+//     cache is disabled when config::program::cacheMaxBytes is 0
+//   - A table is addressed by its kind (a short name such as "field_map"), a 64-bit hash of every input it is built
+//     from, and the table's format version; callers bump the version whenever the builder's output would change for
+//     the same inputs
+//
+// Notes on algorithms:
+//   - Each blob is one file named <kind>-<hash>.v<version>.bin holding a fixed header (magic, container and table
+//     versions, hash, payload size and an FNV-1a checksum of the payload) followed by the payload, 8-byte aligned
+//   - load() maps the file read-only (POSIX mmap, a plain read elsewhere), so concurrent processes loading the same
+//     table share its pages through the OS page cache; a blob failing any header or checksum test is deleted and
+//     reported as a miss
+//   - store() writes a uniquely named temporary file in the cache directory and renames it into place; rename is
+//     atomic, so concurrent writers of the same table never expose a partial file and the last one wins (their
+//     contents are identical by construction)
+//   - Eviction runs after every store(): blobs of the same kind and hash with another version are removed as stale,
+//     temporary files left by crashed writers are removed after an hour, and if the directory exceeds cacheMaxBytes
+//     the least recently used blobs go first (load() refreshes a blob's modification time). Removing a blob another
+//     process has mapped is safe on POSIX, as the mapping outlives the name
+//   - I/O failures never fail the caller: a failed load is a miss and a failed store prints a warning
+//
+// Supported overloads / operations and functions / methods:
+//   - Lookup:                 load()
+//   - Insertion:              store()
+//   - Maintenance:            evict(), clear()
+//   - Location:               directory(), setDirectory()
+//   - Mapped data:            MappedBlob::bytes()
+//
+// Example usage:
+//   const table_cache::Key key{"field_map", configurationHash, 1};
+//   if (const auto blob = table_cache::load(key)) {
+//       map = FieldMap::fromBytes(blob->bytes(), "table cache");
+//   } else {
+//       map = buildMap();
+//       table_cache::store(key, map.toBytes());
+//   }
+namespace table_cache {
+    struct Key {
+        std::string_view kind; // File name prefix; letters, digits, '_' and '-' only
+        std::uint64_t hash = 0;
+        std::uint32_t version = 0;
+    };
+
+    // MappedBlob
+    //
+    // Read-only view of a cached payload, valid while the blob is alive
+    class MappedBlob {
+        public:
+            MappedBlob(const MappedBlob&) = delete;
+            MappedBlob& operator=(const MappedBlob&) = delete;
+            MappedBlob(MappedBlob&& other) noexcept;
+            MappedBlob& operator=(MappedBlob&& other) noexcept;
+            ~MappedBlob();
+
+            [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return this->m_payload; }
+
+        private:
+            friend std::optional<MappedBlob> load(const Key& key);
+
+            MappedBlob() = default;
+            void release() noexcept;
+
+            void* m_mapping = nullptr;          // Whole file when mapped
+            std::size_t m_mappingSize = 0;
+            std::vector<std::byte> m_fallback;  // Whole file when mapping is unavailable
+            std::span<const std::byte> m_payload;
+    };
+
+    // Return the blob for key, or std::nullopt if absent, stale or corrupt (corrupt files are deleted)
+    [[nodiscard]] std::optional<MappedBlob> load(const Key& key);
+
+    // Atomically publish payload under key, then run evict(); returns false (after a warning on std::cerr) if the blob
+    // could not be written. Throws std::invalid_argument if key.kind is empty or has characters outside [A-Za-z0-9_-]
+    bool store(const Key& key, std::span<const std::byte> payload);
+
+    // Remove abandoned temporary files, then least recently used blobs until the directory holds at most maxBytes
+    void evict(std::uint64_t maxBytes);
+
+    // Remove every blob and temporary file
+    void clear();
+
+    // Cache directory; setDirectory() is meant for set-up and tools, not for use while other threads use the cache
+    [[nodiscard]] const std::filesystem::path& directory();
+    void setDirectory(std::filesystem::path directory);
+} // namespace table_cache
+
+#endif //PHYSICS_SIMULATION_PROGRAM_TABLE_CACHE_H
@@ -0,0 +1,79 @@
+//
+// Physics Simulation Program
+// File: vector_math.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of vector_math.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/maths/vector_math.h"
+
+#include <format>
+#include <stdexcept>
+
+namespace {
+    void requireLength(const std::size_t inputLength, const std::size_t outputLength, const char* kernel) {
+        if (outputLength < inputLength) {
+            throw std::invalid_argument(std::format(
+                "vector_math::{} output holds {} values but {} inputs were supplied",
+                kernel,
+                outputLength,
+                inputLength
+            ));
+        }
+    }
+} // namespace
+
+void vector_math::log(const std::span<const double> input, const std::span<double> output) {
+    requireLength(input.size(), output.size(), "log");
+    const double* in = input.data();
+    double* out = output.data();
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        out[i] = vector_math::log(in[i]);
+    }
+}
+
+void vector_math::exp(const std::span<const double> input, const std::span<double> output) {
+    requireLength(input.size(), output.size(), "exp");
+    const double* in = input.data();
+    double* out = output.data();
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        out[i] = vector_math::exp(in[i]);
+    }
+}
+
+void vector_math::sincos(const std::span<const double> input, const std::span<double> sine, const std::span<double> cosine) {
+    requireLength(input.size(), sine.size(), "sincos");
+    requireLength(input.size(), cosine.size(), "sincos");
+    const double* in = input.data();
+    double* sineOut = sine.data();
+    double* cosineOut = cosine.data();
+
+    // Any argument outside the reduction range (rare) sends the whole batch through the branching scalar form
+    std::size_t outOfRange = 0;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        outOfRange += std::abs(in[i]) > k_sincosReductionLimit ? 1 : 0;
+    }
+    if (outOfRange > 0) [[unlikely]] {
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            vector_math::sincos(in[i], sineOut[i], cosineOut[i]);
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        kernels::sincosReduced(in[i], sineOut[i], cosineOut[i]);
+    }
+}
+
+void vector_math::rsqrt(const std::span<const double> input, const std::span<double> output) {
+    requireLength(input.size(), output.size(), "rsqrt");
+    const double* in = input.data();
+    double* out = output.data();
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        out[i] = vector_math::rsqrt(in[i]);
+    }
+}
@@ -0,0 +1,226 @@
+//
+// Physics Simulation Program
+// File: vector_math.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes the branch-free log, exp, sincos and rsqrt kernels used by the samplers, in scalar and batch form
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_VECTOR_MATH_H
+#define PHYSICS_SIMULATION_PROGRAM_VECTOR_MATH_H
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+// vector_math
+//
+// Notes on initialisation:
+//   - Stateless; the scalar kernels are inline so hot per-particle samplers inline them, and the batch overloads run the
+//     same kernels over spans
+//
+// Notes on algorithms:
+//   - libm calls are opaque to the compiler, so a loop over std::log or std::sin stays scalar. These kernels are
+//     straight-line double arithmetic with selects instead of branches (range reduction, a polynomial, then exponent
+//     bit manipulation through std::bit_cast), which the compiler vectorises to whatever SIMD width the target allows
+//   - log:    x = 2^k m with m in [sqrt(2)/2, sqrt(2)), log(m) = 2 atanh(f / (2 + f)) for f = m - 1, with the fdlibm
+//             degree 14 minimax polynomial in s = f / (2 + f); subnormal inputs are scaled by 2^54 first
+//   - exp:    x = k ln(2) + r with |r| <= ln(2) / 2 (ln(2) split in two parts), the fdlibm rational form for exp(r),
+//             then scaling by 2^k in two halves so subnormal results stay correct
+//   - sincos: n = nearest integer to 2x / pi, r = x - n pi / 2 as a head and tail with a four part Cody-Waite
+//             constant (the first three products exact for |n| < 2^20), the fdlibm kernels for sin(r) and cos(r) on [-pi/4, pi/4],
+//             and the quadrant n mod 4 picks and negates them. One reduction serves both results. Above
+//             k_sincosReductionLimit the scalar form branches to libm, and a batch holding any such argument runs the
+//             scalar form throughout; infinities and NaN give NaN like libm
+//   - rsqrt:  1 / sqrt(x); both operations are correctly rounded vector instructions, so no estimate and Newton steps
+//             are needed in double precision (two roundings give the 1.5 ULP bound)
+//   - vector_math.cpp is compiled with -fno-trapping-math and -fno-math-errno, without which GCC keeps the selects as
+//     branches and sqrt as a call. Baseline x86-64 has 2 doubles per vector; SIMULATION_NATIVE_ARCH lets AVX2 or
+//     AVX-512 hosts use 4 or 8
+//   - Special values follow libm: log of a negative or NaN is NaN, log(0) = -inf, exp overflows to +inf and underflows
+//     to 0, rsqrt(0) = +inf
+//
+// Notes on output:
+//   - Maximum errors against the correctly rounded result, in units in the last place, are given by k_logMaxUlp,
+//     k_expMaxUlp, k_sincosMaxUlp (|x| <= k_sincosReductionLimit) and k_rsqrtMaxUlp; the math_verification target
+//     measures them and compares sampler statistics with libm
+//   - Results may differ from libm in the last bit, so swapping a libm call for a kernel changes sampled values but not
+//     their distribution
+//
+// Supported overloads / operations and functions / methods:
+//   - Scalar kernels:         log(), exp(), sincos(), rsqrt()
+//   - Batch kernels:          log(), exp(), sincos(), rsqrt() over std::span
+//
+// Example usage:
+//   const double opticalDepth = -vector_math::log(draw);
+//   double s = 0.0, c = 0.0;
+//   vector_math::sincos(phi, s, c);
+//   vector_math::log(draws, depths); // depths[i] = log(draws[i])
+namespace vector_math {
+    inline constexpr double k_logMaxUlp = 1.0;
+    inline constexpr double k_expMaxUlp = 1.0;
+    inline constexpr double k_sincosMaxUlp = 1.0;
+    inline constexpr double k_rsqrtMaxUlp = 1.5;
+    inline constexpr double k_sincosReductionLimit = 1.0e6; // |x| above which sincos() falls back to libm
+
+    namespace kernels {
+        inline constexpr double k_ln2Hi = 6.93147180369123816490e-01;
+        inline constexpr double k_ln2Lo = 1.90821492927058770002e-10;
+        inline constexpr double k_inverseLn2 = 1.44269504088896338700e+00;
+        inline constexpr double k_inverseHalfPi = 6.36619772367581382433e-01;
+        inline constexpr double k_halfPi1 = 1.57079632673412561417e+00;   // First 33 bits of pi / 2
+        inline constexpr double k_halfPi2 = 6.07710050630396597660e-11;   // Next 33 bits
+        inline constexpr double k_halfPi3 = 2.02226624871116645580e-21;   // Next 33 bits
+        inline constexpr double k_halfPi3Tail = 8.47842766036889956997e-32; // pi / 2 - the three parts above
+        inline constexpr double k_roundingShift = 6755399441055744.0;      // 1.5 * 2^52: adding and subtracting rounds to an integer
+
+        // Round to the nearest integer for |x| < 2^51, giving the integer in the low bits of the shifted value
+        inline double roundShifted(const double x, std::int64_t& integer) noexcept {
+            const double shifted = x + k_roundingShift;
+            integer = std::bit_cast<std::int64_t>(shifted) - std::bit_cast<std::int64_t>(k_roundingShift);
+            return shifted - k_roundingShift;
+        }
+
+        // 2^exponent for exponent in [-1022, 1023]
+        inline double powerOfTwo(const std::int64_t exponent) noexcept {
+            return std::bit_cast<double>(static_cast<std::uint64_t>(exponent + 1023) << 52);
+        }
+
+        // Exact conversion of an integer below 2^52 without an int64 to double instruction (absent before AVX-512)
+        inline double toDouble(const std::uint64_t integer) noexcept {
+            return std::bit_cast<double>(std::bit_cast<std::uint64_t>(4503599627370496.0) | integer) - 4503599627370496.0;
+        }
+
+        // a + b with its rounding error (Knuth's TwoSum, no ordering of |a| and |b| needed)
+        inline double twoSum(const double a, const double b, double& error) noexcept {
+            const double sum = a + b;
+            const double bVirtual = sum - a;
+            error = (a - (sum - bVirtual)) + (b - bVirtual);
+            return sum;
+        }
+
+        // Valid for |x| <= k_sincosReductionLimit; NaN for non-finite x
+        inline void sincosReduced(const double x, double& sine, double& cosine) noexcept {
+            std::int64_t quadrant = 0;
+            const double n = roundShifted(x * k_inverseHalfPi, quadrant);
+
+            // r = x - n pi / 2 as head + tail; x - n k_halfPi1 and the first three products are exact, and each
+            // subtraction keeps its rounding error, so r is accurate even when x is within 2^-60 x of a multiple of pi / 2
+            double error2 = 0.0;
+            double error3 = 0.0;
+            const double reduced2 = twoSum(x - n * k_halfPi1, -n * k_halfPi2, error2);
+            const double reduced3 = twoSum(reduced2, -n * k_halfPi3, error3);
+            const double tail = (error2 + error3) - n * k_halfPi3Tail;
+            const double r = reduced3 + tail;
+            const double rTail = (reduced3 - r) + tail;
+
+            const double z = r * r;
+            const double w = z * z;
+            const double v = z * r;
+            const double sinPolynomial = 8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 + z * 2.75573137070700676789e-06)
+                + z * w * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10);
+            const double s = r - ((z * (0.5 * rTail - v * sinPolynomial) - rTail) - v * -1.66666666666666324348e-01);
+
+            const double cosPolynomial = z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * 2.48015872894767294178e-05))
+                + w * w * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11));
+            const double halfZ = 0.5 * z;
+            const double oneMinusHalfZ = 1.0 - halfZ;
+            const double c = oneMinusHalfZ + (((1.0 - oneMinusHalfZ) - halfZ) + (z * cosPolynomial - r * rTail));
+
+            // Quadrant 0: (s, c), 1: (c, -s), 2: (-s, -c), 3: (-c, s); tested as a double since 64-bit integer compares
+            // are not available in baseline x86-64 SIMD
+            const double q = toDouble(static_cast<std::uint64_t>(quadrant) & 3);
+            const bool swap = (q == 1.0) | (q == 3.0);
+            const double sineBase = swap ? c : s;
+            const double cosineBase = swap ? s : c;
+            sine = q >= 2.0 ? -sineBase : sineBase;
+            cosine = (q == 1.0) | (q == 2.0) ? -cosineBase : cosineBase;
+        }
+    } // namespace kernels
+
+    // Natural logarithm; at most k_logMaxUlp from the correctly rounded result
+    inline double log(const double x) noexcept {
+        const bool subnormal = x < std::numeric_limits<double>::min();
+        const double scaled = x * (subnormal ? 18014398509481984.0 : 1.0); // 2^54; unconditional so it vectorises
+
+        // Offset so the exponent field rounds m into [sqrt(2)/2, sqrt(2))
+        const auto bits = std::bit_cast<std::uint64_t>(scaled) + (0x3ff0000000000000ULL - 0x3fe6a09e00000000ULL);
+        const double dk = kernels::toDouble(bits >> 52) - (subnormal ? 1077.0 : 1023.0);
+        const double m = std::bit_cast<double>((bits & 0x000fffffffffffffULL) + 0x3fe6a09e00000000ULL);
+
+        const double f = m - 1.0;
+        const double halfFSquared = 0.5 * f * f;
+        const double s = f / (2.0 + f);
+        const double z = s * s;
+        const double w = z * z;
+        const double odd = w * (3.999999999940941908e-01 + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+        const double even = z * (6.666666666666735130e-01 + w * (2.857142874366239149e-01
+            + w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)));
+        double result = s * (halfFSquared + odd + even) + dk * kernels::k_ln2Lo - halfFSquared + f + dk * kernels::k_ln2Hi;
+
+        // One select per special case so the loop stays branch-free
+        result = x == std::numeric_limits<double>::infinity() ? x : result;
+        result = x == 0.0 ? -std::numeric_limits<double>::infinity() : result;
+        result = x >= 0.0 ? result : std::numeric_limits<double>::quiet_NaN();
+        return result;
+    }
+
+    // Exponential; at most k_expMaxUlp from the correctly rounded result for normal results
+    inline double exp(const double x) noexcept {
+        constexpr double overflow = 7.09782712893383973096e+02;
+        constexpr double underflow = -7.45133219101941108420e+02;
+        const double clamped = x > overflow ? overflow : (x < underflow ? underflow : x);
+
+        std::int64_t k = 0;
+        const double n = kernels::roundShifted(clamped * kernels::k_inverseLn2, k);
+        const double hi = clamped - n * kernels::k_ln2Hi;
+        const double lo = n * kernels::k_ln2Lo;
+        const double r = hi - lo;
+
+        const double rr = r * r;
+        const double c = r - rr * (1.66666666666666019037e-01 + rr * (-2.77777777770155933842e-03
+            + rr * (6.61375632143793436117e-05 + rr * (-1.65339022054652515390e-06 + rr * 4.13813679705723846039e-08))));
+        const double y = 1.0 + (r * c / (2.0 - c) - lo + hi);
+
+        // 2^k in two factors keeps both normal for subnormal results and for k = 1024; the offset keeps the shift logical
+        const auto half = static_cast<std::int64_t>(static_cast<std::uint64_t>(k + 2048) >> 1) - 1024;
+        double result = y * kernels::powerOfTwo(half) * kernels::powerOfTwo(k - half);
+
+        result = x > overflow ? std::numeric_limits<double>::infinity() : result;
+        result = x < underflow ? 0.0 : result;
+        result = x == x ? result : x;
+        return result;
+    }
+
+    // Sine and cosine of x from one reduction; at most k_sincosMaxUlp from the correctly rounded results
+    inline void sincos(const double x, double& sine, double& cosine) noexcept {
+        if (std::abs(x) > k_sincosReductionLimit) [[unlikely]] {
+            sine = std::sin(x);
+            cosine = std::cos(x);
+            return;
+        }
+        kernels::sincosReduced(x, sine, cosine);
+    }
+
+    // 1 / sqrt(x); at most k_rsqrtMaxUlp from the correctly rounded result
+    inline double rsqrt(const double x) noexcept {
+        return 1.0 / std::sqrt(x);
+    }
+
+    // Batch kernels
+    //
+    // output[i] = f(input[i]) for every element of input; output may alias input. Throw std::invalid_argument if an
+    // output is shorter than input
+    void log(std::span<const double> input, std::span<double> output);
+    void exp(std::span<const double> input, std::span<double> output);
+    void sincos(std::span<const double> input, std::span<double> sine, std::span<double> cosine);
+    void rsqrt(std::span<const double> input, std::span<double> output);
+} // namespace vector_math
+
+#endif //PHYSICS_SIMULATION_PROGRAM_VECTOR_MATH_H
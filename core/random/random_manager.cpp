@@ -12,11 +12,18 @@
 
 #include "core/random/random_manager.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <limits>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
+#include <utility>
+
+#include "core/maths/vector_math.h"
+#include "core/tracing/lock_profiling.h"
+#include "core/tracing/memory_accounting.h"
 
 namespace random_manager {
     namespace {
@@ -54,18 +61,25 @@ namespace random_manager {
         struct EngineWrapper { // Ignore warning the engine is properly and immediately reseeded appropriately
             std::ranlux48 engine;
             std::uint64_t seedUsed = std::numeric_limits<std::uint64_t>::max();
+            std::array<double, k_exponentialBatchSize> exponentials{}; // Pre-drawn variates, consumed from the back
+            std::size_t exponentialsLeft = 0;                          // Zeroed on every reseed
         };
 
         std::atomic<std::uint64_t> g_masterSeedAtomic{0};
-        std::mutex g_seedMutex;
+        lock_profiling::ProfiledMutex g_seedMutex{"random_seed"};
         std::unordered_map<Stream, std::uint64_t> g_streamSeeds;
         std::atomic<std::uint64_t> g_seedVersion{0};
 
         thread_local std::unordered_map<StreamKey, EngineWrapper, StreamKeyHasher> g_threadEngines;
+        thread_local memory_accounting::TrackedBytes g_threadEngineMemory{memory_accounting::Category::RandomEngines};
         thread_local std::uint64_t g_cachedSeedVersion = std::numeric_limits<std::uint64_t>::max();
         thread_local std::size_t g_threadStreamIndex = 0;
+        thread_local std::optional<std::uint64_t> g_threadMasterSeed;
 
         std::uint64_t ensureMasterSeed() {
+            if (g_threadMasterSeed.has_value()) {
+                return *g_threadMasterSeed;
+            }
             if (const auto current = g_masterSeedAtomic.load(std::memory_order_acquire); current != 0) {
                 return current;
             }
@@ -120,9 +134,24 @@ namespace random_manager {
             return composed;
         }
 
+        // Nodes (key, engine and next pointer) plus the bucket array of the calling thread's engine map
+        void updateThreadEngineMemory() noexcept {
+            constexpr std::size_t nodeBytes = sizeof(std::pair<const StreamKey, EngineWrapper>) + sizeof(void*);
+            g_threadEngineMemory.resize(
+                g_threadEngines.size() * nodeBytes + g_threadEngines.bucket_count() * sizeof(void*),
+                g_threadEngines.size()
+            );
+        }
+
         void reseedThreadEnginesIfNeeded() {
             const auto globalVersion = g_seedVersion.load(std::memory_order_acquire);
-            if (g_cachedSeedVersion == globalVersion || g_threadEngines.empty()) {
+            if (g_cachedSeedVersion == globalVersion) {
+                return;
+            }
+            if (g_threadEngines.empty()) {
+                // Engines created from here on are seeded with the current seeds; without recording the version the next
+                // call would reseed them and replay their first draws
+                g_cachedSeedVersion = globalVersion;
                 return;
             }
 
@@ -130,11 +159,43 @@ namespace random_manager {
                 const auto seed = finalSeed(key.stream, key.index);
                 wrapper.engine.seed(seed);
                 wrapper.seedUsed = seed;
+                wrapper.exponentialsLeft = 0;
             }
 
             g_cachedSeedVersion = globalVersion;
         }
 
+        EngineWrapper& engineWrapper(const Stream stream, const std::size_t streamIndex) {
+            ensureMasterSeed();
+            reseedThreadEnginesIfNeeded();
+
+            const StreamKey key{stream, streamIndex};
+            auto [iterator, inserted] = g_threadEngines.try_emplace(key);
+            auto& wrapper = iterator->second;
+            if (const auto seed = finalSeed(stream, streamIndex); inserted || wrapper.seedUsed != seed) {
+                wrapper.engine.seed(seed);
+                wrapper.seedUsed = seed;
+                wrapper.exponentialsLeft = 0;
+            }
+            if (inserted) {
+                updateThreadEngineMemory();
+            }
+            return wrapper;
+        }
+
+        // Uniforms are clamped to (0, 1) as the scalar samplers did, so every variate is finite and positive
+        void refillExponentials(EngineWrapper& wrapper) {
+            std::uniform_real_distribution uniform(0.0, 1.0);
+            for (auto& value : wrapper.exponentials) {
+                value = std::clamp(uniform(wrapper.engine), std::numeric_limits<double>::min(),
+                                   1.0 - std::numeric_limits<double>::epsilon());
+            }
+            vector_math::log(wrapper.exponentials, wrapper.exponentials);
+            for (auto& value : wrapper.exponentials) {
+                value = -value;
+            }
+            wrapper.exponentialsLeft = wrapper.exponentials.size();
+        }
     } // namespace
 
     std::uint64_t getMasterSeed() {
@@ -178,22 +239,34 @@ namespace random_manager {
         g_threadStreamIndex = index;
     }
 
+    std::optional<std::uint64_t> getThreadMasterSeed() noexcept {
+        return g_threadMasterSeed;
+    }
+
+    // Cached engines compare their seed on every engine() call, so they pick up the change without a version bump
+    void setThreadMasterSeed(const std::optional<std::uint64_t> seed) noexcept {
+        if (seed.has_value()) {
+            g_threadMasterSeed = *seed == 0 ? k_defaultMasterSeed : *seed;
+        } else {
+            g_threadMasterSeed.reset();
+        }
+    }
+
     std::ranlux48& engine(const Stream stream, const std::size_t streamIndex) {
-        ensureMasterSeed();
-        reseedThreadEnginesIfNeeded();
-
-        const StreamKey key{stream, streamIndex};
-        auto [iterator, inserted] = g_threadEngines.try_emplace(key);
-        auto&[engine, seedUsed] = iterator->second;
-        if (const auto seed = finalSeed(stream, streamIndex); inserted || seedUsed != seed) {
-            engine.seed(seed);
-            seedUsed = seed;
+        return engineWrapper(stream, streamIndex).engine;
+    }
+
+    double exponentialVariate(const Stream stream, const std::size_t streamIndex) {
+        auto& wrapper = engineWrapper(stream, streamIndex);
+        if (wrapper.exponentialsLeft == 0) {
+            refillExponentials(wrapper);
         }
-        return engine;
+        return wrapper.exponentials[--wrapper.exponentialsLeft];
     }
 
     void resetCachedEngines() noexcept {
         g_threadEngines.clear();
+        updateThreadEngineMemory();
         g_cachedSeedVersion = std::numeric_limits<std::uint64_t>::max();
         g_threadStreamIndex = 0;
     }
@@ -15,22 +15,30 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <random>
 
 namespace random_manager {
 
+    inline constexpr std::size_t k_exponentialBatchSize = 64; // Variates drawn per exponentialVariate() refill
+
     // Enumerates the independent random-number streams used by each subsystem
     enum class Stream : std::uint32_t {
         Master = 0,
         DiscreteInteractions,
         ThermalVelocities,
         SourceSampling,
-        UserDefined0
+        UserDefined0,
+
+        // Seeds derive from the enumerator value, so streams added later take explicit values clear of the
+        // UserDefined0 + n range and never shift an existing stream's seed
+        OpticalSurfaces = 0x10000
     };
 
     // Returns the current master seed
     //
-    // Lazily initialising it if none has been set yet
+    // The calling thread's override if it has one, otherwise the process-wide seed (lazily initialising it if none has
+    // been set yet)
     [[nodiscard]] std::uint64_t getMasterSeed();
 
     // Returns the effective seed for a stream
@@ -41,6 +49,9 @@ namespace random_manager {
     // Returns the current thread-local stream index override
     [[nodiscard]] std::size_t getThreadStreamIndex() noexcept;
 
+    // Returns the calling thread's master seed override, if any
+    [[nodiscard]] std::optional<std::uint64_t> getThreadMasterSeed() noexcept;
+
     // Sets the master seed
     //
     // Passing zero falls back to a deterministic constant
@@ -54,6 +65,37 @@ namespace random_manager {
     // Sets the default stream index used by this thread when the index parameter is omitted
     void setThreadStreamIndex(std::size_t index) noexcept;
 
+    // Sets a master seed for the calling thread only, in place of the process-wide one; std::nullopt removes it
+    //
+    // Lets threads of concurrent simulations draw from independently seeded streams. Stream overrides set with
+    // setStreamSeed() stay process-wide and take precedence. Passing zero falls back to a deterministic constant
+    void setThreadMasterSeed(std::optional<std::uint64_t> seed) noexcept;
+
+    // Installs a thread master seed for its lifetime and restores the previous one on destruction; does nothing for
+    // std::nullopt
+    class ScopedThreadMasterSeed {
+        public:
+            explicit ScopedThreadMasterSeed(const std::optional<std::uint64_t> seed) noexcept
+                : m_previous(getThreadMasterSeed()), m_active(seed.has_value()) {
+                if (this->m_active) {
+                    setThreadMasterSeed(seed);
+                }
+            }
+
+            ~ScopedThreadMasterSeed() {
+                if (this->m_active) {
+                    setThreadMasterSeed(this->m_previous);
+                }
+            }
+
+            ScopedThreadMasterSeed(const ScopedThreadMasterSeed&) = delete;
+            ScopedThreadMasterSeed& operator=(const ScopedThreadMasterSeed&) = delete;
+
+        private:
+            std::optional<std::uint64_t> m_previous;
+            bool m_active;
+    };
+
     // Provides the thread-local RNG engine for the given stream/index pair
     [[nodiscard]] std::ranlux48& engine(Stream stream, std::size_t streamIndex);
 
@@ -62,6 +104,18 @@ namespace random_manager {
         return engine(stream, getThreadStreamIndex());
     }
 
+    // Returns a unit-mean exponential variate -log(u) from the thread-local engine for the given stream/index pair
+    //
+    // The engine keeps a batch of k_exponentialBatchSize variates, drawn together and passed through one
+    // vector_math::log() batch, and refills it when empty; the batch is discarded whenever the engine is reseeded, so
+    // results stay reproducible for a given seed. Draws interleave with engine() users of the same stream in batches
+    [[nodiscard]] double exponentialVariate(Stream stream, std::size_t streamIndex);
+
+    // Convenience overload that uses the thread-local index override
+    [[nodiscard]] inline double exponentialVariate(Stream stream) {
+        return exponentialVariate(stream, getThreadStreamIndex());
+    }
+
     // Clears cached thread-local engines so new seeds take effect on the next use
     void resetCachedEngines() noexcept;
 } // namespace random_manager
@@ -0,0 +1,97 @@
+//
+// Physics Simulation Program
+// File: allocation_tracking.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of allocation_tracking.h
+//   - Replaces the global operator new/delete family when SIMULATION_TRACK_ALLOCATIONS is defined; the replacements
+//     live in this translation unit so they are linked whenever threadCounts() is used
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/tracing/allocation_tracking.h"
+
+#ifdef SIMULATION_TRACK_ALLOCATIONS
+    #include <cstdlib>
+    #include <new>
+#endif
+
+namespace allocation_tracking {
+    namespace {
+        constinit thread_local AllocationCounts t_counts{};
+    } // namespace
+
+    AllocationCounts threadCounts() noexcept {
+        return t_counts;
+    }
+
+#ifdef SIMULATION_TRACK_ALLOCATIONS
+    namespace {
+        void* allocate(std::size_t size, const std::size_t alignment) noexcept {
+            size = size == 0 ? 1 : size;
+            void* pointer = nullptr;
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                pointer = std::malloc(size);
+            } else if (posix_memalign(&pointer, alignment, size) != 0) {
+                pointer = nullptr;
+            }
+            if (pointer != nullptr) {
+                ++t_counts.allocations;
+                t_counts.bytes += size;
+            }
+            return pointer;
+        }
+
+        void* allocateOrThrow(const std::size_t size, const std::size_t alignment) {
+            while (true) {
+                if (void* pointer = allocate(size, alignment)) {
+                    return pointer;
+                }
+                const auto handler = std::get_new_handler();
+                if (handler == nullptr) {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+
+        void release(void* pointer) noexcept {
+            if (pointer != nullptr) {
+                ++t_counts.deallocations;
+                std::free(pointer);
+            }
+        }
+    } // namespace
+#endif
+} // namespace allocation_tracking
+
+#ifdef SIMULATION_TRACK_ALLOCATIONS
+using allocation_tracking::allocateOrThrow;
+using allocation_tracking::allocate;
+using allocation_tracking::release;
+
+void* operator new(const std::size_t size) { return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](const std::size_t size) { return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(const std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](const std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<std::size_t>(alignment)); }
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(const std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](const std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { release(pointer); }
+void operator delete[](void* pointer) noexcept { release(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { release(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { release(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { release(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { release(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { release(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { release(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { release(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { release(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { release(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { release(pointer); }
+#endif
@@ -0,0 +1,82 @@
+//
+// Physics Simulation Program
+// File: allocation_tracking.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Provides per-thread heap allocation counters fed by global operator new/delete hooks
+//   - Scoped regions report the allocations made on the calling thread while they were alive
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_ALLOCATION_TRACKING_H
+#define PHYSICS_SIMULATION_PROGRAM_ALLOCATION_TRACKING_H
+
+#include <cstdint>
+
+// allocation_tracking
+//
+// Notes on initialisation:
+//   - The replacement operator new/delete are only compiled when SIMULATION_TRACK_ALLOCATIONS is defined (CMake option
+//     of the same name); otherwise every count reads zero and enabled() is false
+//   - Counters are thread-local and constant-initialised so they are safe to touch from inside operator new, including
+//     during thread start-up and shutdown
+//
+// Notes on algorithms:
+//   - Each hook increments a thread-local count (no atomics or locks) and forwards to malloc/free
+//   - AllocationScope snapshots the calling thread's counters on construction; counts() is the difference, so scopes
+//     nest and only see work done on their own thread
+//
+// Supported overloads / operations and functions / methods:
+//   - Availability:           enabled()
+//   - Thread totals:          threadCounts()
+//   - Scoped regions:         AllocationScope::counts()
+//
+// Example usage:
+//   const allocation_tracking::AllocationScope scope;
+//   stepParticle(...);
+//   if (scope.counts().allocations != 0) { ... }
+namespace allocation_tracking {
+    struct AllocationCounts {
+        std::uint64_t allocations = 0;   // Calls to operator new (all forms)
+        std::uint64_t deallocations = 0; // Calls to operator delete with a non-null pointer
+        std::uint64_t bytes = 0;         // Bytes requested from operator new
+
+        [[nodiscard]] constexpr AllocationCounts operator-(const AllocationCounts& other) const noexcept {
+            return {
+                this->allocations - other.allocations,
+                this->deallocations - other.deallocations,
+                this->bytes - other.bytes
+            };
+        }
+    };
+
+    // True when the hooks are compiled in
+    [[nodiscard]] constexpr bool enabled() noexcept {
+#ifdef SIMULATION_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Cumulative counts for the calling thread
+    [[nodiscard]] AllocationCounts threadCounts() noexcept;
+
+    // AllocationScope
+    //
+    // Allocations made on the calling thread since construction
+    class AllocationScope {
+        public:
+            AllocationScope() noexcept : m_start(threadCounts()) {}
+
+            [[nodiscard]] AllocationCounts counts() const noexcept { return threadCounts() - this->m_start; }
+
+        private:
+            AllocationCounts m_start;
+    };
+} // namespace allocation_tracking
+
+#endif //PHYSICS_SIMULATION_PROGRAM_ALLOCATION_TRACKING_H
@@ -0,0 +1,126 @@
+//
+// Physics Simulation Program
+// File: lock_profiling.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of lock_profiling.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/tracing/lock_profiling.h"
+
+#include <algorithm>
+#include <format>
+#include <memory>
+
+namespace lock_profiling {
+    namespace {
+        // Function-local statics so locks defined at namespace scope in other translation units can register during
+        // static initialisation
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<LockCounters>> locks; // Never freed; wrappers hold raw pointers
+        };
+
+        Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        double milliseconds(const std::uint64_t nanoseconds) {
+            return static_cast<double>(nanoseconds) * 1e-6;
+        }
+
+        double microseconds(const std::uint64_t nanoseconds) {
+            return static_cast<double>(nanoseconds) * 1e-3;
+        }
+    } // namespace
+
+    LockCounters& registerLock(const std::string_view name) {
+        auto& [mutex, locks] = registry();
+        std::scoped_lock lock(mutex);
+        for (const auto& counters : locks) {
+            if (counters->name == name) {
+                return *counters;
+            }
+        }
+        auto& counters = locks.emplace_back(std::make_unique<LockCounters>());
+        counters->name = std::string(name);
+        return *counters;
+    }
+
+    std::vector<LockReport> snapshot() {
+        std::vector<LockReport> reports;
+        {
+            auto& [mutex, locks] = registry();
+            std::scoped_lock lock(mutex);
+            reports.reserve(locks.size());
+            for (const auto& counters : locks) {
+                reports.push_back({
+                    counters->name,
+                    counters->acquisitions.load(std::memory_order_relaxed),
+                    counters->contentions.load(std::memory_order_relaxed),
+                    counters->waitNanoseconds.load(std::memory_order_relaxed),
+                    counters->maxWaitNanoseconds.load(std::memory_order_relaxed),
+                    counters->holdNanoseconds.load(std::memory_order_relaxed),
+                    counters->maxHoldNanoseconds.load(std::memory_order_relaxed),
+                    counters->sharedAcquisitions.load(std::memory_order_relaxed),
+                    counters->sharedContentions.load(std::memory_order_relaxed),
+                    counters->sharedWaitNanoseconds.load(std::memory_order_relaxed)
+                });
+            }
+        }
+        std::ranges::stable_sort(reports, std::ranges::greater{}, &LockReport::totalWaitNanoseconds);
+        return reports;
+    }
+
+    void reset() {
+        auto& [mutex, locks] = registry();
+        std::scoped_lock lock(mutex);
+        for (const auto& counters : locks) {
+            for (auto* counter : {
+                &counters->acquisitions, &counters->contentions, &counters->waitNanoseconds,
+                &counters->maxWaitNanoseconds, &counters->holdNanoseconds, &counters->maxHoldNanoseconds,
+                &counters->sharedAcquisitions, &counters->sharedContentions, &counters->sharedWaitNanoseconds
+            }) {
+                counter->store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void printReport(std::ostream& stream) {
+        if constexpr (!enabled()) {
+            stream << "Lock profiling not compiled in (configure with SIMULATION_PROFILE_LOCKS=ON)\n";
+            return;
+        }
+
+        stream << std::format(
+            "{:<22} {:>12} {:>12} {:>10} {:>12} {:>12} {:>12} {:>12} {:>12} {:>14}\n",
+            "lock", "acquired", "contended", "rate", "wait ms", "max wait us", "hold ms", "mean hold us", "shared", "shared wait ms"
+        );
+        for (const auto& report : snapshot()) {
+            const auto contendedPercent = report.acquisitions > 0
+                ? 100.0 * static_cast<double>(report.contentions) / static_cast<double>(report.acquisitions)
+                : 0.0;
+            const auto meanHold = report.acquisitions > 0
+                ? microseconds(report.holdNanoseconds) / static_cast<double>(report.acquisitions)
+                : 0.0;
+            stream << std::format(
+                "{:<22} {:>12} {:>12} {:>9.3f}% {:>12.3f} {:>12.1f} {:>12.3f} {:>12.3f} {:>12} {:>14.3f}\n",
+                report.name,
+                report.acquisitions,
+                report.contentions,
+                contendedPercent,
+                milliseconds(report.waitNanoseconds),
+                microseconds(report.maxWaitNanoseconds),
+                milliseconds(report.holdNanoseconds),
+                meanHold,
+                report.sharedAcquisitions,
+                milliseconds(report.sharedWaitNanoseconds)
+            );
+        }
+    }
+} // namespace lock_profiling
@@ -0,0 +1,214 @@
+//
+// Physics Simulation Program
+// File: lock_profiling.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Provides mutex wrappers that record wait time, hold time and contention per named lock
+//   - Totals are aggregated by name and reported at the end of a run
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_LOCK_PROFILING_H
+#define PHYSICS_SIMULATION_PROGRAM_LOCK_PROFILING_H
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/tracing/tracing.h"
+
+// lock_profiling
+//
+// Notes on initialisation:
+//   - Timing is only compiled in when SIMULATION_PROFILE_LOCKS is defined (CMake option of the same name); otherwise the
+//     wrappers forward straight to the underlying mutex and every report is empty
+//   - Each wrapper registers its name on construction; wrappers sharing a name (e.g. one per detector) share counters
+//
+// Notes on algorithms:
+//   - lock() first tries the mutex; only if that fails is the acquisition counted as contended and the blocking wait
+//     timed, so uncontended locks cost one clock read on acquire and one on release
+//   - Hold time is measured for exclusive ownership only; shared owners overlap so only their waits are recorded
+//   - Counters are relaxed atomics; reports taken while stepping are approximate but never torn per field
+//
+// Notes on output:
+//   - snapshot() returns one entry per name sorted by total wait time (largest first), which is the order in which the
+//     locks limit scaling
+//
+// Supported overloads / operations and functions / methods:
+//   - Wrappers:               ProfiledMutex, ProfiledSharedMutex (usable with std::scoped_lock/unique_lock/shared_lock)
+//   - Availability:           enabled()
+//   - Output:                 snapshot(), printReport()
+//   - Reset:                  reset()
+//
+// Example usage:
+//   lock_profiling::ProfiledMutex g_clockMutex{"simulation_clock"};
+//   std::scoped_lock lock(g_clockMutex);
+//   ...
+//   lock_profiling::printReport(std::cout);
+namespace lock_profiling {
+    // Live counters for one lock name
+    struct LockCounters {
+        std::string name;
+        std::atomic<std::uint64_t> acquisitions{0};          // Exclusive acquisitions
+        std::atomic<std::uint64_t> contentions{0};           // Exclusive acquisitions that had to wait
+        std::atomic<std::uint64_t> waitNanoseconds{0};
+        std::atomic<std::uint64_t> maxWaitNanoseconds{0};
+        std::atomic<std::uint64_t> holdNanoseconds{0};
+        std::atomic<std::uint64_t> maxHoldNanoseconds{0};
+        std::atomic<std::uint64_t> sharedAcquisitions{0};
+        std::atomic<std::uint64_t> sharedContentions{0};
+        std::atomic<std::uint64_t> sharedWaitNanoseconds{0};
+    };
+
+    // Plain copy of LockCounters for reporting
+    struct LockReport {
+        std::string name;
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contentions = 0;
+        std::uint64_t waitNanoseconds = 0;
+        std::uint64_t maxWaitNanoseconds = 0;
+        std::uint64_t holdNanoseconds = 0;
+        std::uint64_t maxHoldNanoseconds = 0;
+        std::uint64_t sharedAcquisitions = 0;
+        std::uint64_t sharedContentions = 0;
+        std::uint64_t sharedWaitNanoseconds = 0;
+
+        [[nodiscard]] std::uint64_t totalWaitNanoseconds() const noexcept { return this->waitNanoseconds + this->sharedWaitNanoseconds; }
+    };
+
+    // True when the timing is compiled in
+    [[nodiscard]] constexpr bool enabled() noexcept {
+#ifdef SIMULATION_PROFILE_LOCKS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Counters for name, created on first use; the reference stays valid for the lifetime of the program
+    [[nodiscard]] LockCounters& registerLock(std::string_view name);
+
+    // Current totals for every registered name, sorted by total wait time
+    [[nodiscard]] std::vector<LockReport> snapshot();
+
+    // Zero every counter (names stay registered)
+    void reset();
+
+    // Table of snapshot() with contention rate, total and maximum wait, and total and mean hold per lock
+    void printReport(std::ostream& stream);
+
+    namespace detail {
+        inline void add(std::atomic<std::uint64_t>& counter, const std::int64_t nanoseconds) noexcept {
+            counter.fetch_add(static_cast<std::uint64_t>(nanoseconds), std::memory_order_relaxed);
+        }
+
+        inline void updateMaximum(std::atomic<std::uint64_t>& maximum, const std::int64_t nanoseconds) noexcept {
+            const auto value = static_cast<std::uint64_t>(nanoseconds);
+            auto current = maximum.load(std::memory_order_relaxed);
+            while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+    } // namespace detail
+
+    // BasicProfiledMutex
+    //
+    // Meets the Lockable (and, for std::shared_mutex, SharedLockable) requirements of the wrapped mutex
+    template<typename Mutex>
+    class BasicProfiledMutex {
+        public:
+            explicit BasicProfiledMutex(const std::string_view name) : m_counters(&registerLock(name)) {}
+
+            BasicProfiledMutex(const BasicProfiledMutex&) = delete;
+            BasicProfiledMutex& operator=(const BasicProfiledMutex&) = delete;
+
+            // Exclusive ownership methods
+            void lock() {
+                if constexpr (enabled()) {
+                    if (!this->m_mutex.try_lock()) {
+                        const auto waitStart = tracing::now();
+                        this->m_mutex.lock();
+                        this->m_acquiredAt = tracing::now();
+                        this->recordContention(this->m_acquiredAt - waitStart);
+                    } else {
+                        this->m_acquiredAt = tracing::now();
+                    }
+                    this->m_counters->acquisitions.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    this->m_mutex.lock();
+                }
+            }
+
+            bool try_lock() {
+                if (!this->m_mutex.try_lock()) {
+                    return false;
+                }
+                if constexpr (enabled()) {
+                    this->m_acquiredAt = tracing::now();
+                    this->m_counters->acquisitions.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+
+            void unlock() {
+                if constexpr (enabled()) {
+                    const auto held = tracing::now() - this->m_acquiredAt;
+                    detail::add(this->m_counters->holdNanoseconds, held);
+                    detail::updateMaximum(this->m_counters->maxHoldNanoseconds, held);
+                }
+                this->m_mutex.unlock();
+            }
+
+            // Shared ownership methods
+            void lock_shared() requires std::same_as<Mutex, std::shared_mutex> {
+                if constexpr (enabled()) {
+                    if (!this->m_mutex.try_lock_shared()) {
+                        const auto waitStart = tracing::now();
+                        this->m_mutex.lock_shared();
+                        this->m_counters->sharedContentions.fetch_add(1, std::memory_order_relaxed);
+                        detail::add(this->m_counters->sharedWaitNanoseconds, tracing::now() - waitStart);
+                    }
+                    this->m_counters->sharedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    this->m_mutex.lock_shared();
+                }
+            }
+
+            bool try_lock_shared() requires std::same_as<Mutex, std::shared_mutex> {
+                if (!this->m_mutex.try_lock_shared()) {
+                    return false;
+                }
+                if constexpr (enabled()) {
+                    this->m_counters->sharedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+
+            void unlock_shared() requires std::same_as<Mutex, std::shared_mutex> {
+                this->m_mutex.unlock_shared();
+            }
+
+        private:
+            void recordContention(const std::int64_t waited) noexcept {
+                this->m_counters->contentions.fetch_add(1, std::memory_order_relaxed);
+                detail::add(this->m_counters->waitNanoseconds, waited);
+                detail::updateMaximum(this->m_counters->maxWaitNanoseconds, waited);
+            }
+
+            Mutex m_mutex;
+            LockCounters* m_counters;
+            std::int64_t m_acquiredAt = 0; // Written and read only by the exclusive owner
+    };
+
+    using ProfiledMutex = BasicProfiledMutex<std::mutex>;
+    using ProfiledSharedMutex = BasicProfiledMutex<std::shared_mutex>;
+} // namespace lock_profiling
+
+#endif //PHYSICS_SIMULATION_PROGRAM_LOCK_PROFILING_H
@@ -0,0 +1,122 @@
+//
+// Physics Simulation Program
+// File: memory_accounting.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of memory_accounting.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/tracing/memory_accounting.h"
+
+#include <atomic>
+#include <format>
+
+namespace memory_accounting {
+    namespace {
+        // One cache line per category so threads reporting different subsystems do not share lines
+        struct alignas(64) Slot {
+            std::atomic<std::uint64_t> bytes{0};
+            std::atomic<std::uint64_t> peakBytes{0};
+            std::atomic<std::uint64_t> objects{0};
+            std::atomic<std::uint64_t> peakObjects{0};
+        };
+
+        constinit std::array<Slot, k_categoryCount> g_slots{};
+        constinit Slot g_total{};
+
+        void updatePeak(std::atomic<std::uint64_t>& peak, const std::uint64_t value) noexcept {
+            auto current = peak.load(std::memory_order_relaxed);
+            while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        double mebibytes(const std::uint64_t bytes) {
+            return static_cast<double>(bytes) / (1024.0 * 1024.0);
+        }
+    } // namespace
+
+    std::string_view categoryName(const Category category) noexcept {
+        switch (category) {
+            case Category::Particles:       return "particles";
+            case Category::HyperfineLevels: return "hyperfine_levels";
+            case Category::SpawnBuffers:    return "spawn_buffers";
+            case Category::Databases:       return "databases";
+            case Category::DetectorStreams: return "detector_streams";
+            case Category::RandomEngines:   return "random_engines";
+            case Category::SpillPages:      return "spill_pages";
+            default:                        return "unknown";
+        }
+    }
+
+    void add(const Category category, const std::size_t bytes, const std::size_t objects) noexcept {
+        auto& slot = g_slots[static_cast<std::size_t>(category)];
+        updatePeak(slot.peakBytes, slot.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+        if (objects > 0) {
+            updatePeak(slot.peakObjects, slot.objects.fetch_add(objects, std::memory_order_relaxed) + objects);
+        }
+        updatePeak(g_total.peakBytes, g_total.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    }
+
+    void remove(const Category category, const std::size_t bytes, const std::size_t objects) noexcept {
+        auto& slot = g_slots[static_cast<std::size_t>(category)];
+        slot.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        if (objects > 0) {
+            slot.objects.fetch_sub(objects, std::memory_order_relaxed);
+        }
+        g_total.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    MemoryReport memoryReport() noexcept {
+        MemoryReport report;
+        for (std::size_t i = 0; i < k_categoryCount; ++i) {
+            const auto& slot = g_slots[i];
+            report.categories[i] = {
+                slot.bytes.load(std::memory_order_relaxed),
+                slot.peakBytes.load(std::memory_order_relaxed),
+                slot.objects.load(std::memory_order_relaxed),
+                slot.peakObjects.load(std::memory_order_relaxed)
+            };
+        }
+        report.currentBytes = g_total.bytes.load(std::memory_order_relaxed);
+        report.peakBytes = g_total.peakBytes.load(std::memory_order_relaxed);
+        return report;
+    }
+
+    void resetPeaks() noexcept {
+        for (auto& slot : g_slots) {
+            slot.peakBytes.store(slot.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            slot.peakObjects.store(slot.objects.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        g_total.peakBytes.store(g_total.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    void printMemoryReport(std::ostream& stream) {
+        const auto report = memoryReport();
+        stream << std::format(
+            "{:<18} {:>14} {:>14} {:>14} {:>16}\n",
+            "category", "current MiB", "peak MiB", "peak objects", "bytes/object"
+        );
+        for (std::size_t i = 0; i < k_categoryCount; ++i) {
+            const auto& usage = report.categories[i];
+            stream << std::format(
+                "{:<18} {:>14.3f} {:>14.3f} {:>14} {:>16}\n",
+                categoryName(static_cast<Category>(i)),
+                mebibytes(usage.currentBytes),
+                mebibytes(usage.peakBytes),
+                usage.peakObjects > 0 ? std::format("{}", usage.peakObjects) : "-",
+                usage.peakObjects > 0
+                    ? std::format("{:.1f}", static_cast<double>(usage.peakBytes) / static_cast<double>(usage.peakObjects))
+                    : "-"
+            );
+        }
+        stream << std::format(
+            "{:<18} {:>14.3f} {:>14.3f}\n",
+            "total",
+            mebibytes(report.currentBytes),
+            mebibytes(report.peakBytes)
+        );
+    }
+} // namespace memory_accounting
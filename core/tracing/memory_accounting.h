@@ -0,0 +1,163 @@
+//
+// Physics Simulation Program
+// File: memory_accounting.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Provides per-subsystem accounting of heap memory with current and peak usage per category
+//   - Subsystems report their own footprint through hooks so the breakdown works without replacing operator new
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_MEMORY_ACCOUNTING_H
+#define PHYSICS_SIMULATION_PROGRAM_MEMORY_ACCOUNTING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <utility>
+
+// memory_accounting
+//
+// Notes on initialisation:
+//   - Always compiled in; every hook is a relaxed atomic add on a per-category cache line plus a compare against the
+//     category peak, so it is cheap enough to leave on in production runs
+//   - Counters are constant-initialised, so objects with static storage may report from their constructors
+//
+// Notes on algorithms:
+//   - Particles are counted exactly through class-specific operator new/delete on Particle, which receive the size of
+//     the most derived type; the owning pointer vector in ParticleManager is counted by capacity
+//   - Containers are counted by capacity times element size (plus owned strings for databases); detector streams are
+//     counted as the stream object plus its BUFSIZ write buffer; hash maps as nodes plus buckets, so these are
+//     estimates that ignore allocator headers
+//   - TrackedBytes is an RAII record owned by the subsystem: resize() reports the new footprint and destruction
+//     returns it, so thread_local owners (RNG maps, one per stepAll worker) release their share when the thread exits
+//   - Peaks are per category and for the total of all categories at any instant; the category peaks need not occur
+//     at the same time, so their sum can exceed the total peak
+//
+// Supported overloads / operations and functions / methods:
+//   - Hooks:                  add(), remove(), TrackedBytes
+//   - Output:                 memoryReport(), printMemoryReport()
+//   - Reset:                  resetPeaks()
+//
+// Example usage:
+//   memory_accounting::TrackedBytes memory{memory_accounting::Category::Databases};
+//   memory.resize(entries.capacity() * sizeof(Entry));
+//   ...
+//   memory_accounting::printMemoryReport(std::cout);
+namespace memory_accounting {
+    enum class Category : std::uint8_t {
+        Particles = 0,   // Particle objects and the ParticleManager pointer vector
+        HyperfineLevels, // Per-atom hyperfine level vectors
+        SpawnBuffers,    // Per-worker secondary queues and the spawn processing vectors in stepAll
+        Databases,       // Loaded material and particle database entries
+        DetectorStreams, // Open detector output streams and their buffers
+        RandomEngines,   // Thread-local random engine maps
+        SpillPages,      // Page buffer of the particle spill I/O thread
+        Count
+    };
+
+    inline constexpr std::size_t k_categoryCount = static_cast<std::size_t>(Category::Count);
+
+    [[nodiscard]] std::string_view categoryName(Category category) noexcept;
+
+    struct CategoryUsage {
+        std::uint64_t currentBytes = 0;
+        std::uint64_t peakBytes = 0;
+        std::uint64_t currentObjects = 0; // Hooks that report a count (particles, streams, engines)
+        std::uint64_t peakObjects = 0;
+    };
+
+    struct MemoryReport {
+        std::array<CategoryUsage, k_categoryCount> categories{};
+        std::uint64_t currentBytes = 0; // Sum over categories
+        std::uint64_t peakBytes = 0;    // Highest simultaneous sum since the last resetPeaks()
+
+        [[nodiscard]] const CategoryUsage& operator[](Category category) const noexcept {
+            return this->categories[static_cast<std::size_t>(category)];
+        }
+    };
+
+    // Hooks
+    //
+    // objects is the number of items the bytes belong to (0 if not meaningful for the category)
+    void add(Category category, std::size_t bytes, std::size_t objects = 0) noexcept;
+    void remove(Category category, std::size_t bytes, std::size_t objects = 0) noexcept;
+
+    // Current and peak usage for every category
+    [[nodiscard]] MemoryReport memoryReport() noexcept;
+
+    // Restart peak tracking from the current usage (e.g. between benchmark scenarios)
+    void resetPeaks() noexcept;
+
+    // Table of memoryReport() with bytes per object where objects are counted
+    void printMemoryReport(std::ostream& stream);
+
+    // TrackedBytes
+    //
+    // Bytes (and optionally objects) attributed to a category for the lifetime of the owner
+    class TrackedBytes {
+        public:
+            explicit TrackedBytes(const Category category) noexcept : m_category(category) {}
+
+            TrackedBytes(const TrackedBytes& other) noexcept : m_category(other.m_category) {
+                this->resize(other.m_bytes, other.m_objects);
+            }
+
+            TrackedBytes(TrackedBytes&& other) noexcept :
+                m_category(other.m_category),
+                m_bytes(other.m_bytes),
+                m_objects(other.m_objects) {
+                other.m_bytes = 0;
+                other.m_objects = 0;
+            }
+
+            TrackedBytes& operator=(const TrackedBytes& other) noexcept {
+                if (this != &other) {
+                    this->resize(0);
+                    this->m_category = other.m_category;
+                    this->resize(other.m_bytes, other.m_objects);
+                }
+                return *this;
+            }
+
+            TrackedBytes& operator=(TrackedBytes&& other) noexcept {
+                if (this != &other) {
+                    this->resize(0);
+                    this->m_category = other.m_category;
+                    std::swap(this->m_bytes, other.m_bytes);
+                    std::swap(this->m_objects, other.m_objects);
+                }
+                return *this;
+            }
+
+            ~TrackedBytes() { this->resize(0); }
+
+            // Report the owner's new footprint; only the difference is applied
+            void resize(const std::size_t bytes, const std::size_t objects = 0) noexcept {
+                if (bytes > this->m_bytes || objects > this->m_objects) {
+                    add(this->m_category, bytes > this->m_bytes ? bytes - this->m_bytes : 0,
+                        objects > this->m_objects ? objects - this->m_objects : 0);
+                }
+                if (bytes < this->m_bytes || objects < this->m_objects) {
+                    remove(this->m_category, bytes < this->m_bytes ? this->m_bytes - bytes : 0,
+                           objects < this->m_objects ? this->m_objects - objects : 0);
+                }
+                this->m_bytes = bytes;
+                this->m_objects = objects;
+            }
+
+            [[nodiscard]] std::size_t bytes() const noexcept { return this->m_bytes; }
+
+        private:
+            Category m_category;
+            std::size_t m_bytes = 0;
+            std::size_t m_objects = 0;
+    };
+} // namespace memory_accounting
+
+#endif //PHYSICS_SIMULATION_PROGRAM_MEMORY_ACCOUNTING_H
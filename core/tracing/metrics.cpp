@@ -0,0 +1,276 @@
+//
+// Physics Simulation Program
+// File: metrics.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of metrics.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/tracing/metrics.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "core/tracing/memory_accounting.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace metrics {
+    namespace {
+        constexpr int k_pollIntervalMilliseconds = 200; // How quickly the server notices it is being stopped
+        constexpr std::size_t k_maxRequestBytes = 4096;
+
+        // Function-local statics so metrics defined in other translation units can register during static
+        // initialisation
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<Metric>> metrics; // Never freed; callers hold references
+        };
+
+        Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        bool validName(const std::string_view name) noexcept {
+            if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front()))) {
+                return false;
+            }
+            return std::ranges::all_of(name, [](const unsigned char ch) {
+                return std::isalnum(ch) || ch == '_' || ch == ':';
+            });
+        }
+
+        std::string_view typeName(const Type type) noexcept {
+            return type == Type::Counter ? "counter" : "gauge";
+        }
+
+        void appendSeries(std::string& output, const std::string_view name, const std::string_view labels, const double value) {
+            if (labels.empty()) {
+                output += std::format("{} {}\n", name, value);
+            } else {
+                output += std::format("{}{{{}}} {}\n", name, labels, value);
+            }
+        }
+
+        void appendMemory(std::string& output) {
+            const auto report = memory_accounting::memoryReport();
+            output += "# HELP simulation_memory_bytes Heap bytes currently attributed to each subsystem\n"
+                      "# TYPE simulation_memory_bytes gauge\n";
+            for (std::size_t i = 0; i < memory_accounting::k_categoryCount; ++i) {
+                const auto category = memory_accounting::categoryName(static_cast<memory_accounting::Category>(i));
+                appendSeries(output, "simulation_memory_bytes", label("subsystem", category),
+                             static_cast<double>(report.categories[i].currentBytes));
+            }
+            output += "# HELP simulation_memory_peak_bytes Highest heap bytes attributed to each subsystem\n"
+                      "# TYPE simulation_memory_peak_bytes gauge\n";
+            for (std::size_t i = 0; i < memory_accounting::k_categoryCount; ++i) {
+                const auto category = memory_accounting::categoryName(static_cast<memory_accounting::Category>(i));
+                appendSeries(output, "simulation_memory_peak_bytes", label("subsystem", category),
+                             static_cast<double>(report.categories[i].peakBytes));
+            }
+            output += "# HELP simulation_memory_total_peak_bytes Highest simultaneous total of tracked heap bytes\n"
+                      "# TYPE simulation_memory_total_peak_bytes gauge\n";
+            appendSeries(output, "simulation_memory_total_peak_bytes", {}, static_cast<double>(report.peakBytes));
+        }
+
+#if defined(__unix__) || defined(__APPLE__)
+    #ifdef MSG_NOSIGNAL
+        constexpr int k_sendFlags = MSG_NOSIGNAL; // Report a closed connection as an error instead of raising SIGPIPE
+    #else
+        constexpr int k_sendFlags = 0;
+    #endif
+
+        void sendAll(const int connection, const std::string_view data) noexcept {
+            std::size_t sent = 0;
+            while (sent < data.size()) {
+                const auto written = send(connection, data.data() + sent, data.size() - sent, k_sendFlags);
+                if (written <= 0) {
+                    return;
+                }
+                sent += static_cast<std::size_t>(written);
+            }
+        }
+
+        // Read until the end of the request headers (the body of a GET is ignored)
+        std::string readRequest(const int connection) {
+            std::string request;
+            std::array<char, 1024> buffer{};
+            while (request.size() < k_maxRequestBytes && request.find("\r\n\r\n") == std::string::npos) {
+                pollfd descriptor{connection, POLLIN, 0};
+                if (poll(&descriptor, 1, 1000) <= 0) {
+                    break;
+                }
+                const auto received = recv(connection, buffer.data(), buffer.size(), 0);
+                if (received <= 0) {
+                    break;
+                }
+                request.append(buffer.data(), static_cast<std::size_t>(received));
+            }
+            return request;
+        }
+
+        std::string response(const std::string_view status, const std::string_view contentType, const std::string_view body) {
+            return std::format(
+                "HTTP/1.1 {}\r\nContent-Type: {}\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                status,
+                contentType,
+                body.size(),
+                body
+            );
+        }
+#endif
+    } // namespace
+
+    Metric& metric(const std::string_view name, const std::string_view help, const Type type, const std::string_view labels) {
+        if (!validName(name)) {
+            throw std::invalid_argument(std::format("Invalid metric name '{}'", name));
+        }
+
+        auto& metricRegistry = registry();
+        std::scoped_lock lock(metricRegistry.mutex);
+        for (const auto& existing : metricRegistry.metrics) {
+            if (existing->name() != name) {
+                continue;
+            }
+            if (existing->type() != type) {
+                throw std::invalid_argument(std::format(
+                    "Metric '{}' was registered as a {}",
+                    name,
+                    typeName(existing->type())
+                ));
+            }
+            if (existing->labels() == labels) {
+                return *existing;
+            }
+        }
+        metricRegistry.metrics.push_back(
+            std::make_unique<Metric>(std::string(name), std::string(help), type, std::string(labels))
+        );
+        return *metricRegistry.metrics.back();
+    }
+
+    std::string label(const std::string_view key, const std::string_view value) {
+        std::string result = std::format("{}=\"", key);
+        for (const char ch : value) {
+            switch (ch) {
+                case '\\': result += "\\\\"; break;
+                case '"':  result += "\\\""; break;
+                case '\n': result += "\\n";  break;
+                default:   result += ch;
+            }
+        }
+        result += '"';
+        return result;
+    }
+
+    std::string render() {
+        std::vector<const Metric*> sorted;
+        {
+            auto& metricRegistry = registry();
+            std::scoped_lock lock(metricRegistry.mutex);
+            sorted.reserve(metricRegistry.metrics.size());
+            for (const auto& entry : metricRegistry.metrics) {
+                sorted.push_back(entry.get());
+            }
+        }
+        std::ranges::stable_sort(sorted, {}, &Metric::name);
+
+        std::string output;
+        std::string_view previousName;
+        for (const auto* entry : sorted) {
+            if (entry->name() != previousName) {
+                output += std::format("# HELP {} {}\n# TYPE {} {}\n", entry->name(), entry->help(), entry->name(), typeName(entry->type()));
+                previousName = entry->name();
+            }
+            appendSeries(output, entry->name(), entry->labels(), entry->value());
+        }
+        appendMemory(output);
+        return output;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    MetricsServer::MetricsServer(const std::uint16_t port) {
+        this->m_socket = socket(AF_INET, SOCK_STREAM, 0);
+        if (this->m_socket < 0) {
+            throw std::runtime_error(std::format("Failed to create metrics socket: {}", std::strerror(errno)));
+        }
+
+        constexpr int reuse = 1;
+        setsockopt(this->m_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        if (bind(this->m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+            || listen(this->m_socket, 8) < 0) {
+            const int error = errno;
+            close(this->m_socket);
+            throw std::runtime_error(std::format("Failed to listen for metrics on 127.0.0.1:{}: {}", port, std::strerror(error)));
+        }
+
+        socklen_t length = sizeof(address);
+        getsockname(this->m_socket, reinterpret_cast<sockaddr*>(&address), &length);
+        this->m_port = ntohs(address.sin_port);
+
+        this->m_thread = std::thread([this] { this->serve(); });
+    }
+
+    MetricsServer::~MetricsServer() {
+        this->m_running.store(false, std::memory_order_relaxed);
+        if (this->m_thread.joinable()) {
+            this->m_thread.join();
+        }
+        close(this->m_socket);
+    }
+
+    void MetricsServer::serve() const {
+        while (this->m_running.load(std::memory_order_relaxed)) {
+            pollfd descriptor{this->m_socket, POLLIN, 0};
+            if (poll(&descriptor, 1, k_pollIntervalMilliseconds) <= 0) {
+                continue;
+            }
+            const int connection = accept(this->m_socket, nullptr, nullptr);
+            if (connection < 0) {
+                continue;
+            }
+
+            const auto request = readRequest(connection);
+            const auto target = std::string_view(request).substr(0, request.find("\r\n"));
+            if (target.starts_with("GET /metrics ") || target.starts_with("GET /metrics?")) {
+                sendAll(connection, response("200 OK", "text/plain; version=0.0.4; charset=utf-8", render()));
+            } else {
+                sendAll(connection, response("404 Not Found", "text/plain; charset=utf-8", "Metrics are served at /metrics\n"));
+            }
+            close(connection);
+        }
+    }
+#else
+    MetricsServer::MetricsServer(const std::uint16_t port) {
+        throw std::runtime_error(std::format("Cannot serve metrics on port {}: the metrics server requires POSIX sockets", port));
+    }
+
+    MetricsServer::~MetricsServer() = default;
+
+    void MetricsServer::serve() const {}
+#endif
+} // namespace metrics
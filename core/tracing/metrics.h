@@ -0,0 +1,123 @@
+//
+// Physics Simulation Program
+// File: metrics.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Provides a registry of live run metrics rendered in the Prometheus text exposition format
+//   - Provides an optional HTTP server on localhost, running on its own thread, that serves them at /metrics
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_METRICS_H
+#define PHYSICS_SIMULATION_PROGRAM_METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+// metrics
+//
+// Notes on initialisation:
+//   - Metrics are registered on first use with metric() and live until the program exits, so the returned reference
+//     may be cached (typically in a function-local static) and updated from any thread
+//   - The server is off unless a MetricsServer is constructed; the main program starts one when
+//     config::program::metricsServerPort is non-zero
+//
+// Notes on algorithms:
+//   - Updates are relaxed atomic stores/adds on the metric itself; registration and rendering take a registry mutex,
+//     which the stepping hot path never touches, so scrapes never stall workers
+//   - Simulation counters are published once per stepAll from the merged step statistics rather than per step
+//   - memory_accounting categories are read at scrape time and exported as gauges without registration
+//   - The server binds 127.0.0.1 only, handles one connection at a time and answers every path other than /metrics
+//     with 404; it is available on POSIX systems only
+//
+// Notes on output:
+//   - render() follows the Prometheus text format 0.0.4: one HELP/TYPE pair per metric name, then one line per label
+//     set, so `curl http://127.0.0.1:<port>/metrics` shows the live values
+//
+// Supported overloads / operations and functions / methods:
+//   - Registration:           metric(), label()
+//   - Updates:                Metric::set(), Metric::add()
+//   - Output:                 render()
+//   - Server:                 MetricsServer
+//
+// Example usage:
+//   static auto& hits = metrics::metric("simulation_detector_hits_total", "Particles logged by detectors",
+//                                       metrics::Type::Counter, metrics::label("detector", "Collection"));
+//   hits.add(1.0);
+//   metrics::MetricsServer server{9464}; // curl http://127.0.0.1:9464/metrics
+namespace metrics {
+    enum class Type : std::uint8_t {
+        Counter, // Only increases over the run
+        Gauge    // Current value that may go up or down
+    };
+
+    // Metric
+    //
+    // One time series (metric name plus label set)
+    class Metric {
+        public:
+            Metric(std::string name, std::string help, Type type, std::string labels) :
+                m_name(std::move(name)),
+                m_help(std::move(help)),
+                m_labels(std::move(labels)),
+                m_type(type) {}
+
+            void set(const double value) noexcept { this->m_value.store(value, std::memory_order_relaxed); }
+            void add(const double amount) noexcept { this->m_value.fetch_add(amount, std::memory_order_relaxed); }
+            [[nodiscard]] double value() const noexcept { return this->m_value.load(std::memory_order_relaxed); }
+
+            [[nodiscard]] const std::string& name() const noexcept { return this->m_name; }
+            [[nodiscard]] const std::string& help() const noexcept { return this->m_help; }
+            [[nodiscard]] const std::string& labels() const noexcept { return this->m_labels; }
+            [[nodiscard]] Type type() const noexcept { return this->m_type; }
+
+        private:
+            std::string m_name;
+            std::string m_help;
+            std::string m_labels; // Rendered label set without braces, e.g. limiter="time"
+            Type m_type;
+            std::atomic<double> m_value{0.0};
+    };
+
+    // Return the series for name and labels, registering it on first use; throws std::invalid_argument if the name
+    // is not a valid Prometheus metric name or was registered before with a different type
+    [[nodiscard]] Metric& metric(std::string_view name, std::string_view help, Type type, std::string_view labels = {});
+
+    // Format one label as key="value", escaping the value
+    [[nodiscard]] std::string label(std::string_view key, std::string_view value);
+
+    // Every registered metric plus the memory_accounting gauges in the Prometheus text format
+    [[nodiscard]] std::string render();
+
+    // MetricsServer
+    //
+    // Serves render() at http://127.0.0.1:<port>/metrics until destroyed; port 0 picks a free port (see port())
+    class MetricsServer {
+        public:
+            explicit MetricsServer(std::uint16_t port);
+
+            MetricsServer(const MetricsServer&) = delete;
+            MetricsServer& operator=(const MetricsServer&) = delete;
+
+            ~MetricsServer();
+
+            [[nodiscard]] std::uint16_t port() const noexcept { return this->m_port; }
+
+        private:
+            void serve() const;
+
+            int m_socket = -1;
+            std::uint16_t m_port = 0;
+            std::atomic<bool> m_running{true};
+            std::thread m_thread;
+    };
+} // namespace metrics
+
+#endif //PHYSICS_SIMULATION_PROGRAM_METRICS_H
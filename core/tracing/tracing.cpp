@@ -0,0 +1,168 @@
+//
+// Physics Simulation Program
+// File: tracing.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of tracing.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "core/tracing/tracing.h"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace tracing {
+    namespace {
+        struct ThreadBuffer {
+            std::vector<TraceEvent> events = std::vector<TraceEvent>(k_ringCapacity);
+            std::uint64_t written = 0; // Total events recorded; the ring holds the last min(written, capacity)
+            std::size_t track = 0;     // Chrome trace "tid"
+
+            [[nodiscard]] std::size_t size() const noexcept {
+                return static_cast<std::size_t>(std::min<std::uint64_t>(this->written, k_ringCapacity));
+            }
+        };
+
+        std::mutex g_buffersMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> g_buffers; // Every buffer ever created (never freed)
+        std::vector<ThreadBuffer*> g_freeBuffers;             // Buffers released by exited threads
+
+        // Reuse the lowest free track so worker slots keep stable tracks across stepAll calls
+        ThreadBuffer* acquireBuffer() {
+            std::scoped_lock lock(g_buffersMutex);
+            if (!g_freeBuffers.empty()) {
+                const auto lowest = std::ranges::min_element(g_freeBuffers, {}, &ThreadBuffer::track);
+                auto* buffer = *lowest;
+                g_freeBuffers.erase(lowest);
+                return buffer;
+            }
+            auto& buffer = g_buffers.emplace_back(std::make_unique<ThreadBuffer>());
+            buffer->track = g_buffers.size() - 1;
+            return buffer.get();
+        }
+
+        void releaseBuffer(ThreadBuffer* buffer) {
+            std::scoped_lock lock(g_buffersMutex);
+            g_freeBuffers.push_back(buffer);
+        }
+
+        // Returns the buffer to the pool when its thread exits
+        struct BufferHandle {
+            ThreadBuffer* buffer = nullptr;
+
+            ~BufferHandle() {
+                if (this->buffer != nullptr) {
+                    releaseBuffer(this->buffer);
+                }
+            }
+        };
+
+        BufferHandle& localHandle() noexcept {
+            thread_local BufferHandle handle;
+            return handle;
+        }
+
+        double microseconds(const std::int64_t nanoseconds) {
+            return static_cast<double>(nanoseconds) * 1e-3;
+        }
+    } // namespace
+
+    void attachThread() {
+        if (auto& handle = localHandle(); handle.buffer == nullptr) {
+            handle.buffer = acquireBuffer();
+        }
+    }
+
+    void record(const TraceEvent& event) noexcept {
+        auto* buffer = localHandle().buffer;
+        if (buffer == nullptr) {
+            return; // attachThread() was not called (or failed) on this thread
+        }
+        buffer->events[buffer->written % k_ringCapacity] = event;
+        ++buffer->written;
+    }
+
+    void exportChromeTrace(const std::string& path) {
+        std::ofstream out(path);
+        if (!out) {
+            throw std::runtime_error(std::format("Cannot open file '{}'", path));
+        }
+
+        std::scoped_lock lock(g_buffersMutex);
+
+        // Offset timestamps so the trace starts at zero
+        auto epoch = std::numeric_limits<std::int64_t>::max();
+        for (const auto& buffer : g_buffers) {
+            for (std::size_t i = 0; i < buffer->size(); ++i) {
+                epoch = std::min(epoch, buffer->events[i].startNanoseconds);
+            }
+        }
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        bool first = true;
+        const auto separator = [&out, &first] {
+            out << (first ? "" : ",\n");
+            first = false;
+        };
+
+        for (const auto& buffer : g_buffers) {
+            separator();
+            out << std::format(
+                R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"track {}"}}}})",
+                buffer->track,
+                buffer->track
+            );
+
+            const auto count = buffer->size();
+            const auto oldest = buffer->written - count;
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto& event = buffer->events[(oldest + i) % k_ringCapacity];
+                separator();
+                if (event.type == EventType::Complete) {
+                    out << std::format(
+                        R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                        event.name,
+                        buffer->track,
+                        microseconds(event.startNanoseconds - epoch),
+                        microseconds(event.durationNanoseconds)
+                    );
+                } else {
+                    out << std::format(
+                        R"({{"name":"{}","ph":"C","pid":1,"tid":{},"ts":{:.3f},"args":{{"value":{}}}}})",
+                        event.name,
+                        buffer->track,
+                        microseconds(event.startNanoseconds - epoch),
+                        event.value
+                    );
+                }
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    std::size_t recordedEventCount() {
+        std::scoped_lock lock(g_buffersMutex);
+        std::size_t count = 0;
+        for (const auto& buffer : g_buffers) {
+            count += buffer->size();
+        }
+        return count;
+    }
+
+    void clear() {
+        std::scoped_lock lock(g_buffersMutex);
+        for (const auto& buffer : g_buffers) {
+            buffer->written = 0;
+        }
+    }
+} // namespace tracing
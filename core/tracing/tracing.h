@@ -0,0 +1,148 @@
+//
+// Physics Simulation Program
+// File: tracing.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Provides scoped-timer and counter instrumentation recorded to per-thread ring buffers
+//   - Exports the recorded events as Chrome trace-event JSON (viewable in Perfetto or chrome://tracing)
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_TRACING_H
+#define PHYSICS_SIMULATION_PROGRAM_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// tracing
+//
+// Notes on initialisation:
+//   - The instrumentation macros (TRACE_SCOPE, TRACE_COUNTER) expand to nothing unless SIMULATION_ENABLE_TRACING is
+//     defined (CMake option of the same name), so normal builds carry no cost
+//   - When compiled in, recording is on by default and can be toggled at runtime with setEnabled()
+//   - Event names must be string literals (or otherwise outlive the export); only the pointer is stored
+//
+// Notes on algorithms:
+//   - Each thread records into its own fixed-size ring buffer (k_ringCapacity events) without locks; once full the
+//     oldest events are overwritten
+//   - Worker threads are short-lived (one set per stepAll), so buffers are returned to a pool when a thread exits and
+//     reused by the next thread; each buffer becomes one track in the trace, so worker slots map onto stable tracks
+//   - A scoped timer costs two steady_clock reads and one event store
+//   - A thread's buffer is attached by its first enabled scope or counter, the only step that locks or allocates (and so
+//     may throw); record() itself never throws and drops events from threads without a buffer
+//
+// Notes on output:
+//   - exportChromeTrace() writes complete ("X") events for scopes and counter ("C") events, timestamps in
+//     microseconds since the first recorded event of the process
+//   - Export and clear must not run concurrently with stepping; buffers are read without synchronisation
+//
+// Supported overloads / operations and functions / methods:
+//   - Recording:              TRACE_SCOPE(name), TRACE_COUNTER(name, value)
+//   - Runtime toggle:         setEnabled(), isEnabled()
+//   - Output:                 exportChromeTrace(), recordedEventCount()
+//   - Reset:                  clear()
+//
+// Example usage:
+//   void stepAll(...) {
+//       TRACE_SCOPE("stepAll");
+//       TRACE_COUNTER("particles", particleCount);
+//       ...
+//   }
+//   tracing::exportChromeTrace("Output/trace.json");
+namespace tracing {
+    inline constexpr std::size_t k_ringCapacity = std::size_t{1} << 16; // Events per thread buffer
+
+    enum class EventType : std::uint8_t {
+        Complete, // Scoped timer
+        Counter   // Sampled value
+    };
+
+    struct TraceEvent {
+        const char* name = nullptr;
+        std::int64_t startNanoseconds = 0;
+        std::int64_t durationNanoseconds = 0; // Complete events
+        double value = 0.0;                   // Counter events
+        EventType type = EventType::Complete;
+    };
+
+    inline std::atomic<bool> g_tracingEnabled{true};
+
+    // Runtime toggle (only meaningful when SIMULATION_ENABLE_TRACING is defined)
+    inline void setEnabled(const bool enabled) noexcept { g_tracingEnabled.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] inline bool isEnabled() noexcept { return g_tracingEnabled.load(std::memory_order_relaxed); }
+
+    // Nanoseconds on the steady clock
+    [[nodiscard]] inline std::int64_t now() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+
+    // Give the calling thread a ring buffer if it has none; throws std::bad_alloc or std::system_error on failure
+    void attachThread();
+
+    // Append an event to the calling thread's ring buffer (dropped if attachThread() has not succeeded on the thread)
+    void record(const TraceEvent& event) noexcept;
+
+    // Write all buffered events as Chrome trace-event JSON; throws std::runtime_error if the file cannot be opened
+    void exportChromeTrace(const std::string& path);
+
+    // Number of events currently held across all buffers
+    [[nodiscard]] std::size_t recordedEventCount();
+
+    // Discard all buffered events
+    void clear();
+
+    // ScopedTimer
+    //
+    // Records a complete event covering its lifetime; a no-op if tracing was disabled at construction
+    class ScopedTimer {
+        public:
+            explicit ScopedTimer(const char* name)
+                : m_name(name) {
+                if (isEnabled()) {
+                    attachThread();
+                    this->m_start = now();
+                }
+            }
+
+            ~ScopedTimer() {
+                if (this->m_start >= 0) {
+                    record({this->m_name, this->m_start, now() - this->m_start, 0.0, EventType::Complete});
+                }
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            const char* m_name;
+            std::int64_t m_start = -1;
+    };
+
+    inline void counter(const char* name, const double value) {
+        if (isEnabled()) {
+            attachThread();
+            record({name, now(), 0, value, EventType::Counter});
+        }
+    }
+} // namespace tracing
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifdef SIMULATION_ENABLE_TRACING
+    #define TRACE_SCOPE(name) const tracing::ScopedTimer TRACE_CONCAT(traceScope_, __LINE__)(name)
+    #define TRACE_COUNTER(name, value) tracing::counter(name, static_cast<double>(value))
+#else
+    #define TRACE_SCOPE(name) static_cast<void>(0)
+    #define TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
+
+#endif //PHYSICS_SIMULATION_PROGRAM_TRACING_H
@@ -21,6 +21,28 @@
 
 #include "databases/utilities/binary_file_IO.h"
 
+namespace {
+    // Heap bytes owned by a string (zero while it fits the small-string buffer)
+    std::size_t heapBytes(const std::string& string) noexcept {
+        return string.capacity() > std::string().capacity() ? string.capacity() + 1 : 0;
+    }
+
+    // Estimated heap footprint of the loaded entries for memory accounting
+    std::size_t databaseBytes(const std::vector<DatabaseEntry>& entries) noexcept {
+        std::size_t bytes = entries.capacity() * sizeof(DatabaseEntry);
+        for (const auto& [name, properties] : entries) {
+            bytes += heapBytes(name) + properties.capacity() * sizeof(DatabaseProperty);
+            for (const auto& property : properties) {
+                bytes += heapBytes(property.name);
+                if (const auto* string = std::get_if<std::string>(&property.value)) {
+                    bytes += heapBytes(*string);
+                }
+            }
+        }
+        return bytes;
+    }
+} // namespace
+
 void BaseDatabase::loadFromBinary(const std::string& filepath) {
     this->m_db.clear(); // Clear previous content to: prevent duplicates if reusing the same binary; or a merge of 2 databases
 
@@ -143,6 +165,8 @@ void BaseDatabase::loadFromBinary(const std::string& filepath) {
 
         this->m_db.push_back(std::move(entry));
     }
+
+    this->m_memory.resize(databaseBytes(this->m_db), this->m_db.size());
 }
 
 void BaseDatabase::saveToBinary(const std::string& filepath) {
@@ -218,13 +242,13 @@ void BaseDatabase::saveToBinary(const std::string& filepath) {
     return std::ranges::any_of(this->m_db, [&](const DatabaseEntry& entry){ return entry.name == entryName; });
 }
 
-[[nodiscard]] std::string BaseDatabase::getStringProperty(const std::string& entryName, const std::string& propertyName) const {
+[[nodiscard]] const std::string& BaseDatabase::getStringProperty(const std::string& entryName, const std::string_view propertyName) const {
     const auto& entry = findEntry(entryName);
     const auto& property  = findProperty(entry, propertyName);
     return std::get<std::string>(property.value);
 }
 
-[[nodiscard]] double BaseDatabase::getNumericProperty(const std::string& entryName, const std::string& propertyName) const {
+[[nodiscard]] double BaseDatabase::getNumericProperty(const std::string& entryName, const std::string_view propertyName) const {
     const auto& entry = findEntry(entryName);
     const auto& property  = findProperty(entry, propertyName);
 
@@ -246,7 +270,7 @@ void BaseDatabase::saveToBinary(const std::string& filepath) {
     }, property.value);
 }
 
-[[nodiscard]] Quantity BaseDatabase::getQuantityProperty(const std::string& entryName, const std::string& propertyName) const {
+[[nodiscard]] Quantity BaseDatabase::getQuantityProperty(const std::string& entryName, const std::string_view propertyName) const {
     const auto& entry = findEntry(entryName);
     const auto& property  = findProperty(entry, propertyName);
 
@@ -274,7 +298,7 @@ void BaseDatabase::saveToBinary(const std::string& filepath) {
     return *itEntry;
 }
 
-[[nodiscard]] const DatabaseProperty& BaseDatabase::findProperty(const DatabaseEntry& entry, const std::string& propertyName) {
+[[nodiscard]] const DatabaseProperty& BaseDatabase::findProperty(const DatabaseEntry& entry, const std::string_view propertyName) {
     const auto itProperty = std::ranges::find_if(
         entry.properties, [&](const DatabaseProperty& property){ return property.name == propertyName; });
     if (itProperty == entry.properties.end()) {
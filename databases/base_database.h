@@ -16,10 +16,12 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
 #include "core/quantities/quantity.h"
+#include "core/tracing/memory_accounting.h"
 
 // PropertyType
 //
@@ -146,22 +148,25 @@ class BaseDatabase {
         // Get string property method
         //
         // Gets the value of the described property (propertyName) from the entry (entryName) for string types
-        [[nodiscard]] std::string getStringProperty(const std::string& entryName, const std::string& propertyName) const;
+        [[nodiscard]] const std::string& getStringProperty(const std::string& entryName, std::string_view propertyName) const;
 
         // Get numeric property method
         //
         // Gets the value of the described property (propertyName) from the entry (entryName) for numeric types
-        [[nodiscard]] double getNumericProperty(const std::string& entryName, const std::string& propertyName) const;
+        [[nodiscard]] double getNumericProperty(const std::string& entryName, std::string_view propertyName) const;
 
         // Get Quantity property method
         //
         // Gets the value of the described property (propertyName) from the entry (entryName) for Quantity types
-        [[nodiscard]] Quantity getQuantityProperty(const std::string& entryName, const std::string& propertyName) const;
+        [[nodiscard]] Quantity getQuantityProperty(const std::string& entryName, std::string_view propertyName) const;
 
     protected:
         std::vector<DatabaseEntry> m_db;
 
     private:
+        memory_accounting::TrackedBytes m_memory{memory_accounting::Category::Databases}; // Estimated footprint of m_db
+
+
         // Find entry method
         //
         // Searches for an entry entryName
@@ -170,7 +175,7 @@ class BaseDatabase {
         // Find property method
         //
         // Searches for a property propertyName
-        [[nodiscard]] static const DatabaseProperty& findProperty(const DatabaseEntry& entry, const std::string& propertyName);
+        [[nodiscard]] static const DatabaseProperty& findProperty(const DatabaseEntry& entry, std::string_view propertyName);
 };
 
 #endif //PHYSICS_SIMULATION_PROGRAM_BASE_DATABASE_H
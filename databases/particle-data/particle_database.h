@@ -26,7 +26,7 @@
 struct ParticleDatabase final : BaseDatabase {
     using BaseDatabase::BaseDatabase; // Inherit constructors
 
-    [[nodiscard]] std::string getSymbol(const std::string& particle) const {
+    [[nodiscard]] const std::string& getSymbol(const std::string& particle) const {
         return getStringProperty(particle, "symbol");
     }
 
@@ -44,7 +44,7 @@ struct ParticleDatabase final : BaseDatabase {
 
     [[nodiscard]] ParticleType getParticleType(const std::string& particle) const {
         try {
-            const auto type = getStringProperty(particle, "particle type");
+            const auto& type = getStringProperty(particle, "particle type");
             if (type == "photon") {
                 return ParticleType::Photon;
             }
@@ -48,6 +48,9 @@
 //   - Position and transforms are all about the centre of the parent object
 //         -> As such each rotation and position is defined locally
 //   - Getters return const references as they should not be edited and has slightly less overhead
+//   - Each volume caches the magnetic field inside it (see cacheVolumeFields() in field_solver.h) so piecewise-uniform
+//     fields are read with a single load; volumes flagged non-uniform fall back to field map interpolation
+//   - An optional OpticalElement (see optical_element.h) acts on photons crossing the surface in either direction
 //
 // Notes on output:
 //   - Output of a singular object is done print and for the entire system use printHierarchy from the object you want
@@ -59,9 +62,10 @@
 //   - Attach child object:    addChildObject()
 //   - Getters:                get_____() (Parent, Children, Name, Position, Rotation, Material, Temperature,
 //                                         NumberDensity, RelativePermeability, LocalTransformation,
-//                                         WorldTransformation)
+//                                         WorldTransformation, CachedField, OpticalElement)
 //   - Setters:                set_____() (Parent, Name, Position, Rotation, Material, Temperature, NumberDensity,
-//                                         RelativePermeability)
+//                                         RelativePermeability, CachedField, OpticalElement)
+//   - Uniform field check:    hasUniformField()
 //   - To world transform:     localToWorldPoint(), localToWorldDirection()
 //   - To local transform:     worldToLocalPoint(), worldToLocalDirection()
 //   - Volumeless check:       isVolumeless()
@@ -139,6 +143,8 @@ class Object {
         [[nodiscard]] constexpr const double& getRelativePermeability() const noexcept { return this->m_relativePermeability; }
         [[nodiscard]] constexpr TransformationMatrix getLocalTransformation() const noexcept { return this->m_transformation; }
         [[nodiscard]] TransformationMatrix getWorldTransformation() const noexcept; // Recursive combination of transformations
+        [[nodiscard]] constexpr const Vector<3>& getCachedField() const noexcept { return this->m_cachedField; }
+        [[nodiscard]] const OpticalElement* getOpticalElement() const noexcept { return this->m_opticalElement.get(); } // nullptr -> plain surface
 
         // Setters
         constexpr void setParent(Object* parent) noexcept { this->m_parent = parent; }
@@ -150,6 +156,13 @@ class Object {
         void setTemperature(Quantity temperature); // Dimension enforcement
         void setNumberDensity(Quantity numberDensity); // Dimension enforcement
         constexpr void setRelativePermeability(const double relativePermeability) noexcept { this->m_relativePermeability = relativePermeability; }
+        void setCachedField(const Vector<3>& field, const bool uniform) noexcept { this->m_cachedField = field; this->m_hasUniformField = uniform; }
+        void setOpticalElement(std::shared_ptr<const OpticalElement> element) noexcept { this->m_opticalElement = std::move(element); }
+
+        // Uniform field check method
+        //
+        // True once a field has been cached for this volume and it is constant throughout it
+        [[nodiscard]] constexpr bool hasUniformField() const noexcept { return this->m_hasUniformField; }
 
         // To world transform method
         //
@@ -222,6 +235,9 @@ class Object {
         Quantity m_temperature = Quantity(293, Unit::temperatureDimension()); // Room temperature
         Quantity m_numberDensity;
         double m_relativePermeability = 1; // Will be set via construction; this is to supress linters or IDEs
+        Vector<3> m_cachedField;
+        bool m_hasUniformField = false; // Uncached volumes resolve their field on demand
+        std::shared_ptr<const OpticalElement> m_opticalElement; // Acts on photons crossing this object's surface
 
         // Tag setters
         //
@@ -234,6 +250,7 @@ class Object {
         void setTag(TemperatureTag&& tag) { setTemperature(tag.value); }
         void setTag(NumberDensityTag&& tag) { setNumberDensity(tag.value); }
         void setTag(RelativePermeabilityTag&& tag) noexcept { setRelativePermeability(tag.value); }
+        void setTag(OpticalElementTag&& tag) noexcept { setOpticalElement(std::move(tag.value)); }
 
         // Attribute assignment checker method
         //
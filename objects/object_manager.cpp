@@ -79,6 +79,27 @@ void ObjectManager::setActiveWorld(const Object* world) {
     throw std::invalid_argument("Cannot set active world because provided pointer is not managed");
 }
 
+void ObjectManager::destroyWorld(const Object* world) {
+    if (world == nullptr) {
+        throw std::invalid_argument("Cannot destroy world because provided pointer is null");
+    }
+
+    const auto it = std::ranges::find_if(m_worlds, [world](const auto& stored) { return stored.get() == world; });
+    if (it == m_worlds.end()) {
+        throw std::invalid_argument("Cannot destroy world because provided pointer is not managed");
+    }
+
+    const auto index = static_cast<std::size_t>(it - m_worlds.begin());
+    m_worlds.erase(it);
+    if (m_activeWorldIndex.has_value()) {
+        if (*m_activeWorldIndex == index) {
+            m_activeWorldIndex.reset();
+        } else if (*m_activeWorldIndex > index) {
+            --*m_activeWorldIndex;
+        }
+    }
+}
+
 bool ObjectManager::objectBelongsToWorld(const Object* object, const Object* world) noexcept {
     if (!object || !world) {
         return false;
@@ -32,8 +32,8 @@
 // Notes on initialisation:
 //   - Worlds must be created through createWorld<T>() so ownership stays inside the manager
 //   - The first world created automatically becomes the active world; subsequent ones require setActiveWorld()
-//   - Stored worlds are never deleted by callers; pointers returned by the manager remain valid for the lifetime of the
-//     program
+//   - Stored worlds are never deleted by callers; pointers returned by the manager remain valid until the world is
+//     passed to destroyWorld() (otherwise for the lifetime of the program)
 //
 // Notes on algorithms:
 //   - getActiveWorld() is context-aware: it throws if no world is active, using the provided context string to describe
@@ -44,6 +44,7 @@
 //   - Construction:           createWorld<T>()
 //   - Getters:                getActiveWorld(), getActiveWorldAt(), getWorldCount()
 //   - Setters:                setActiveWorld()
+//   - Destruction:            destroyWorld()
 //   - Relationship checks:    objectBelongsToWorld(), objectBelongsToActiveWorld()
 //
 // Example usage:
@@ -79,6 +80,12 @@ class ObjectManager {
         void setActiveWorld(std::size_t index);
         void setActiveWorld(const Object* world);
 
+        // Destroy world method
+        //
+        // Deletes a world and its whole object tree, invalidating every pointer into it; if it was the active world no
+        // world is active afterwards. Throws std::invalid_argument if world is null or not managed
+        void destroyWorld(const Object* world);
+
         // Object belongs to world check method
         [[nodiscard]] static bool objectBelongsToWorld(const Object* object, const Object* world) noexcept;
 
@@ -17,11 +17,14 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include "core/linear-algebra/matrix.h"
 #include "core/linear-algebra/vector.h"
 #include "core/quantities/quantity.h"
 
+class OpticalElement;
+
 // Parent tag
 //
 // Allows for either unique pointers for the root object or Object class pointers for other objects
@@ -138,4 +141,16 @@ struct RelativePermeabilityTag {
 template <typename T>
 concept RelativePermeabilityArgument = std::same_as<std::decay_t<T>, RelativePermeabilityTag>;
 
+// Optical element tag
+//
+// Allows for shared pointers to an OpticalElement (see optical_element.h) acting on photons crossing the surface
+struct OpticalElementTag {
+    std::shared_ptr<const OpticalElement> value;
+};
+[[nodiscard]] inline OpticalElementTag opticalElement(std::shared_ptr<const OpticalElement> element) noexcept {
+    return {std::move(element)};
+}
+template <typename T>
+concept OpticalElementArgument = std::same_as<std::decay_t<T>, OpticalElementTag>;
+
 #endif //PHYSICS_SIMULATION_PROGRAM_OBJECT_INITIALISATION_TAGS_H
\ No newline at end of file
@@ -81,10 +81,12 @@ void Atom::setHyperfineLevels(std::vector<HyperfineLevel> levels, const std::siz
     }
     this->m_hyperfineLevels = std::move(levels);
     this->m_activeHyperfineIndex = (activeIndex < this->m_hyperfineLevels.size()) ? activeIndex : 0;
+    this->updateHyperfineMemory();
 }
 
 void Atom::addHyperfineLevel(const HyperfineLevel& level) {
     this->m_hyperfineLevels.push_back(normalizeHyperfineLevel(level, this->m_nuclearSpin));
+    this->updateHyperfineMemory();
 }
 
 bool Atom::selectHyperfineLevel(const std::size_t index) {
@@ -146,5 +148,10 @@ void Atom::ensureHyperfineState() {
     if (this->m_hyperfineLevels.empty()) {
         this->m_hyperfineLevels.push_back(makeDefaultHyperfineLevel(this->m_nuclearSpin));
         this->m_activeHyperfineIndex = 0;
+        this->updateHyperfineMemory();
     }
 }
+
+void Atom::updateHyperfineMemory() noexcept {
+    this->m_hyperfineMemory.resize(this->m_hyperfineLevels.capacity() * sizeof(HyperfineLevel));
+}
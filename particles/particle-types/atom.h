@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/tracing/memory_accounting.h"
 #include "particles/particle.h"
 
 // Atom
@@ -37,7 +38,8 @@
 //   - Constructors:           Atom()
 //   - Polarisation helpers:   getPolarisation(), setPolarisation(), printPolarisation()
 //   - Hyperfine helpers:      setHyperfineLevels(), addHyperfineLevel(), selectHyperfineLevel(),
-//                             setHyperfineState(), getHyperfineState(), getNuclearSpin()
+//                             setHyperfineState(), getHyperfineState(), getHyperfineLevels(), getHyperfineIndex(),
+//                             getNuclearSpin()
 class [[nodiscard]] Atom final : public Particle {
     public:
         struct HyperfineLevel {
@@ -87,6 +89,8 @@ class [[nodiscard]] Atom final : public Particle {
         bool selectHyperfineLevel(double F, double mF, bool excited);
         void setHyperfineState(const HyperfineLevel& level);
         [[nodiscard]] const HyperfineLevel& getHyperfineState() const;
+        [[nodiscard]] const std::vector<HyperfineLevel>& getHyperfineLevels() const noexcept { return this->m_hyperfineLevels; }
+        [[nodiscard]] std::size_t getHyperfineIndex() const noexcept { return this->m_activeHyperfineIndex; }
         [[nodiscard]] double getNuclearSpin() const noexcept { return this->m_nuclearSpin; }
 
     protected:
@@ -97,9 +101,11 @@ class [[nodiscard]] Atom final : public Particle {
         std::vector<HyperfineLevel> m_hyperfineLevels;
         std::size_t m_activeHyperfineIndex = 0;
         double m_nuclearSpin = 0.0;
+        memory_accounting::TrackedBytes m_hyperfineMemory{memory_accounting::Category::HyperfineLevels};
 
         static HyperfineLevel normalizeHyperfineLevel(const HyperfineLevel& level, double defaultNuclearSpin);
         void ensureHyperfineState();
+        void updateHyperfineMemory() noexcept; // Reports the level vector capacity to memory_accounting
 };
 
 #endif //PHYSICS_SIMULATION_PROGRAM_PARTICLE_TYPES_ATOM_H
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include <limits>
 #include <stdexcept>
 
+#include "core/tracing/memory_accounting.h"
 #include "databases/particle-data/particle_database.h"
 
 // Constructor for custom particles - have to assign basic attributes
@@ -339,3 +340,14 @@ void Particle::print() const { // TODO: UPDATE
 void Particle::printPolarisation(std::ostream& stream) const {
     stream << "Polarisation: (not tracked)\n";
 }
+
+void* Particle::operator new(const std::size_t size) {
+    void* pointer = ::operator new(size);
+    memory_accounting::add(memory_accounting::Category::Particles, size, 1);
+    return pointer;
+}
+
+void Particle::operator delete(void* pointer, const std::size_t size) noexcept {
+    memory_accounting::remove(memory_accounting::Category::Particles, size, 1);
+    ::operator delete(pointer, size);
+}
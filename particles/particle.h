@@ -13,6 +13,7 @@
 #ifndef PHYSICS_SIMULATION_PROGRAM_PARTICLES_H
 #define PHYSICS_SIMULATION_PROGRAM_PARTICLES_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
 #include <utility>
@@ -60,6 +61,12 @@ class [[nodiscard]] Particle {
     public:
         virtual ~Particle() = default;
 
+        // Allocation functions
+        //
+        // Count heap-allocated particles (size of the most derived type) under memory_accounting::Category::Particles
+        [[nodiscard]] static void* operator new(std::size_t size);
+        static void operator delete(void* pointer, std::size_t size) noexcept;
+
         // Constructor for custom particles
         Particle(
             std::string type,
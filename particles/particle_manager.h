@@ -14,10 +14,11 @@
 #define PHYSICS_SIMULATION_PROGRAM_PARTICLE_MANAGER_H
 
 #include <memory>
-#include <shared_mutex>
 #include <utility>
 #include <vector>
 
+#include "core/tracing/lock_profiling.h"
+#include "core/tracing/memory_accounting.h"
 #include "particles/particle.h"
 
 // ParticleManager
@@ -27,6 +28,7 @@
 //
 // Notes on algorithms:
 //   - Stores particles as unique_ptr to enforce ownership and allow move-only semantics
+//   - The pointer vector capacity is reported to memory_accounting after every exclusive modification
 //
 // Supported overloads / operations and functions / methods:
 //   - Add particles:          addParticle(), addParticles()
@@ -36,7 +38,7 @@ class ParticleManager {
     public:
         class ReadHandle {
             public:
-                ReadHandle(std::vector<std::unique_ptr<Particle> > *particles, std::shared_mutex &mutex) :
+                ReadHandle(std::vector<std::unique_ptr<Particle> > *particles, lock_profiling::ProfiledSharedMutex &mutex) :
                     m_particles(particles),
                     m_lock(mutex) {}
 
@@ -60,7 +62,7 @@ class ParticleManager {
 
             private:
                 std::vector<std::unique_ptr<Particle> > *m_particles = nullptr;
-                std::shared_lock<std::shared_mutex> m_lock;
+                std::shared_lock<lock_profiling::ProfiledSharedMutex> m_lock;
         };
 
         ParticleManager() = default;
@@ -69,6 +71,7 @@ class ParticleManager {
             if (particle) {
                 std::unique_lock lock(this->m_mutex);
                 this->m_particles.push_back(std::move(particle));
+                this->updateStorageMemory();
             }
         }
 
@@ -79,6 +82,7 @@ class ParticleManager {
                     this->m_particles.push_back(std::move(particle));
                 }
             }
+            this->updateStorageMemory();
         }
 
         [[nodiscard]] ReadHandle acquireReadHandle() {
@@ -89,6 +93,7 @@ class ParticleManager {
         void withExclusiveAccess(Callable &&callable) {
             std::unique_lock lock(this->m_mutex);
             callable(this->m_particles);
+            this->updateStorageMemory();
         }
 
         [[nodiscard]] bool empty() const {
@@ -98,7 +103,13 @@ class ParticleManager {
 
     private:
         std::vector<std::unique_ptr<Particle> > m_particles;
-        mutable std::shared_mutex m_mutex;
+        mutable lock_profiling::ProfiledSharedMutex m_mutex{"particle_manager"};
+        memory_accounting::TrackedBytes m_storageMemory{memory_accounting::Category::Particles};
+
+        // Callers must hold m_mutex exclusively
+        void updateStorageMemory() noexcept {
+            this->m_storageMemory.resize(this->m_particles.capacity() * sizeof(std::unique_ptr<Particle>));
+        }
 };
 
 inline ParticleManager g_particleManager;
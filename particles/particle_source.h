@@ -14,6 +14,7 @@
 #define PHYSICS_SIMULATION_PROGRAM_PARTICLE_SOURCE_H
 
 #include "core/linear-algebra/vector.h"
+#include "core/random/random_manager.h"
 
 #include "databases/particle-data/particle_database.h"
 #include "particles/particle.h"
@@ -38,6 +39,11 @@ class ParticleSource { // TODO: Rework this logic is not very good to read. Also
         std::size_t activeLevelIndex = 0;
     };
 
+    ParticleSource() = default;
+
+    // Generated particles go to target instead of g_particleManager (e.g. a SimulationContext's own particles)
+    explicit ParticleSource(ParticleManager& target) : m_target(&target) {}
+
     template <typename TimeT, typename PosT, typename EnergyT, typename MomT, typename PolT>
     void generateParticles(
         const std::string& particleName,
@@ -52,8 +58,7 @@ class ParticleSource { // TODO: Rework this logic is not very good to read. Also
         std::vector<std::unique_ptr<Particle>> particles;
         particles.reserve(count);
 
-        std::random_device rd;
-        std::ranlux48 gen(rd());
+        auto& gen = random_manager::engine(random_manager::Stream::SourceSampling); // Seeded from the master seed
         std::uniform_real_distribution dist(-1.0, 1.0);
 
         const auto particleType = g_particleDatabase.getParticleType(particleName);
@@ -122,10 +127,12 @@ class ParticleSource { // TODO: Rework this logic is not very good to read. Also
             }
         }
 
-        g_particleManager.addParticles(std::move(particles));
+        this->m_target->addParticles(std::move(particles));
     }
 
     private:
+        ParticleManager* m_target = &g_particleManager;
+
         template <typename T>
         static constexpr bool k_dependentFalse = false;
 
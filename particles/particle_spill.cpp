@@ -0,0 +1,620 @@
+//
+// Physics Simulation Program
+// File: particle_spill.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of particle_spill.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "particles/particle_spill.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "config/path_config.h"
+#include "config/program_config.h"
+#include "particles/particle-types/atom.h"
+#include "particles/particle-types/photon.h"
+#include "physics/processes/discrete/core/interaction_process_registry.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace {
+    enum class RecordKind : std::uint8_t {
+        Particle = 0,
+        Atom,
+        Photon
+    };
+
+    // Optional per-particle state present in a record
+    constexpr std::uint8_t k_hasDecayClock = 1u << 0;
+    constexpr std::uint8_t k_hasDecayEnergy = 1u << 1;
+    constexpr std::uint8_t k_hasInteractionLength = 1u << 2;
+
+    constexpr std::uint16_t k_noProcess = std::numeric_limits<std::uint16_t>::max();
+
+    // Constants shared by every particle of one type, stored once per page
+    struct TypeEntry {
+        std::string type;
+        std::string symbol;
+        Quantity restMass;
+        Quantity charge;
+        Quantity spin;
+        Quantity lifetime;
+    };
+
+    class PageWriter {
+        public:
+            explicit PageWriter(std::vector<std::byte>& bytes) : m_bytes(bytes) {}
+
+            template<typename T>
+            void put(const T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const auto* first = reinterpret_cast<const std::byte*>(&value);
+                this->m_bytes.insert(this->m_bytes.end(), first, first + sizeof(T));
+            }
+
+            void putString(const std::string_view text) {
+                if (text.size() > std::numeric_limits<std::uint16_t>::max()) {
+                    throw std::length_error(std::format("Cannot spill string of {} characters", text.size()));
+                }
+                this->put(static_cast<std::uint16_t>(text.size()));
+                const auto* first = reinterpret_cast<const std::byte*>(text.data());
+                this->m_bytes.insert(this->m_bytes.end(), first, first + text.size());
+            }
+
+            // Value and exponents only; the padding of Quantity is never written
+            void putQuantity(const Quantity& quantity) {
+                this->put(quantity.value);
+                this->put(quantity.unit.exponents);
+            }
+
+            template<std::size_t N>
+            void putVector(const Vector<N>& vector) {
+                for (const auto& component : vector.data) {
+                    this->putQuantity(component);
+                }
+            }
+
+        private:
+            std::vector<std::byte>& m_bytes;
+    };
+
+    class PageReader {
+        public:
+            explicit PageReader(const std::span<const std::byte> bytes) : m_bytes(bytes) {}
+
+            template<typename T>
+            T get() {
+                static_assert(std::is_trivially_copyable_v<T>);
+                this->require(sizeof(T));
+                T value{};
+                std::memcpy(&value, this->m_bytes.data() + this->m_cursor, sizeof(T));
+                this->m_cursor += sizeof(T);
+                return value;
+            }
+
+            std::string getString() {
+                const auto size = this->get<std::uint16_t>();
+                this->require(size);
+                std::string text(reinterpret_cast<const char*>(this->m_bytes.data() + this->m_cursor), size);
+                this->m_cursor += size;
+                return text;
+            }
+
+            Quantity getQuantity() {
+                Quantity quantity;
+                quantity.value = this->get<double>();
+                quantity.unit.exponents = this->get<decltype(Unit::exponents)>();
+                return quantity;
+            }
+
+            template<std::size_t N>
+            Vector<N> getVector() {
+                Vector<N> vector;
+                for (auto& component : vector.data) {
+                    component = this->getQuantity();
+                }
+                return vector;
+            }
+
+        private:
+            std::span<const std::byte> m_bytes;
+            std::size_t m_cursor = 0;
+
+            void require(const std::size_t size) const {
+                if (this->m_bytes.size() - this->m_cursor < size) {
+                    throw std::runtime_error("Unexpected end of particle spill page");
+                }
+            }
+    };
+
+    bool sameQuantity(const Quantity& a, const Quantity& b) noexcept {
+        return a.value == b.value && a.unit == b.unit;
+    }
+
+    bool sameType(const Particle& a, const Particle& b) noexcept {
+        return a.getType() == b.getType()
+            && a.getSymbol() == b.getSymbol()
+            && sameQuantity(a.getRestMass(), b.getRestMass())
+            && sameQuantity(a.getCharge(), b.getCharge())
+            && sameQuantity(a.getSpin(), b.getSpin())
+            && sameQuantity(a.getLifetime(), b.getLifetime());
+    }
+
+    std::uint16_t processIndex(const discrete_interaction::InteractionProcess* process) {
+        const auto& processes = discrete_interaction::registeredInteractionProcesses();
+        const auto it = std::ranges::find(processes, process);
+        return it == processes.end() ? k_noProcess : static_cast<std::uint16_t>(it - processes.begin());
+    }
+
+    void encodeParticle(PageWriter& out, const Particle& particle, const std::uint16_t typeIndex) {
+        const auto* atom = dynamic_cast<const Atom*>(&particle);
+        const auto* photon = dynamic_cast<const Photon*>(&particle);
+        const auto kind = atom ? RecordKind::Atom : photon ? RecordKind::Photon : RecordKind::Particle;
+
+        std::uint8_t flags = 0;
+        if (particle.hasDecayClock()) {
+            flags |= k_hasDecayClock;
+        }
+        if (particle.hasDecayEnergy()) {
+            flags |= k_hasDecayEnergy;
+        }
+        if (particle.hasPendingInteractionLength()) {
+            flags |= k_hasInteractionLength;
+        }
+
+        // Dynamic state in SI doubles; the setters fix the dimensions, so only values are stored
+        out.put(kind);
+        out.put(typeIndex);
+        out.put(flags);
+        out.put(particle.getTime().value);
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            out.put(particle.getPosition()[axis].value);
+        }
+        out.put(particle.getEnergy().value);
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            out.put(particle.getMomentum()[axis].value);
+        }
+        if (flags & k_hasDecayClock) {
+            out.put(particle.getDecayTimeRemaining().value);
+        }
+        if (flags & k_hasDecayEnergy) {
+            out.put(particle.getDecayEnergy().value);
+        }
+        if (flags & k_hasInteractionLength) {
+            out.put(particle.getInteractionLengthRemaining().value);
+            out.put(processIndex(particle.getPendingInteractionProcess()));
+        }
+
+        if (atom) {
+            out.putVector(atom->getPolarisation());
+            const auto& levels = atom->getHyperfineLevels();
+            out.put(static_cast<std::uint32_t>(levels.size()));
+            out.put(static_cast<std::uint32_t>(atom->getHyperfineIndex()));
+            for (const auto& level : levels) {
+                out.put(static_cast<std::int32_t>(level.principalQuantumNumber));
+                out.put(level.orbitalAngularMomentum);
+                out.put(level.totalElectronicAngularMomentum);
+                out.put(level.nuclearSpin);
+                out.put(level.totalAngularMomentum);
+                out.put(level.magneticQuantumNumber);
+                out.put(static_cast<std::uint8_t>(level.excited));
+                out.putQuantity(level.energyShift);
+                out.putString(level.label);
+            }
+        } else if (photon) {
+            out.putVector(photon->getPolarisation());
+        }
+    }
+
+    std::unique_ptr<Particle> decodeParticle(PageReader& in, const std::vector<TypeEntry>& types) {
+        const auto kind = in.get<RecordKind>();
+        const auto typeIndex = in.get<std::uint16_t>();
+        const auto flags = in.get<std::uint8_t>();
+        if (typeIndex >= types.size()) {
+            throw std::runtime_error(std::format("Particle spill record names type {} of {}", typeIndex, types.size()));
+        }
+        const auto& entry = types[typeIndex];
+
+        const Quantity time(in.get<double>(), Unit::timeDimension());
+        Vector<3> position;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            position[axis] = Quantity(in.get<double>(), Unit::lengthDimension());
+        }
+        const Quantity energy(in.get<double>(), Unit::energyDimension());
+        Vector<3> momentum;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            momentum[axis] = Quantity(in.get<double>(), Unit::momentumDimension());
+        }
+        const double decayTime = (flags & k_hasDecayClock) ? in.get<double>() : 0.0;
+        const double decayEnergy = (flags & k_hasDecayEnergy) ? in.get<double>() : 0.0;
+        double interactionLength = 0.0;
+        std::uint16_t process = k_noProcess;
+        if (flags & k_hasInteractionLength) {
+            interactionLength = in.get<double>();
+            process = in.get<std::uint16_t>();
+        }
+
+        std::unique_ptr<Particle> particle;
+        switch (kind) {
+            case RecordKind::Atom: {
+                const auto polarisation = in.getVector<3>();
+                const auto levelCount = in.get<std::uint32_t>();
+                const auto activeIndex = in.get<std::uint32_t>();
+                std::vector<Atom::HyperfineLevel> levels(levelCount);
+                for (auto& level : levels) {
+                    level.principalQuantumNumber = in.get<std::int32_t>();
+                    level.orbitalAngularMomentum = in.get<double>();
+                    level.totalElectronicAngularMomentum = in.get<double>();
+                    level.nuclearSpin = in.get<double>();
+                    level.totalAngularMomentum = in.get<double>();
+                    level.magneticQuantumNumber = in.get<double>();
+                    level.excited = in.get<std::uint8_t>() != 0;
+                    level.energyShift = in.getQuantity();
+                    level.label = in.getString();
+                }
+                particle = std::make_unique<Atom>(
+                    entry.type, time, position, energy, momentum, polarisation, std::move(levels), activeIndex
+                );
+                break;
+            }
+            case RecordKind::Photon:
+                particle = std::make_unique<Photon>(entry.type, time, position, energy, momentum, in.getVector<4>());
+                break;
+            case RecordKind::Particle:
+                particle = std::make_unique<Particle>(entry.type, time, position, energy, momentum);
+                break;
+            default:
+                throw std::runtime_error(std::format("Unknown particle spill record kind {}", static_cast<int>(kind)));
+        }
+
+        // Restore the spilled constants over the database values, then the state the setters below would clear
+        particle->setSymbol(entry.symbol);
+        particle->setRestMass(entry.restMass);
+        particle->setCharge(entry.charge);
+        particle->setSpin(entry.spin);
+        if (Unit::hasTimeDimension(entry.lifetime.unit)) {
+            particle->setLifetime(entry.lifetime);
+        }
+        if (flags & k_hasDecayClock) {
+            particle->setDecayClock(Quantity(decayTime, Unit::timeDimension()));
+        }
+        if (flags & k_hasDecayEnergy) {
+            particle->setDecayEnergy(Quantity(decayEnergy, Unit::energyDimension()));
+        }
+        if (flags & k_hasInteractionLength) {
+            const auto& processes = discrete_interaction::registeredInteractionProcesses();
+            particle->setInteractionLengthRemaining(
+                Quantity(interactionLength, Unit::lengthDimension()),
+                process < processes.size() ? processes[process] : nullptr // Unknown -> cleared and resampled
+            );
+        }
+        return particle;
+    }
+
+    void encodePage(const std::span<const std::unique_ptr<Particle>> particles, std::vector<std::byte>& bytes) {
+        std::vector<const Particle*> types;
+        std::vector<std::uint16_t> typeIndices;
+        typeIndices.reserve(particles.size());
+        for (const auto& particle : particles) {
+            auto it = std::ranges::find_if(types, [&particle](const Particle* other) { return sameType(*particle, *other); });
+            if (it == types.end()) {
+                if (types.size() == std::numeric_limits<std::uint16_t>::max()) {
+                    throw std::length_error("Too many distinct particle types in one spill page");
+                }
+                it = types.insert(types.end(), particle.get());
+            }
+            typeIndices.push_back(static_cast<std::uint16_t>(it - types.begin()));
+        }
+
+        PageWriter out(bytes);
+        out.put(static_cast<std::uint16_t>(types.size()));
+        for (const auto* type : types) {
+            out.putString(type->getType());
+            out.putString(type->getSymbol());
+            out.putQuantity(type->getRestMass());
+            out.putQuantity(type->getCharge());
+            out.putQuantity(type->getSpin());
+            out.putQuantity(type->getLifetime());
+        }
+        out.put(static_cast<std::uint32_t>(particles.size()));
+        for (std::size_t index = 0; index < particles.size(); ++index) {
+            encodeParticle(out, *particles[index], typeIndices[index]);
+        }
+    }
+
+    void decodePage(
+        const std::span<const std::byte> bytes,
+        const std::size_t expectedCount,
+        std::vector<std::unique_ptr<Particle>>& particles)
+    {
+        PageReader in(bytes);
+        std::vector<TypeEntry> types(in.get<std::uint16_t>());
+        for (auto& type : types) {
+            type.type = in.getString();
+            type.symbol = in.getString();
+            type.restMass = in.getQuantity();
+            type.charge = in.getQuantity();
+            type.spin = in.getQuantity();
+            type.lifetime = in.getQuantity();
+        }
+        if (const auto count = in.get<std::uint32_t>(); count != expectedCount) {
+            throw std::runtime_error(std::format("Particle spill page holds {} particles, expected {}", count, expectedCount));
+        }
+        particles.reserve(particles.size() + expectedCount);
+        for (std::size_t index = 0; index < expectedCount; ++index) {
+            particles.push_back(decodeParticle(in, types));
+        }
+    }
+
+    std::uint64_t processId() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+        return static_cast<std::uint64_t>(getpid());
+#else
+        return 0;
+#endif
+    }
+} // namespace
+
+ParticleSpill::ParticleSpill() : m_budget(config::program::liveParticleBudget) {}
+
+ParticleSpill::~ParticleSpill() {
+    {
+        std::lock_guard lock(this->m_mutex);
+        this->m_stopping = true;
+    }
+    this->m_wake.notify_all();
+    if (this->m_thread.joinable()) {
+        this->m_thread.join();
+    }
+    if (this->m_file.is_open()) {
+        this->m_file.close();
+    }
+    if (!this->m_path.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(this->m_path, ec);
+    }
+}
+
+void ParticleSpill::balance(std::vector<std::unique_ptr<Particle>>& live) {
+    const std::size_t configured = this->budget();
+    if (configured == 0 && this->empty()) {
+        return;
+    }
+    const std::size_t budget = configured > 0 ? configured : std::numeric_limits<std::size_t>::max();
+
+    if (live.size() > budget) {
+        auto batch = this->takeExcess(live, live.size() - budget); // Outside the lock; the priority may be costly
+        std::unique_lock lock(this->m_mutex);
+        this->rethrowError();
+        this->m_wanted = 0; // No room, so stop reading ahead
+        this->m_unwritten += batch.size();
+        this->m_held.fetch_add(batch.size(), std::memory_order_release);
+        this->m_writeQueue.push_back(std::move(batch));
+        if (!this->m_thread.joinable()) {
+            this->m_thread = std::thread(&ParticleSpill::run, this);
+        }
+        this->m_wake.notify_one();
+
+        const std::size_t limit = std::max(budget, config::program::spillPageParticles);
+        this->m_ready.wait(lock, [this, limit] { return this->m_unwritten <= limit || this->m_error; });
+        this->rethrowError();
+        return;
+    }
+
+    std::unique_lock lock(this->m_mutex);
+    this->rethrowError();
+    this->reloadInto(live, budget - live.size());
+    while (live.empty() && !this->empty()) {
+        this->m_wanted = budget;
+        this->m_wake.notify_one();
+        this->m_ready.wait(lock);
+        this->rethrowError();
+        this->reloadInto(live, budget - live.size());
+    }
+
+    // Read ahead into the remaining room during the next stepAll
+    this->m_wanted = budget - live.size();
+    if (this->m_wanted > 0 && !this->m_pages.empty()) {
+        this->m_wake.notify_one();
+    }
+}
+
+void ParticleSpill::setBudget(const std::size_t budget) noexcept {
+    this->m_budget.store(budget, std::memory_order_relaxed);
+}
+
+void ParticleSpill::setPriority(Priority priority) {
+    this->m_priority = std::move(priority);
+}
+
+void ParticleSpill::clear() {
+    std::unique_lock lock(this->m_mutex);
+    this->m_ready.wait(lock, [this] { return (!this->m_writing && !this->m_reading) || this->m_error; });
+    this->m_writeQueue.clear();
+    this->m_unwritten = 0;
+    this->m_pages.clear();
+    this->m_readAhead.clear();
+    this->m_wanted = 0;
+    this->m_held.store(0, std::memory_order_release);
+}
+
+void ParticleSpill::run() {
+    std::unique_lock lock(this->m_mutex);
+    while (true) {
+        this->m_wake.wait(lock, [this] {
+            return this->m_stopping || (!this->m_error && (!this->m_writeQueue.empty()
+                || (this->m_readAhead.size() < this->m_wanted && !this->m_pages.empty())));
+        });
+        if (this->m_stopping) {
+            return;
+        }
+
+        try {
+            if (!this->m_writeQueue.empty()) { // Writes first, they free memory
+                auto batch = std::move(this->m_writeQueue.front());
+                this->m_writeQueue.pop_front();
+                if (this->m_pages.empty()) {
+                    this->m_fileEnd = 0; // Every page has been read back, so the file is reused from the start
+                }
+                this->m_writing = true;
+                lock.unlock();
+
+                const auto count = batch.size();
+                std::vector<Page> written;
+                this->writeBatch(batch, written);
+
+                lock.lock();
+                this->m_writing = false;
+                this->m_unwritten -= count;
+                this->m_pages.insert(this->m_pages.end(), written.begin(), written.end());
+            } else {
+                const auto page = this->m_pages.front();
+                this->m_pages.pop_front();
+                this->m_reading = true;
+                lock.unlock();
+
+                std::vector<std::unique_ptr<Particle>> particles;
+                this->readPage(page, particles);
+
+                lock.lock();
+                this->m_reading = false;
+                this->m_readAhead.insert(
+                    this->m_readAhead.end(),
+                    std::make_move_iterator(particles.begin()),
+                    std::make_move_iterator(particles.end())
+                );
+            }
+        } catch (...) {
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+            this->m_writing = false;
+            this->m_reading = false;
+            this->m_error = std::current_exception();
+        }
+        this->m_ready.notify_all();
+    }
+}
+
+void ParticleSpill::writeBatch(std::vector<std::unique_ptr<Particle>>& batch, std::vector<Page>& written) {
+    if (!this->m_file.is_open()) {
+        static std::atomic<std::uint64_t> counter{0};
+        const std::filesystem::path directory{config::paths::spillDirectory};
+        std::filesystem::create_directories(directory);
+        this->m_path = directory / std::format(
+            "particles-{}-{}.spill", processId(), counter.fetch_add(1, std::memory_order_relaxed)
+        );
+        this->m_file.open(this->m_path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!this->m_file) {
+            throw std::runtime_error(std::format("Cannot create particle spill file '{}'", this->m_path.string()));
+        }
+    }
+
+    constexpr std::size_t pageParticles = std::max<std::size_t>(1, config::program::spillPageParticles);
+    for (std::size_t first = 0; first < batch.size(); first += pageParticles) {
+        const auto count = std::min(pageParticles, batch.size() - first);
+        this->m_buffer.clear();
+        encodePage(std::span<const std::unique_ptr<Particle>>(batch).subspan(first, count), this->m_buffer);
+
+        this->m_file.seekp(static_cast<std::streamoff>(this->m_fileEnd));
+        this->m_file.write(reinterpret_cast<const char*>(this->m_buffer.data()), static_cast<std::streamsize>(this->m_buffer.size()));
+        if (!this->m_file) {
+            throw std::runtime_error(std::format("Failed writing particle spill file '{}'", this->m_path.string()));
+        }
+        written.push_back({this->m_fileEnd, this->m_buffer.size(), count});
+        this->m_fileEnd += this->m_buffer.size();
+        this->m_bufferMemory.resize(this->m_buffer.capacity());
+
+        for (std::size_t index = first; index < first + count; ++index) {
+            batch[index].reset(); // Freed as soon as its page is written
+        }
+    }
+    this->m_file.flush();
+}
+
+void ParticleSpill::readPage(const Page& page, std::vector<std::unique_ptr<Particle>>& particles) {
+    this->m_buffer.resize(page.bytes);
+    this->m_file.seekg(static_cast<std::streamoff>(page.offset));
+    this->m_file.read(reinterpret_cast<char*>(this->m_buffer.data()), static_cast<std::streamsize>(page.bytes));
+    if (!this->m_file) {
+        throw std::runtime_error(std::format("Failed reading particle spill file '{}'", this->m_path.string()));
+    }
+    this->m_bufferMemory.resize(this->m_buffer.capacity());
+    decodePage(this->m_buffer, page.particles, particles);
+}
+
+std::vector<std::unique_ptr<Particle>> ParticleSpill::takeExcess(
+    std::vector<std::unique_ptr<Particle>>& live,
+    const std::size_t count) const
+{
+    std::vector<std::unique_ptr<Particle>> batch;
+    batch.reserve(count);
+    if (!this->m_priority) {
+        std::ranges::move(live.begin(), live.begin() + static_cast<std::ptrdiff_t>(count), std::back_inserter(batch));
+        live.erase(live.begin(), live.begin() + static_cast<std::ptrdiff_t>(count));
+        return batch;
+    }
+
+    std::vector<std::pair<double, std::size_t>> ranked;
+    ranked.reserve(live.size());
+    for (std::size_t index = 0; index < live.size(); ++index) {
+        ranked.emplace_back(this->m_priority(*live[index]), index);
+    }
+    std::ranges::nth_element(ranked, ranked.begin() + static_cast<std::ptrdiff_t>(count));
+    ranked.resize(count);
+    std::ranges::sort(ranked, {}, &std::pair<double, std::size_t>::second); // Keep the live order within the batch
+    for (const auto& [priority, index] : ranked) {
+        batch.push_back(std::move(live[index]));
+    }
+    std::erase(live, nullptr);
+    return batch;
+}
+
+void ParticleSpill::reloadInto(std::vector<std::unique_ptr<Particle>>& live, std::size_t room) {
+    const auto moveFront = [&live](std::vector<std::unique_ptr<Particle>>& source, const std::size_t count) {
+        const auto end = source.begin() + static_cast<std::ptrdiff_t>(count);
+        live.insert(live.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(end));
+        source.erase(source.begin(), end);
+    };
+
+    std::size_t reloaded = std::min(room, this->m_readAhead.size());
+    moveFront(this->m_readAhead, reloaded);
+    room -= reloaded;
+
+    // Batches not yet written are the oldest spilled particles only when nothing is on disk or in flight
+    while (room > 0 && this->m_pages.empty() && !this->m_writing && !this->m_reading && !this->m_writeQueue.empty()) {
+        auto& batch = this->m_writeQueue.front();
+        const auto count = std::min(room, batch.size());
+        moveFront(batch, count);
+        if (batch.empty()) {
+            this->m_writeQueue.pop_front();
+        }
+        this->m_unwritten -= count;
+        reloaded += count;
+        room -= count;
+    }
+    this->m_held.fetch_sub(reloaded, std::memory_order_release);
+}
+
+void ParticleSpill::rethrowError() const {
+    if (this->m_error) {
+        std::rethrow_exception(this->m_error);
+    }
+}
@@ -0,0 +1,136 @@
+//
+// Physics Simulation Program
+// File: particle_spill.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Out-of-core store keeping the live particle set within a budget by spilling the excess to disk
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_PARTICLE_SPILL_H
+#define PHYSICS_SIMULATION_PROGRAM_PARTICLE_SPILL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/tracing/memory_accounting.h"
+#include "particles/particle.h"
+
+// ParticleSpill
+//
+// Notes on initialisation:
+//   - The budget starts at config::program::liveParticleBudget (0 -> unbounded, nothing is spilled); the I/O thread
+//     and the spill file (config::paths::spillDirectory, one uniquely named file per store) are only created on the
+//     first spill, and the file is deleted on destruction
+//   - Spilled particles must be of a type in the particle database, as they are rebuilt through its constructors
+//
+// Notes on algorithms:
+//   - balance() runs once per stepAll with exclusive access to the live set. Above the budget the excess is handed to
+//     the I/O thread, oldest first (the front of the live set) or lowest priority first if setPriority() was called;
+//     below it, spilled particles are moved back oldest spill first
+//   - The I/O thread encodes particles into pages of up to config::program::spillPageParticles records (a per-page
+//     table of type constants followed by compact per-particle state in SI doubles), appends them to the file and
+//     frees the particles. While the live set has room it reads the next pages ahead, so a reload normally takes
+//     particles decoded during the previous stepAll and never waits for the disk
+//   - Batches still queued for writing when room appears are handed back without touching the disk, and the file is
+//     rewritten from the start whenever every page has been read back
+//   - balance() blocks only when the I/O thread has more than max(budget, page size) particles queued for writing
+//     (back-pressure), or when the live set is empty and spilled particles remain (so stepping always progresses)
+//   - A reloaded particle keeps the time it was spilled at and catches up to the clock in its next stepAll;
+//     stepParticle() steps any particle from its own time, so only the order of detector records changes
+//   - The budget is enforced at the end of stepAll; secondaries produced within one stepAll may exceed it briefly
+//   - Errors on the I/O thread are rethrown by the next balance()
+//
+// Supported overloads / operations and functions / methods:
+//   - Balancing:              balance()
+//   - Budget:                 budget(), setBudget(), setPriority()
+//   - Spilled set:            size(), empty(), clear()
+//
+// Example usage:
+//   context.spill().setBudget(1'000'000);
+//   context.spill().setPriority([](const Particle& particle) { return particle.getEnergy().value; });
+//   stepUntilEmpty(context, detector, Quantity(1e-13, "s")); // Runs until both the live and the spilled set are empty
+class ParticleSpill {
+    public:
+        using Priority = std::function<double(const Particle&)>; // Lower values are spilled first
+
+        ParticleSpill();
+        ~ParticleSpill();
+
+        ParticleSpill(const ParticleSpill&) = delete;
+        ParticleSpill& operator=(const ParticleSpill&) = delete;
+
+        // Balance method
+        //
+        // Spill live particles above the budget or reload spilled particles into the room below it; callers must hold
+        // the live set exclusively
+        void balance(std::vector<std::unique_ptr<Particle>>& live);
+
+        // Budget methods
+        [[nodiscard]] std::size_t budget() const noexcept { return this->m_budget.load(std::memory_order_relaxed); }
+        void setBudget(std::size_t budget) noexcept; // 0 -> unbounded; spilled particles are still reloaded
+        void setPriority(Priority priority);         // Empty -> oldest first; set during setup, not while stepping
+
+        // Spilled set methods
+        //
+        // Particles held outside the live set (queued, on disk or read ahead); clear() discards them all
+        [[nodiscard]] std::size_t size() const noexcept { return this->m_held.load(std::memory_order_acquire); }
+        [[nodiscard]] bool empty() const noexcept { return this->size() == 0; }
+        void clear();
+
+    private:
+        struct Page {
+            std::uint64_t offset = 0;
+            std::uint64_t bytes = 0;
+            std::size_t particles = 0;
+        };
+
+        std::atomic<std::size_t> m_budget;
+        std::atomic<std::size_t> m_held{0};
+        Priority m_priority;
+
+        // Shared with the I/O thread, guarded by m_mutex
+        std::mutex m_mutex;
+        std::condition_variable m_wake;  // I/O thread: work queued, read-ahead wanted or stopping
+        std::condition_variable m_ready; // balance()/clear(): a batch was written or a page read
+        std::deque<std::vector<std::unique_ptr<Particle>>> m_writeQueue;
+        std::size_t m_unwritten = 0;     // Particles in m_writeQueue and in the batch being written
+        std::deque<Page> m_pages;        // On disk, oldest first
+        std::vector<std::unique_ptr<Particle>> m_readAhead;
+        std::size_t m_wanted = 0;        // Read ahead while m_readAhead holds fewer particles than this
+        bool m_writing = false;
+        bool m_reading = false;
+        bool m_stopping = false;
+        std::exception_ptr m_error;
+        std::thread m_thread;
+
+        // Owned by the I/O thread
+        std::filesystem::path m_path;
+        std::fstream m_file;
+        std::uint64_t m_fileEnd = 0;
+        std::vector<std::byte> m_buffer;
+        memory_accounting::TrackedBytes m_bufferMemory{memory_accounting::Category::SpillPages};
+
+        void run();
+        void writeBatch(std::vector<std::unique_ptr<Particle>>& batch, std::vector<Page>& written);
+        void readPage(const Page& page, std::vector<std::unique_ptr<Particle>>& particles);
+        std::vector<std::unique_ptr<Particle>> takeExcess(std::vector<std::unique_ptr<Particle>>& live, std::size_t count) const;
+        void reloadInto(std::vector<std::unique_ptr<Particle>>& live, std::size_t room); // Callers must hold m_mutex
+        void rethrowError() const; // Callers must hold m_mutex
+};
+
+#endif //PHYSICS_SIMULATION_PROGRAM_PARTICLE_SPILL_H
@@ -17,9 +17,12 @@
 #include <cstddef>
 #include <format>
 #include <random>
+#include <limits>
 #include <stdexcept>
+#include <vector>
 
 #include "constants/maths.h"
+#include "core/maths/vector_math.h"
 #include "core/quantities/units.h"
 #include "core/random/random_manager.h"
 
@@ -85,8 +88,9 @@ Vector<3> sampleIsotropicDirection() {
     const double cosTheta = cosineDistribution(engine);
     const double sinTheta = std::sqrt(std::max(0.0, 1.0 - cosTheta * cosTheta)); // Derive from cos(Θ) to preserve unit length
     const double phi = azimuthalDistribution(engine);
-    const double sinPhi = std::sin(phi);
-    const double cosPhi = std::cos(phi);
+    double sinPhi = 0.0;
+    double cosPhi = 0.0;
+    vector_math::sincos(phi, sinPhi, cosPhi);
 
     const double x = sinTheta * cosPhi;
     const double y = sinTheta * sinPhi;
@@ -98,3 +102,42 @@ Vector<3> sampleIsotropicDirection() {
         Quantity::dimensionless(z)
     };
 }
+
+void sampleExponentialVariates(const std::span<double> values, const random_manager::Stream stream) {
+    auto& engine = random_manager::engine(stream);
+    std::uniform_real_distribution uniform(0.0, 1.0);
+    for (auto& value : values) {
+        value = std::clamp(uniform(engine), std::numeric_limits<double>::min(), 1.0 - std::numeric_limits<double>::epsilon());
+    }
+    vector_math::log(values, values);
+    for (auto& value : values) {
+        value = -value;
+    }
+}
+
+void sampleIsotropicDirections(const std::span<Vector<3>> directions) {
+    auto& engine = random_manager::engine(random_manager::Stream::SourceSampling);
+    std::uniform_real_distribution cosineDistribution(-1.0, 1.0);
+    std::uniform_real_distribution azimuthalDistribution(0.0, 2.0 * constants::math::pi);
+
+    const std::size_t count = directions.size();
+    std::vector<double> cosTheta(count);
+    std::vector<double> sinPhi(count);
+    std::vector<double> cosPhi(count);
+    for (auto& value : cosTheta) {
+        value = cosineDistribution(engine);
+    }
+    for (auto& value : sinPhi) {
+        value = azimuthalDistribution(engine);
+    }
+    vector_math::sincos(sinPhi, sinPhi, cosPhi); // Azimuths are overwritten by their sines
+
+    for (std::size_t n = 0; n < count; ++n) {
+        const double sinTheta = std::sqrt(std::max(0.0, 1.0 - cosTheta[n] * cosTheta[n]));
+        directions[n] = {
+            Quantity::dimensionless(sinTheta * cosPhi[n]),
+            Quantity::dimensionless(sinTheta * sinPhi[n]),
+            Quantity::dimensionless(cosTheta[n])
+        };
+    }
+}
@@ -13,8 +13,11 @@
 #ifndef PHYSICS_SIMULATION_PROGRAM_DISTRIBUTIONS_H
 #define PHYSICS_SIMULATION_PROGRAM_DISTRIBUTIONS_H
 
+#include <span>
+
 #include "core/linear-algebra/vector.h"
 #include "core/quantities/quantity.h"
+#include "core/random/random_manager.h"
 
 // Velocity sampler from temperature
 //
@@ -49,6 +52,7 @@
 //   - Theta is measured from +z and φ from +x in the x-y plane; sampling cos(Θ) directly ensures the polar angle
 //     density matches the surface area element (sin(Θ) dΘ dφ)
 //   - Phi (azimuth) is sampled uniformly over a full revolution [0, 2π) so every rotation around +z is equally likely
+//   - sin(φ) and cos(φ) come from one vector_math::sincos() reduction
 //
 // Notes on output:
 //   - Returns a Vector<3> whose components are all dimensionless and whose magnitude is 1 (within floating precision)
@@ -59,4 +63,40 @@
 // Example usage: TODO
 [[nodiscard]] Vector<3> sampleIsotropicDirection();
 
+
+// Exponential variates batch sampler
+//
+// Fills values with unit-mean exponential variates -log(u), the form of every optical depth and decay time draw
+//
+// Notes on algorithms:
+//   - Draws every u from the stream first, clamped to (0, 1) like random_manager::exponentialVariate(), then takes the
+//     logarithms in one vector_math::log() batch
+//
+// Parameters:
+//   - values - the span to fill
+//   - stream - the random stream to draw from (with the thread's stream index)
+//
+// Example usage:
+//   std::array<double, 256> depths{};
+//   sampleExponentialVariates(depths, random_manager::Stream::DiscreteInteractions);
+void sampleExponentialVariates(std::span<double> values, random_manager::Stream stream);
+
+
+// Isotropic directions batch sampler
+//
+// Fills directions with unit vectors uniformly distributed over the surface of a sphere, as sampleIsotropicDirection()
+//
+// Notes on algorithms:
+//   - Draws every cos(Θ) and then every φ from the SourceSampling stream, then takes the sines and cosines in one
+//     vector_math::sincos() batch; the draw order differs from repeated sampleIsotropicDirection() calls, so the same
+//     seed gives different (equally distributed) directions
+//
+// Parameters:
+//   - directions - the span to fill
+//
+// Example usage:
+//   std::vector<Vector<3>> directions(1024);
+//   sampleIsotropicDirections(directions);
+void sampleIsotropicDirections(std::span<Vector<3>> directions);
+
 #endif //PHYSICS_SIMULATION_PROGRAM_DISTRIBUTIONS_H
\ No newline at end of file
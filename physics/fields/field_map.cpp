@@ -0,0 +1,381 @@
+//
+// Physics Simulation Program
+// File: field_map.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of field_map.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "physics/fields/field_map.h"
+
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    constexpr std::array k_magic{'P', 'S', 'F', 'M'};
+    constexpr std::uint16_t k_fileVersion = 1;
+    constexpr std::size_t k_headerBytes = 4 + 2 + 1 + 3 * 4 + 2 * 3 * 8; // Unpadded, as laid out in field_map.h
+    constexpr Unit k_teslaUnit{0, 1, -2, -1, 0, 0, 0}; // kg s^-2 A^-1
+
+    // Catmull-Rom weights for the 4 nodes surrounding a cell given the fractional position t in [0, 1)
+    constexpr std::array<double, 4> catmullRomWeights(const double t) noexcept {
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+        return {
+            0.5 * (-t3 + 2.0 * t2 - t),
+            0.5 * (3.0 * t3 - 5.0 * t2 + 2.0),
+            0.5 * (-3.0 * t3 + 4.0 * t2 + t),
+            0.5 * (t3 - t2)
+        };
+    }
+
+    // Neighbour node indices for a Catmull-Rom stencil around a cell
+    //
+    // Stencil nodes beyond the grid edge are linearly extrapolated ghosts (2 f_edge - f_inner); their weights are folded
+    // onto the real nodes so evaluation only ever reads inside the grid and keeps second order accuracy at the edges
+    void foldEdgeWeights(
+        const std::size_t cell,
+        const std::size_t nodeCount,
+        std::array<double, 4>& weights,
+        std::array<std::size_t, 4>& indices) noexcept
+    {
+        indices = {cell == 0 ? 0 : cell - 1, cell, cell + 1, cell + 2};
+        if (cell == 0) {
+            weights[1] += 2.0 * weights[0];
+            weights[2] -= weights[0];
+            weights[0] = 0.0;
+            indices[0] = cell;
+        }
+        if (cell + 2 >= nodeCount) {
+            weights[2] += 2.0 * weights[3];
+            weights[1] -= weights[3];
+            weights[3] = 0.0;
+            indices[3] = cell + 1;
+        }
+    }
+
+    // Locate the cell containing a coordinate along one axis and return the fractional position within it
+    //
+    // Points exactly on the upper face belong to the last cell so the grid is closed on both sides
+    std::size_t locateCell(
+        const double coordinate,
+        const double origin,
+        const double inverseSpacing,
+        const std::size_t nodeCount,
+        double& fraction) noexcept
+    {
+        const double scaled = (coordinate - origin) * inverseSpacing;
+        const auto lastCell = nodeCount - 2;
+        auto cell = static_cast<std::size_t>(scaled);
+        if (cell > lastCell) {
+            cell = lastCell;
+        }
+        fraction = scaled - static_cast<double>(cell);
+        return cell;
+    }
+}
+
+FieldMap::FieldMap(
+    const Vector<3>& lowerCorner,
+    const Vector<3>& upperCorner,
+    const std::array<std::size_t, 3>& nodeCounts,
+    const FieldInterpolation interpolation)
+    : m_nodeCounts(nodeCounts), m_interpolation(interpolation)
+{
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        if (lowerCorner[axis].unit != Unit::lengthDimension() || upperCorner[axis].unit != Unit::lengthDimension()) {
+            throw std::invalid_argument("FieldMap corners must have length dimensions");
+        }
+        if (nodeCounts[axis] < 2) {
+            throw std::invalid_argument(std::format(
+                "FieldMap requires at least 2 nodes per axis but axis {} has {}",
+                axis,
+                nodeCounts[axis]
+            ));
+        }
+        const double extent = upperCorner[axis].asDouble() - lowerCorner[axis].asDouble();
+        if (!(extent > 0.0)) {
+            throw std::invalid_argument(std::format(
+                "FieldMap upper corner must exceed lower corner on axis {} (extent = {} m)",
+                axis,
+                extent
+            ));
+        }
+        this->m_origin[axis] = lowerCorner[axis].asDouble();
+        this->m_spacing[axis] = extent / static_cast<double>(nodeCounts[axis] - 1);
+        this->m_inverseSpacing[axis] = 1.0 / this->m_spacing[axis];
+    }
+    this->m_values.assign(3 * nodeCounts[0] * nodeCounts[1] * nodeCounts[2], 0.0f);
+}
+
+FieldMap FieldMap::loadFromBinary(const std::string& filepath) {
+    std::ifstream in(filepath, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error(std::format("Cannot open field map file '{}'", filepath));
+    }
+    std::vector<std::byte> bytes(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!in) {
+        throw std::runtime_error(std::format("Failed reading field map file '{}'", filepath));
+    }
+    return fromBytes(bytes, filepath);
+}
+
+FieldMap FieldMap::fromBytes(const std::span<const std::byte> bytes, const std::string_view source) {
+    std::size_t cursor = 0;
+    const auto read = [&](auto& value) {
+        if (bytes.size() - cursor < sizeof(value)) {
+            return false;
+        }
+        std::memcpy(&value, bytes.data() + cursor, sizeof(value));
+        cursor += sizeof(value);
+        return true;
+    };
+
+    std::array<char, 4> magic{};
+    std::uint16_t version = 0;
+    std::uint8_t interpolation = 0;
+    if (!read(magic) || magic != k_magic) {
+        throw std::runtime_error(std::format("'{}' is not a field map", source));
+    }
+    if (!read(version) || version != k_fileVersion) {
+        throw std::runtime_error(std::format(
+            "Unsupported field map version {} in '{}' (expected {})",
+            version,
+            source,
+            k_fileVersion
+        ));
+    }
+    if (!read(interpolation) || interpolation > static_cast<std::uint8_t>(FieldInterpolation::Tricubic)) {
+        throw std::runtime_error(std::format("Invalid interpolation scheme in field map '{}'", source));
+    }
+
+    std::array<std::uint32_t, 3> counts{};
+    std::array<double, 3> origin{};
+    std::array<double, 3> spacing{};
+    if (!read(counts) || !read(origin) || !read(spacing)) {
+        throw std::runtime_error(std::format("Unexpected EOF reading field map header in '{}'", source));
+    }
+
+    Vector<3> lower;
+    Vector<3> upper;
+    std::array<std::size_t, 3> nodeCounts{};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        nodeCounts[axis] = counts[axis];
+        lower[axis] = Quantity(origin[axis], Unit::lengthDimension());
+        upper[axis] = Quantity(
+            origin[axis] + spacing[axis] * static_cast<double>(counts[axis] - 1),
+            Unit::lengthDimension()
+        );
+    }
+
+    FieldMap map(lower, upper, nodeCounts, static_cast<FieldInterpolation>(interpolation));
+    map.m_spacing = spacing; // Avoid round-off from recomputing the spacing
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        map.m_inverseSpacing[axis] = 1.0 / spacing[axis];
+    }
+
+    const auto valueBytes = map.m_values.size() * sizeof(float);
+    if (bytes.size() - cursor < valueBytes) {
+        throw std::runtime_error(std::format("Unexpected EOF reading field map values in '{}'", source));
+    }
+    std::memcpy(map.m_values.data(), bytes.data() + cursor, valueBytes);
+    return map;
+}
+
+void FieldMap::saveToBinary(const std::string& filepath) const {
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error(std::format("Cannot open file '{}'", filepath));
+    }
+
+    const auto bytes = this->toBytes();
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!out) {
+        throw std::runtime_error(std::format("Failed writing field map '{}'", filepath));
+    }
+}
+
+std::vector<std::byte> FieldMap::toBytes() const {
+    std::vector<std::byte> bytes;
+    bytes.reserve(k_headerBytes + this->m_values.size() * sizeof(float));
+    const auto append = [&bytes](const void* data, const std::size_t size) {
+        const auto* first = static_cast<const std::byte*>(data);
+        bytes.insert(bytes.end(), first, first + size);
+    };
+
+    const auto interpolation = static_cast<std::uint8_t>(this->m_interpolation);
+    const std::array counts{
+        static_cast<std::uint32_t>(this->m_nodeCounts[0]),
+        static_cast<std::uint32_t>(this->m_nodeCounts[1]),
+        static_cast<std::uint32_t>(this->m_nodeCounts[2])
+    };
+    append(k_magic.data(), sizeof(k_magic));
+    append(&k_fileVersion, sizeof(k_fileVersion));
+    append(&interpolation, sizeof(interpolation));
+    append(counts.data(), sizeof(counts));
+    append(this->m_origin.data(), sizeof(this->m_origin));
+    append(this->m_spacing.data(), sizeof(this->m_spacing));
+    append(this->m_values.data(), this->m_values.size() * sizeof(float));
+    return bytes;
+}
+
+Vector<3> FieldMap::getLowerCorner() const {
+    return Vector<3>(this->m_origin, Unit::lengthDimension());
+}
+
+Vector<3> FieldMap::getUpperCorner() const {
+    std::array<double, 3> upper{};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        upper[axis] = this->m_origin[axis] + this->m_spacing[axis] * static_cast<double>(this->m_nodeCounts[axis] - 1);
+    }
+    return Vector<3>(upper, Unit::lengthDimension());
+}
+
+std::array<double, 3> FieldMap::getNode(const std::size_t i, const std::size_t j, const std::size_t k) const {
+    if (i >= this->m_nodeCounts[0] || j >= this->m_nodeCounts[1] || k >= this->m_nodeCounts[2]) {
+        throw std::out_of_range(std::format("FieldMap node ({}, {}, {}) out of range", i, j, k));
+    }
+    const auto offset = this->nodeOffset(i, j, k);
+    return {this->m_values[offset], this->m_values[offset + 1], this->m_values[offset + 2]};
+}
+
+void FieldMap::setNode(const std::size_t i, const std::size_t j, const std::size_t k, const std::array<double, 3>& field) {
+    if (i >= this->m_nodeCounts[0] || j >= this->m_nodeCounts[1] || k >= this->m_nodeCounts[2]) {
+        throw std::out_of_range(std::format("FieldMap node ({}, {}, {}) out of range", i, j, k));
+    }
+    const auto offset = this->nodeOffset(i, j, k);
+    this->m_values[offset] = static_cast<float>(field[0]);
+    this->m_values[offset + 1] = static_cast<float>(field[1]);
+    this->m_values[offset + 2] = static_cast<float>(field[2]);
+}
+
+bool FieldMap::contains(const double x, const double y, const double z) const noexcept {
+    if (this->m_values.empty()) {
+        return false;
+    }
+    const std::array point{x, y, z};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double scaled = (point[axis] - this->m_origin[axis]) * this->m_inverseSpacing[axis];
+        if (!(scaled >= 0.0) || scaled > static_cast<double>(this->m_nodeCounts[axis] - 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FieldMap::evaluate(const double x, const double y, const double z, std::array<double, 3>& field) const noexcept {
+    if (!this->contains(x, y, z)) {
+        return false;
+    }
+    if (this->m_interpolation == FieldInterpolation::Tricubic) {
+        this->evaluateTricubic(x, y, z, field);
+    } else {
+        this->evaluateTrilinear(x, y, z, field);
+    }
+    return true;
+}
+
+std::optional<Vector<3>> FieldMap::evaluate(const Vector<3>& worldPoint) const {
+    std::array<double, 3> field{};
+    if (!this->evaluate(worldPoint[0].asDouble(), worldPoint[1].asDouble(), worldPoint[2].asDouble(), field)) {
+        return std::nullopt;
+    }
+    return Vector<3>(field, k_teslaUnit);
+}
+
+void FieldMap::evaluateBatch(
+    const std::span<const Vector<3>> worldPoints,
+    const std::span<Vector<3>> fields,
+    const Vector<3>& fallback) const
+{
+    if (fields.size() < worldPoints.size()) {
+        throw std::invalid_argument(std::format(
+            "FieldMap batch output holds {} fields but {} points were supplied",
+            fields.size(),
+            worldPoints.size()
+        ));
+    }
+    std::array<double, 3> field{};
+    for (std::size_t n = 0; n < worldPoints.size(); ++n) {
+        const auto& point = worldPoints[n];
+        if (this->evaluate(point[0].asDouble(), point[1].asDouble(), point[2].asDouble(), field)) {
+            fields[n] = Vector<3>(field, k_teslaUnit);
+        } else {
+            fields[n] = fallback;
+        }
+    }
+}
+
+void FieldMap::evaluateTrilinear(const double x, const double y, const double z, std::array<double, 3>& field) const noexcept {
+    double fx = 0.0;
+    double fy = 0.0;
+    double fz = 0.0;
+    const auto i = locateCell(x, this->m_origin[0], this->m_inverseSpacing[0], this->m_nodeCounts[0], fx);
+    const auto j = locateCell(y, this->m_origin[1], this->m_inverseSpacing[1], this->m_nodeCounts[1], fy);
+    const auto k = locateCell(z, this->m_origin[2], this->m_inverseSpacing[2], this->m_nodeCounts[2], fz);
+
+    const std::size_t strideY = 3 * this->m_nodeCounts[0];
+    const std::size_t strideZ = strideY * this->m_nodeCounts[1];
+    const float* base = this->m_values.data() + this->nodeOffset(i, j, k);
+
+    const double wx[2] = {1.0 - fx, fx};
+    const double wy[2] = {1.0 - fy, fy};
+    const double wz[2] = {1.0 - fz, fz};
+
+    field = {0.0, 0.0, 0.0};
+    for (std::size_t dk = 0; dk < 2; ++dk) {
+        for (std::size_t dj = 0; dj < 2; ++dj) {
+            const float* row = base + dk * strideZ + dj * strideY;
+            const double wyz = wy[dj] * wz[dk];
+            for (std::size_t di = 0; di < 2; ++di) {
+                const double weight = wx[di] * wyz;
+                field[0] += weight * row[3 * di];
+                field[1] += weight * row[3 * di + 1];
+                field[2] += weight * row[3 * di + 2];
+            }
+        }
+    }
+}
+
+void FieldMap::evaluateTricubic(const double x, const double y, const double z, std::array<double, 3>& field) const noexcept {
+    double fx = 0.0;
+    double fy = 0.0;
+    double fz = 0.0;
+    const auto i = locateCell(x, this->m_origin[0], this->m_inverseSpacing[0], this->m_nodeCounts[0], fx);
+    const auto j = locateCell(y, this->m_origin[1], this->m_inverseSpacing[1], this->m_nodeCounts[1], fy);
+    const auto k = locateCell(z, this->m_origin[2], this->m_inverseSpacing[2], this->m_nodeCounts[2], fz);
+
+    auto wx = catmullRomWeights(fx);
+    auto wy = catmullRomWeights(fy);
+    auto wz = catmullRomWeights(fz);
+
+    std::array<std::size_t, 4> xs{};
+    std::array<std::size_t, 4> ys{};
+    std::array<std::size_t, 4> zs{};
+    foldEdgeWeights(i, this->m_nodeCounts[0], wx, xs);
+    foldEdgeWeights(j, this->m_nodeCounts[1], wy, ys);
+    foldEdgeWeights(k, this->m_nodeCounts[2], wz, zs);
+
+    field = {0.0, 0.0, 0.0};
+    for (std::size_t dk = 0; dk < 4; ++dk) {
+        for (std::size_t dj = 0; dj < 4; ++dj) {
+            const double wyz = wy[dj] * wz[dk];
+            for (std::size_t di = 0; di < 4; ++di) {
+                const double weight = wx[di] * wyz;
+                const float* node = this->m_values.data() + this->nodeOffset(xs[di], ys[dj], zs[dk]);
+                field[0] += weight * node[0];
+                field[1] += weight * node[1];
+                field[2] += weight * node[2];
+            }
+        }
+    }
+}
@@ -0,0 +1,189 @@
+//
+// Physics Simulation Program
+// File: field_map.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes precomputed magnetic field maps sampled on a regular 3D grid
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_FIELD_MAP_H
+#define PHYSICS_SIMULATION_PROGRAM_FIELD_MAP_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/linear-algebra/vector.h"
+
+// Interpolation schemes available for field map evaluation
+enum class FieldInterpolation : std::uint8_t {
+    Trilinear = 0,
+    Tricubic = 1
+};
+
+// FieldMap
+//
+// Stores a magnetic flux density B sampled on a regular, axis-aligned 3D grid in world coordinates and evaluates it at
+// arbitrary points by interpolation
+//
+// Notes on initialisation:
+//   - Constructed from the lower and upper corners of the grid (length dimensions) and the number of nodes per axis
+//         -> Every axis requires at least 2 nodes so a cell exists to interpolate in
+//   - fromFunction() fills the grid by evaluating a callable at every node; the callable receives SI coordinates (m)
+//     and returns the field components in T
+//   - loadFromBinary() reads a map previously written by saveToBinary(); fromBytes() and toBytes() do the same for an
+//     in-memory copy of the file (e.g. a table_cache blob)
+//
+// Notes on algorithms:
+//   - Node values are stored as interleaved float triplets (Bx, By, Bz) in x-fastest order so the 8 (trilinear) or 64
+//     (tricubic) nodes touched by an evaluation sit in a handful of cache lines; arithmetic is done in double
+//   - Trilinear interpolation is exact for piecewise linear fields and costs 8 node reads
+//   - Tricubic interpolation uses Catmull-Rom weights over a 4x4x4 neighbourhood (linear extrapolation past the grid edge) and
+//     is C1 continuous across cells which matters for gradient-sensitive (e.g. spin precession) calculations
+//   - evaluate() on raw doubles performs no unit handling or allocation and is intended for hot loops; the Vector<3>
+//     overloads wrap it with dimension handling
+//   - Points outside the grid are reported as not evaluable so callers can fall back to another field model
+//
+// Notes on output:
+//   - Field values are returned in T (Vector<3> with magnetic flux density dimensions)
+//
+// Binary file layout:
+//   [ char[4] magic "PSFM" ]
+//   [ uint16_t version ]
+//   [ uint8_t interpolation ]
+//   [ uint32_t nodeCount[3] ]
+//   [ double origin[3] ]                    // m
+//   [ double spacing[3] ]                   // m
+//   [ float values[nx * ny * nz * 3] ]      // T, interleaved (Bx, By, Bz), x fastest
+//
+// Supported overloads / operations and functions / methods:
+//   - Constructor:            FieldMap(), FieldMap::fromFunction()
+//   - Load/save:              FieldMap::loadFromBinary(), saveToBinary(), FieldMap::fromBytes(), toBytes()
+//   - Getters:                get_____() (NodeCounts, LowerCorner, UpperCorner, Interpolation, Node, NodePosition,
+//                                         MemoryFootprint)
+//   - Setters:                set_____() (Interpolation, Node)
+//   - Containment check:      contains()
+//   - Evaluation:             evaluate(), evaluateBatch()
+//
+// Example usage:
+//   auto map = FieldMap::fromFunction(
+//       Vector<3>({-1.5, -1.5, -1.5}, "mm"),
+//       Vector<3>({1.5, 1.5, 1.5}, "mm"),
+//       {33, 33, 33},
+//       [](double x, double y, double z) { return std::array{0.0, 0.0, 1e-6 * (1.0 + x)}; });
+//   map.saveToBinary("vapour_cell.fieldmap");
+//   const auto field = map.evaluate(Vector<3>({0.0, 0.0, 0.0}, "mm")); // std::optional<Vector<3>> in T
+class FieldMap {
+    public:
+        FieldMap() = default;
+
+        // Constructor for an empty (zero field) grid
+        FieldMap(
+            const Vector<3>& lowerCorner,
+            const Vector<3>& upperCorner,
+            const std::array<std::size_t, 3>& nodeCounts,
+            FieldInterpolation interpolation = FieldInterpolation::Trilinear);
+
+        // Constructor filling the grid from a callable returning std::array<double, 3> (T) for SI coordinates (m)
+        template<typename Callable>
+        [[nodiscard]] static FieldMap fromFunction(
+            const Vector<3>& lowerCorner,
+            const Vector<3>& upperCorner,
+            const std::array<std::size_t, 3>& nodeCounts,
+            Callable&& fieldAt,
+            const FieldInterpolation interpolation = FieldInterpolation::Trilinear)
+        {
+            FieldMap map(lowerCorner, upperCorner, nodeCounts, interpolation);
+            for (std::size_t k = 0; k < map.m_nodeCounts[2]; ++k) {
+                const double z = map.m_origin[2] + static_cast<double>(k) * map.m_spacing[2];
+                for (std::size_t j = 0; j < map.m_nodeCounts[1]; ++j) {
+                    const double y = map.m_origin[1] + static_cast<double>(j) * map.m_spacing[1];
+                    for (std::size_t i = 0; i < map.m_nodeCounts[0]; ++i) {
+                        const double x = map.m_origin[0] + static_cast<double>(i) * map.m_spacing[0];
+                        map.setNode(i, j, k, fieldAt(x, y, z));
+                    }
+                }
+            }
+            return map;
+        }
+
+        // Load from binary method
+        [[nodiscard]] static FieldMap loadFromBinary(const std::string& filepath);
+
+        // Save to binary method
+        void saveToBinary(const std::string& filepath) const;
+
+        // Byte serialisation methods
+        //
+        // Same layout as the binary file; source names the bytes in error messages
+        [[nodiscard]] static FieldMap fromBytes(std::span<const std::byte> bytes, std::string_view source);
+        [[nodiscard]] std::vector<std::byte> toBytes() const;
+
+        // Getters
+        [[nodiscard]] constexpr const std::array<std::size_t, 3>& getNodeCounts() const noexcept { return this->m_nodeCounts; }
+        [[nodiscard]] Vector<3> getLowerCorner() const;
+        [[nodiscard]] Vector<3> getUpperCorner() const;
+        [[nodiscard]] constexpr FieldInterpolation getInterpolation() const noexcept { return this->m_interpolation; }
+        [[nodiscard]] std::array<double, 3> getNode(std::size_t i, std::size_t j, std::size_t k) const;
+        [[nodiscard]] std::array<double, 3> getNodePosition(std::size_t i, std::size_t j, std::size_t k) const noexcept {
+            return {
+                this->m_origin[0] + static_cast<double>(i) * this->m_spacing[0],
+                this->m_origin[1] + static_cast<double>(j) * this->m_spacing[1],
+                this->m_origin[2] + static_cast<double>(k) * this->m_spacing[2]
+            };
+        }
+        [[nodiscard]] std::size_t getMemoryFootprint() const noexcept { return this->m_values.capacity() * sizeof(float); }
+
+        // Setters
+        constexpr void setInterpolation(const FieldInterpolation interpolation) noexcept { this->m_interpolation = interpolation; }
+        void setNode(std::size_t i, std::size_t j, std::size_t k, const std::array<double, 3>& field);
+
+        // Containment check method
+        //
+        // Check a point (SI coordinates) lies within the sampled grid
+        [[nodiscard]] bool contains(double x, double y, double z) const noexcept;
+
+        // Evaluation method
+        //
+        // Interpolate the field (T) at SI coordinates; returns false and leaves field untouched if outside the grid
+        [[nodiscard]] bool evaluate(double x, double y, double z, std::array<double, 3>& field) const noexcept;
+
+        // Evaluation method
+        //
+        // Interpolate the field at a world point; std::nullopt if outside the grid
+        [[nodiscard]] std::optional<Vector<3>> evaluate(const Vector<3>& worldPoint) const;
+
+        // Batched evaluation method
+        //
+        // Interpolate the field for a basket of points; points outside the grid receive the fallback value
+        void evaluateBatch(
+            std::span<const Vector<3>> worldPoints,
+            std::span<Vector<3>> fields,
+            const Vector<3>& fallback) const;
+
+    private:
+        std::array<double, 3> m_origin{};
+        std::array<double, 3> m_spacing{};
+        std::array<double, 3> m_inverseSpacing{};
+        std::array<std::size_t, 3> m_nodeCounts{};
+        FieldInterpolation m_interpolation = FieldInterpolation::Trilinear;
+        std::vector<float> m_values;
+
+        [[nodiscard]] std::size_t nodeOffset(std::size_t i, std::size_t j, std::size_t k) const noexcept {
+            return 3 * (i + this->m_nodeCounts[0] * (j + this->m_nodeCounts[1] * k));
+        }
+
+        void evaluateTrilinear(double x, double y, double z, std::array<double, 3>& field) const noexcept;
+        void evaluateTricubic(double x, double y, double z, std::array<double, 3>& field) const noexcept;
+};
+
+#endif //PHYSICS_SIMULATION_PROGRAM_FIELD_MAP_H
@@ -12,21 +12,117 @@
 
 #include "physics/fields/field_solver.h"
 
+#include <array>
+#include <format>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
 #include "constants/physics.h"
 #include "databases/material-data/material_database.h"
 #include "objects/object_manager.h"
 
-auto g_BFieldStrength = Vector<3>{{0.0, 0.0, 1.0},"T"};
-auto g_HFieldStrength = g_BFieldStrength / constants::physics::mu0;
+Vector<3> g_BFieldStrength = Vector<3>{{0.0, 0.0, 1.0},"T"};
+Vector<3> g_HFieldStrength = g_BFieldStrength / constants::physics::mu0;
+
+namespace {
+    std::unordered_map<const Object*, std::shared_ptr<const FieldMap>> g_fieldMaps;
+
+    // Resolve the field at a point already located in a medium without using the volume cache
+    Vector<3> resolveFieldInMedium(const Object* medium, const Vector<3>& point) {
+        if (!medium) {
+            return g_BFieldStrength;
+        }
+        if (!g_fieldMaps.empty()) {
+            std::array<double, 3> field{};
+            for (auto region = medium; region; region = region->getParent()) {
+                if (const auto map = findFieldMap(region);
+                    map && map->evaluate(point[0].asDouble(), point[1].asDouble(), point[2].asDouble(), field))
+                {
+                    return Vector<3>(field, g_BFieldStrength[0].unit);
+                }
+            }
+        }
+        return g_BFieldStrength * g_materialDatabase.getRelativePermeability(medium->getMaterial());
+    }
+
+    // A volume is uniform unless it or an ancestor has a field map, since maps cover every descendant of their region
+    bool coveredByFieldMap(const Object* volume) noexcept {
+        for (auto region = volume; region; region = region->getParent()) {
+            if (findFieldMap(region)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+void attachFieldMap(const Object* region, std::shared_ptr<const FieldMap> map) {
+    if (!region) {
+        throw std::invalid_argument("Cannot attach a field map to a null region");
+    }
+    if (!map) {
+        throw std::invalid_argument(std::format("Cannot attach a null field map to '{}'", region->getName()));
+    }
+    g_fieldMaps[region] = std::move(map);
+}
+
+void detachFieldMap(const Object* region) {
+    g_fieldMaps.erase(region);
+}
+
+void clearFieldMaps() noexcept {
+    g_fieldMaps.clear();
+}
+
+const FieldMap* findFieldMap(const Object* object) noexcept {
+    const auto it = g_fieldMaps.find(object);
+    return it == g_fieldMaps.end() ? nullptr : it->second.get();
+}
+
+void cacheVolumeFields(Object* root) {
+    cacheVolumeFields(root, g_BFieldStrength);
+}
+
+void cacheVolumeFields(Object* root, const Vector<3>& backgroundField) {
+    if (!root) {
+        return;
+    }
+    const bool uniform = !coveredByFieldMap(root);
+    root->setCachedField(
+        backgroundField * g_materialDatabase.getRelativePermeability(root->getMaterial()),
+        uniform
+    );
+    for (const auto& child : root->getChildren()) {
+        cacheVolumeFields(child.get(), backgroundField);
+    }
+}
+
+Vector<3> getFieldInMedium(const Object* medium, const Vector<3>& point) {
+    if (medium && medium->hasUniformField()) {
+        return medium->getCachedField();
+    }
+    return resolveFieldInMedium(medium, point);
+}
 
 Vector<3> getFieldAtPoint(const Vector<3>& point) {
     const auto root = g_objectManager.getActiveWorld();
     if (!root) {
         return g_BFieldStrength;
     }
-    const auto obj = root->findObjectContaining(point);
-    if (!obj) {
-        return g_BFieldStrength;
+    return getFieldInMedium(root->findObjectContaining(point), point);
+}
+
+void getFieldAtPoints(const std::span<const Vector<3>> points, const std::span<Vector<3>> fields) {
+    if (fields.size() < points.size()) {
+        throw std::invalid_argument(std::format(
+            "Field output holds {} fields but {} points were supplied",
+            fields.size(),
+            points.size()
+        ));
+    }
+    const auto root = g_objectManager.getActiveWorld();
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        fields[i] = root ? getFieldInMedium(root->findObjectContaining(points[i]), points[i]) : g_BFieldStrength;
     }
-    return g_BFieldStrength * g_materialDatabase.getRelativePermeability(obj->getMaterial());
 }
@@ -5,6 +5,7 @@
 //
 // Description:
 //   - Helper for getting magnetic field at a point - currently very simply unrealistic implementation
+//         -> Regions may be given a precomputed FieldMap which takes priority over the uniform field inside them
 //
 // Copyright (c) 2025, Tobias Sharman
 // Licensed under a Non-Commercial License. See LICENSE file for details
@@ -15,11 +16,48 @@
 #ifndef PHYSICS_SIMULATION_PROGRAM_FIELD_SOLVER_H
 #define PHYSICS_SIMULATION_PROGRAM_FIELD_SOLVER_H
 
+#include <memory>
+#include <span>
+
 #include "core/linear-algebra/vector.h"
+#include "objects/object.h"
+#include "physics/fields/field_map.h"
 
 extern Vector<3> g_BFieldStrength;
 extern Vector<3> g_HFieldStrength;
 
-Vector<3> getFieldAtPoint(const Vector<3>& point);
+// Field map registration
+//
+// Maps are attached to a region (Object) and apply to that region and its descendants unless a descendant has its own
+// map. Registration is expected during setup; lookups are read-only and safe to call concurrently while stepping
+void attachFieldMap(const Object* region, std::shared_ptr<const FieldMap> map);
+void detachFieldMap(const Object* region);
+void clearFieldMaps() noexcept;
+[[nodiscard]] const FieldMap* findFieldMap(const Object* object) noexcept;
+
+// Volume field cache method
+//
+// Stores the field of every volume below root on the volume itself, flagging volumes covered by a field map as
+// non-uniform. Must be re-run after the background field, a material or a field map changes; stepping refreshes it at
+// the start of each stepUntil* call. The second form uses another background field in place of g_BFieldStrength (a
+// SimulationContext's own field)
+void cacheVolumeFields(Object* root);
+void cacheVolumeFields(Object* root, const Vector<3>& backgroundField);
+
+// Field in medium method
+//
+// Field at a point already located in medium; a single load for uniform volumes, map interpolation otherwise
+[[nodiscard]] Vector<3> getFieldInMedium(const Object* medium, const Vector<3>& point);
+
+// Field evaluation
+//
+// Uses the field map of the innermost region with one covering the point, otherwise the uniform field scaled by the
+// relative permeability of the medium
+[[nodiscard]] Vector<3> getFieldAtPoint(const Vector<3>& point);
+
+// Batched field evaluation
+//
+// Equivalent to calling getFieldAtPoint for each point; output span must be at least as long as the input
+void getFieldAtPoints(std::span<const Vector<3>> points, std::span<Vector<3>> fields);
 
-#endif //PHYSICS_SIMULATION_PROGRAM_FIELD_SOLVER_H
\ No newline at end of file
+#endif //PHYSICS_SIMULATION_PROGRAM_FIELD_SOLVER_H
@@ -0,0 +1,405 @@
+//
+// Physics Simulation Program
+// File: field_sources.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of field_sources.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "physics/fields/field_sources.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "constants/maths.h"
+#include "constants/physics.h"
+#include "core/cache/table_cache.h"
+#include "physics/fields/field_solver.h"
+
+namespace {
+    constexpr double k_biotSavartPrefactor = constants::physics::mu0 / (4.0 * constants::math::pi);
+    constexpr double k_singularTolerance = 1e-12; // Relative distance below which a point counts as on the source
+    constexpr std::uint32_t k_bakedFieldMapCacheVersion = 1; // Bump when source models or the FieldMap byte layout change
+
+    std::vector<std::unique_ptr<FieldSource>> g_fieldSources;
+    std::unordered_map<std::uint64_t, std::shared_ptr<const FieldMap>> g_bakedFieldCache;
+    std::mutex g_bakedFieldCacheMutex;
+
+    // FNV-1a style mixing of raw bytes so identical parameters always hash identically
+    constexpr std::uint64_t k_hashOffset = 1469598103934665603ULL;
+    constexpr std::uint64_t k_hashPrime = 1099511628211ULL;
+
+    std::uint64_t hashCombine(std::uint64_t hash, const std::uint64_t value) noexcept {
+        for (std::size_t byte = 0; byte < sizeof(value); ++byte) {
+            hash ^= (value >> (8 * byte)) & 0xFF;
+            hash *= k_hashPrime;
+        }
+        return hash;
+    }
+
+    std::uint64_t hashCombine(const std::uint64_t hash, const double value) noexcept {
+        return hashCombine(hash, std::bit_cast<std::uint64_t>(value == 0.0 ? 0.0 : value)); // Fold -0.0 onto 0.0
+    }
+
+    std::uint64_t hashCombine(std::uint64_t hash, const std::array<double, 3>& values) noexcept {
+        for (const double value : values) {
+            hash = hashCombine(hash, value);
+        }
+        return hash;
+    }
+
+    [[nodiscard]] double dot(const std::array<double, 3>& a, const std::array<double, 3>& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    [[nodiscard]] std::array<double, 3> cross(const std::array<double, 3>& a, const std::array<double, 3>& b) noexcept {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    [[nodiscard]] std::array<double, 3> toSI(const Vector<3>& vector) noexcept {
+        return {vector[0].asDouble(), vector[1].asDouble(), vector[2].asDouble()};
+    }
+
+    // Validation helpers
+    void requireUnit(const Vector<3>& vector, const Unit& unit, const char* source, const char* name) {
+        for (std::size_t i = 0; i < 3; ++i) {
+            if (vector[i].unit != unit) {
+                throw std::invalid_argument(std::format("{} {} has incorrect dimensions", source, name));
+            }
+        }
+    }
+
+    void requireUnit(const Quantity& quantity, const Unit& unit, const char* source, const char* name) {
+        if (quantity.unit != unit) {
+            throw std::invalid_argument(std::format("{} {} has incorrect dimensions", source, name));
+        }
+    }
+
+    [[nodiscard]] std::array<double, 3> normalisedDirection(const Vector<3>& direction, const char* source) {
+        const auto values = toSI(direction);
+        const double length = std::sqrt(dot(values, values));
+        if (!(length > 0.0)) {
+            throw std::invalid_argument(std::format("{} axis must have non-zero length", source));
+        }
+        return {values[0] / length, values[1] / length, values[2] / length};
+    }
+
+    // Type tags mixed into configuration hashes so different sources with equal parameters never collide
+    enum class SourceTag : std::uint64_t {
+        Background = 1,
+        CurrentLoop = 2,
+        Solenoid = 3,
+        WireSegment = 4,
+        MagneticDipole = 5
+    };
+
+    [[nodiscard]] std::uint64_t startHash(const SourceTag tag) noexcept {
+        return hashCombine(k_hashOffset, static_cast<std::uint64_t>(tag));
+    }
+}
+
+CurrentLoop::CurrentLoop(const Vector<3>& centre, const Vector<3>& axis, const Quantity& radius, const Quantity& current)
+    : m_centre(toSI(centre)), m_axis(normalisedDirection(axis, "CurrentLoop")), m_radius(radius.asDouble()), m_current(current.asDouble())
+{
+    requireUnit(centre, Unit::lengthDimension(), "CurrentLoop", "centre");
+    requireUnit(radius, Unit::lengthDimension(), "CurrentLoop", "radius");
+    requireUnit(current, Unit::currentDimension(), "CurrentLoop", "current");
+    if (!(this->m_radius > 0.0)) {
+        throw std::invalid_argument(std::format("CurrentLoop radius must be positive (radius = {} m)", this->m_radius));
+    }
+}
+
+// Field of a circular loop in its own cylindrical frame (rho, z) using complete elliptic integrals:
+//   B_rho = C z / (2 alpha^2 beta rho) [(a^2 + r^2) E(k) - alpha^2 K(k)]
+//   B_z   = C / (2 alpha^2 beta) [(a^2 - r^2) E(k) + alpha^2 K(k)]
+// with C = mu0 I / pi, alpha^2 = a^2 + r^2 - 2 a rho, beta^2 = a^2 + r^2 + 2 a rho, k^2 = 1 - alpha^2 / beta^2
+void CurrentLoop::addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept {
+    const std::array relative{point[0] - this->m_centre[0], point[1] - this->m_centre[1], point[2] - this->m_centre[2]};
+    const double z = dot(relative, this->m_axis);
+    const std::array radial{
+        relative[0] - z * this->m_axis[0],
+        relative[1] - z * this->m_axis[1],
+        relative[2] - z * this->m_axis[2]
+    };
+    const double rho = std::sqrt(dot(radial, radial));
+    const double a = this->m_radius;
+    const double r2 = rho * rho + z * z;
+    const double alpha2 = a * a + r2 - 2.0 * a * rho;
+    if (alpha2 <= k_singularTolerance * k_singularTolerance * a * a) {
+        return; // On the wire
+    }
+    const double beta2 = a * a + r2 + 2.0 * a * rho;
+    const double beta = std::sqrt(beta2);
+    const double k = std::sqrt(std::max(0.0, 1.0 - alpha2 / beta2));
+    const double ellipticK = std::comp_ellint_1(k);
+    const double ellipticE = std::comp_ellint_2(k);
+    const double prefactor = constants::physics::mu0 * this->m_current / constants::math::pi;
+
+    const double bz = prefactor / (2.0 * alpha2 * beta) * ((a * a - r2) * ellipticE + alpha2 * ellipticK);
+    field[0] += bz * this->m_axis[0];
+    field[1] += bz * this->m_axis[1];
+    field[2] += bz * this->m_axis[2];
+
+    if (rho > k_singularTolerance * a) {
+        const double bRho = prefactor * z / (2.0 * alpha2 * beta * rho) * ((a * a + r2) * ellipticE - alpha2 * ellipticK);
+        field[0] += bRho * radial[0] / rho;
+        field[1] += bRho * radial[1] / rho;
+        field[2] += bRho * radial[2] / rho;
+    }
+}
+
+std::uint64_t CurrentLoop::getConfigurationHash() const noexcept {
+    auto hash = startHash(SourceTag::CurrentLoop);
+    hash = hashCombine(hash, this->m_centre);
+    hash = hashCombine(hash, this->m_axis);
+    hash = hashCombine(hash, this->m_radius);
+    return hashCombine(hash, this->m_current);
+}
+
+Solenoid::Solenoid(
+    const Vector<3>& centre,
+    const Vector<3>& axis,
+    const Quantity& radius,
+    const Quantity& length,
+    const std::size_t turns,
+    const Quantity& current)
+{
+    requireUnit(centre, Unit::lengthDimension(), "Solenoid", "centre");
+    requireUnit(length, Unit::lengthDimension(), "Solenoid", "length");
+    if (turns == 0) {
+        throw std::invalid_argument("Solenoid requires at least one turn");
+    }
+    if (length.asDouble() < 0.0) {
+        throw std::invalid_argument(std::format("Solenoid length must be non-negative (length = {} m)", length.asDouble()));
+    }
+
+    const auto axisDirection = normalisedDirection(axis, "Solenoid");
+    const auto centreValues = toSI(centre);
+    const double pitch = turns > 1 ? length.asDouble() / static_cast<double>(turns - 1) : 0.0;
+    const double firstOffset = -0.5 * length.asDouble();
+
+    this->m_loops.reserve(turns);
+    this->m_hash = startHash(SourceTag::Solenoid);
+    for (std::size_t turn = 0; turn < turns; ++turn) {
+        const double offset = turns > 1 ? firstOffset + pitch * static_cast<double>(turn) : 0.0;
+        const std::array<double, 3> loopCentre{
+            centreValues[0] + offset * axisDirection[0],
+            centreValues[1] + offset * axisDirection[1],
+            centreValues[2] + offset * axisDirection[2]
+        };
+        this->m_loops.emplace_back(Vector<3>(loopCentre, Unit::lengthDimension()), axis, radius, current);
+        this->m_hash = hashCombine(this->m_hash, this->m_loops.back().getConfigurationHash());
+    }
+}
+
+void Solenoid::addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept {
+    for (const auto& loop : this->m_loops) {
+        loop.addFieldAt(point, field);
+    }
+}
+
+std::uint64_t Solenoid::getConfigurationHash() const noexcept {
+    return this->m_hash;
+}
+
+WireSegment::WireSegment(const Vector<3>& start, const Vector<3>& end, const Quantity& current)
+    : m_start(toSI(start)), m_current(current.asDouble())
+{
+    requireUnit(start, Unit::lengthDimension(), "WireSegment", "start");
+    requireUnit(end, Unit::lengthDimension(), "WireSegment", "end");
+    requireUnit(current, Unit::currentDimension(), "WireSegment", "current");
+
+    const auto endValues = toSI(end);
+    const std::array span{endValues[0] - this->m_start[0], endValues[1] - this->m_start[1], endValues[2] - this->m_start[2]};
+    this->m_length = std::sqrt(dot(span, span));
+    if (!(this->m_length > 0.0)) {
+        throw std::invalid_argument("WireSegment start and end must differ");
+    }
+    this->m_direction = {span[0] / this->m_length, span[1] / this->m_length, span[2] / this->m_length};
+}
+
+// Closed form of the Biot-Savart integral along a straight segment:
+//   |B| = mu0 I / (4 pi d) (s1 / sqrt(s1^2 + d^2) - s2 / sqrt(s2^2 + d^2)), direction u x d_hat
+// where d is the perpendicular distance to the line and s1, s2 the signed distances along it from each end
+void WireSegment::addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept {
+    const std::array relative{point[0] - this->m_start[0], point[1] - this->m_start[1], point[2] - this->m_start[2]};
+    const double s1 = dot(relative, this->m_direction);
+    const std::array perpendicular{
+        relative[0] - s1 * this->m_direction[0],
+        relative[1] - s1 * this->m_direction[1],
+        relative[2] - s1 * this->m_direction[2]
+    };
+    const double d = std::sqrt(dot(perpendicular, perpendicular));
+    if (d <= k_singularTolerance * this->m_length) {
+        return; // On the wire axis
+    }
+    const double s2 = s1 - this->m_length;
+    const double magnitude = k_biotSavartPrefactor * this->m_current / d
+        * (s1 / std::sqrt(s1 * s1 + d * d) - s2 / std::sqrt(s2 * s2 + d * d));
+    const auto direction = cross(this->m_direction, perpendicular);
+    field[0] += magnitude * direction[0] / d;
+    field[1] += magnitude * direction[1] / d;
+    field[2] += magnitude * direction[2] / d;
+}
+
+std::uint64_t WireSegment::getConfigurationHash() const noexcept {
+    auto hash = startHash(SourceTag::WireSegment);
+    hash = hashCombine(hash, this->m_start);
+    hash = hashCombine(hash, this->m_direction);
+    hash = hashCombine(hash, this->m_length);
+    return hashCombine(hash, this->m_current);
+}
+
+MagneticDipole::MagneticDipole(const Vector<3>& centre, const Vector<3>& moment)
+    : m_centre(toSI(centre)), m_moment(toSI(moment))
+{
+    requireUnit(centre, Unit::lengthDimension(), "MagneticDipole", "centre");
+    requireUnit(moment, Unit(2, 0, 0, 1, 0, 0, 0), "MagneticDipole", "moment");
+}
+
+// B = mu0 / (4 pi) (3 (m . r_hat) r_hat - m) / r^3
+void MagneticDipole::addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept {
+    const std::array relative{point[0] - this->m_centre[0], point[1] - this->m_centre[1], point[2] - this->m_centre[2]};
+    const double r2 = dot(relative, relative);
+    if (r2 <= 0.0) {
+        return;
+    }
+    const double r = std::sqrt(r2);
+    const double inverseR3 = 1.0 / (r2 * r);
+    const double projection = dot(this->m_moment, relative) / r2; // (m . r_hat) / r
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        field[axis] += k_biotSavartPrefactor * inverseR3 * (3.0 * projection * relative[axis] - this->m_moment[axis]);
+    }
+}
+
+std::uint64_t MagneticDipole::getConfigurationHash() const noexcept {
+    auto hash = startHash(SourceTag::MagneticDipole);
+    hash = hashCombine(hash, this->m_centre);
+    return hashCombine(hash, this->m_moment);
+}
+
+void addFieldSource(std::unique_ptr<FieldSource> source) {
+    if (!source) {
+        throw std::invalid_argument("Cannot add a null field source");
+    }
+    g_fieldSources.push_back(std::move(source));
+}
+
+void clearFieldSources() noexcept {
+    g_fieldSources.clear();
+}
+
+const std::vector<std::unique_ptr<FieldSource>>& getFieldSources() noexcept {
+    return g_fieldSources;
+}
+
+std::uint64_t getFieldSourceConfigurationHash() noexcept {
+    auto hash = startHash(SourceTag::Background);
+    hash = hashCombine(hash, toSI(g_BFieldStrength));
+    for (const auto& source : g_fieldSources) {
+        hash = hashCombine(hash, source->getConfigurationHash());
+    }
+    return hash;
+}
+
+std::array<double, 3> evaluateFieldSources(const std::array<double, 3>& point) noexcept {
+    auto field = toSI(g_BFieldStrength);
+    for (const auto& source : g_fieldSources) {
+        source->addFieldAt(point, field);
+    }
+    return field;
+}
+
+std::shared_ptr<const FieldMap> bakeFieldSources(
+    const Object* region,
+    const Vector<3>& lowerCorner,
+    const Vector<3>& upperCorner,
+    const std::array<std::size_t, 3>& nodeCounts,
+    const FieldInterpolation interpolation)
+{
+    if (!region) {
+        throw std::invalid_argument("Cannot bake field sources for a null region");
+    }
+
+    auto key = getFieldSourceConfigurationHash();
+    key = hashCombine(key, toSI(lowerCorner));
+    key = hashCombine(key, toSI(upperCorner));
+    for (const auto count : nodeCounts) {
+        key = hashCombine(key, static_cast<std::uint64_t>(count));
+    }
+    key = hashCombine(key, static_cast<std::uint64_t>(interpolation));
+
+    {
+        std::lock_guard lock(g_bakedFieldCacheMutex);
+        if (const auto it = g_bakedFieldCache.find(key); it != g_bakedFieldCache.end()) {
+            attachFieldMap(region, it->second);
+            return it->second;
+        }
+    }
+
+    const table_cache::Key diskKey{"field_map", key, k_bakedFieldMapCacheVersion};
+    if (const auto blob = table_cache::load(diskKey)) {
+        try {
+            std::shared_ptr<const FieldMap> loaded = std::make_shared<FieldMap>(FieldMap::fromBytes(blob->bytes(), "table cache"));
+            {
+                std::lock_guard lock(g_bakedFieldCacheMutex);
+                loaded = g_bakedFieldCache.try_emplace(key, std::move(loaded)).first->second;
+            }
+            attachFieldMap(region, loaded);
+            return loaded;
+        } catch (const std::exception&) {
+            // Passed the checksum but not FieldMap's own validation (written by an incompatible build); re-baked below
+        }
+    }
+
+    auto map = std::make_shared<FieldMap>(lowerCorner, upperCorner, nodeCounts, interpolation);
+
+    // Each worker fills whole z slices; nodes are disjoint so no synchronisation is needed
+    const std::size_t sliceCount = nodeCounts[2];
+    const std::size_t workerCount = std::min<std::size_t>(std::max<unsigned>(1, std::thread::hardware_concurrency()), sliceCount);
+    const auto fillSlices = [&](const std::size_t firstSlice) {
+        for (std::size_t k = firstSlice; k < sliceCount; k += workerCount) {
+            for (std::size_t j = 0; j < nodeCounts[1]; ++j) {
+                for (std::size_t i = 0; i < nodeCounts[0]; ++i) {
+                    map->setNode(i, j, k, evaluateFieldSources(map->getNodePosition(i, j, k)));
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (std::size_t worker = 1; worker < workerCount; ++worker) {
+        workers.emplace_back(fillSlices, worker);
+    }
+    fillSlices(0);
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    table_cache::store(diskKey, map->toBytes());
+
+    std::shared_ptr<const FieldMap> baked = std::move(map);
+    {
+        std::lock_guard lock(g_bakedFieldCacheMutex);
+        baked = g_bakedFieldCache.try_emplace(key, std::move(baked)).first->second;
+    }
+    attachFieldMap(region, baked);
+    return baked;
+}
+
+void clearBakedFieldCache() noexcept {
+    std::lock_guard lock(g_bakedFieldCacheMutex);
+    g_bakedFieldCache.clear();
+}
@@ -0,0 +1,167 @@
+//
+// Physics Simulation Program
+// File: field_sources.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes magnetic field sources (coils, wires and magnets) summed via Biot-Savart and baked into field maps
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_FIELD_SOURCES_H
+#define PHYSICS_SIMULATION_PROGRAM_FIELD_SOURCES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/linear-algebra/vector.h"
+#include "core/quantities/quantity.h"
+#include "objects/object.h"
+#include "physics/fields/field_map.h"
+
+// FieldSource
+//
+// Abstract base for a magnetic field source attached to the world
+//
+// Notes on initialisation:
+//   - Derived constructors take dimensioned quantities, validate them, then store SI doubles so addFieldAt() does no
+//     unit handling
+//
+// Notes on algorithms:
+//   - addFieldAt() accumulates the source's B (T) at SI coordinates (m) into field so sources can be summed in place
+//   - Points on a singular set (on a wire, at a dipole centre) contribute nothing rather than an infinite field
+//   - getConfigurationHash() depends only on the source type and its parameters, it identifies baked field maps
+//
+// Supported overloads / operations and functions / methods:
+//   - Field accumulation:     addFieldAt()
+//   - Configuration hash:     getConfigurationHash()
+//
+// Example usage:
+//   addFieldSource(std::make_unique<Solenoid>(
+//       Vector<3>({0.0, 0.0, 0.0}, "m"), Vector<3>({0.0, 0.0, 1.0}), Quantity(2.0, "cm"), Quantity(20.0, "cm"),
+//       200, Quantity(0.1, "A")));
+//   addFieldSource(std::make_unique<MagneticDipole>(Vector<3>({0.0, 0.05, 0.0}, "m"), Vector<3>({0.0, 0.0, 1e-3}, "A m^2")));
+//   bakeFieldSources(vapourCell, Vector<3>({-1.5, -1.5, -1.5}, "mm"), Vector<3>({1.5, 1.5, 1.5}, "mm"), {33, 33, 33});
+class FieldSource {
+    public:
+        virtual ~FieldSource() = default;
+
+        // Field accumulation method
+        virtual void addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept = 0;
+
+        // Configuration hash method
+        [[nodiscard]] virtual std::uint64_t getConfigurationHash() const noexcept = 0;
+};
+
+// CurrentLoop
+//
+// Circular loop of current evaluated with the closed form complete elliptic integral solution
+//
+// Notes on initialisation:
+//   - Centre (length), axis (direction, normalised internally), radius (length) and current (A)
+//   - Current circulates right-handed about the axis
+class CurrentLoop final : public FieldSource {
+    public:
+        CurrentLoop(const Vector<3>& centre, const Vector<3>& axis, const Quantity& radius, const Quantity& current);
+
+        void addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept override;
+        [[nodiscard]] std::uint64_t getConfigurationHash() const noexcept override;
+
+    private:
+        std::array<double, 3> m_centre{};
+        std::array<double, 3> m_axis{};
+        double m_radius = 0.0;
+        double m_current = 0.0;
+};
+
+// Solenoid
+//
+// Finite solenoid modelled as evenly spaced current loops, one per turn
+//
+// Notes on initialisation:
+//   - Centre (length), axis (direction), radius (length), length (length), number of turns and current per turn (A)
+class Solenoid final : public FieldSource {
+    public:
+        Solenoid(
+            const Vector<3>& centre,
+            const Vector<3>& axis,
+            const Quantity& radius,
+            const Quantity& length,
+            std::size_t turns,
+            const Quantity& current);
+
+        void addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept override;
+        [[nodiscard]] std::uint64_t getConfigurationHash() const noexcept override;
+
+    private:
+        std::vector<CurrentLoop> m_loops;
+        std::uint64_t m_hash = 0;
+};
+
+// WireSegment
+//
+// Straight finite wire carrying a current from start to end, evaluated with the closed form Biot-Savart integral
+class WireSegment final : public FieldSource {
+    public:
+        WireSegment(const Vector<3>& start, const Vector<3>& end, const Quantity& current);
+
+        void addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept override;
+        [[nodiscard]] std::uint64_t getConfigurationHash() const noexcept override;
+
+    private:
+        std::array<double, 3> m_start{};
+        std::array<double, 3> m_direction{};
+        double m_length = 0.0;
+        double m_current = 0.0;
+};
+
+// MagneticDipole
+//
+// Point dipole approximation of a permanent magnet; moment in A m^2
+class MagneticDipole final : public FieldSource {
+    public:
+        MagneticDipole(const Vector<3>& centre, const Vector<3>& moment);
+
+        void addFieldAt(const std::array<double, 3>& point, std::array<double, 3>& field) const noexcept override;
+        [[nodiscard]] std::uint64_t getConfigurationHash() const noexcept override;
+
+    private:
+        std::array<double, 3> m_centre{};
+        std::array<double, 3> m_moment{};
+};
+
+// Field source registration
+//
+// Sources are summed with the uniform background field (g_BFieldStrength). They are only ever evaluated when baking,
+// stepping reads the resulting field maps
+void addFieldSource(std::unique_ptr<FieldSource> source);
+void clearFieldSources() noexcept;
+[[nodiscard]] const std::vector<std::unique_ptr<FieldSource>>& getFieldSources() noexcept;
+
+// Combined configuration hash of the background field and every registered source
+[[nodiscard]] std::uint64_t getFieldSourceConfigurationHash() noexcept;
+
+// Direct Biot-Savart evaluation of background plus sources (T) at SI coordinates (m)
+[[nodiscard]] std::array<double, 3> evaluateFieldSources(const std::array<double, 3>& point) noexcept;
+
+// Bake method
+//
+// Evaluates the sources on a grid in parallel and attaches the map to the region. Maps are cached by the source
+// configuration and grid parameters so re-baking an unchanged configuration reuses the existing map, first in memory
+// and then in the on-disk table cache (see table_cache.h) so later runs skip the evaluation too
+std::shared_ptr<const FieldMap> bakeFieldSources(
+    const Object* region,
+    const Vector<3>& lowerCorner,
+    const Vector<3>& upperCorner,
+    const std::array<std::size_t, 3>& nodeCounts,
+    FieldInterpolation interpolation = FieldInterpolation::Trilinear);
+
+// Drop every cached baked map (attached maps stay alive through their region)
+void clearBakedFieldCache() noexcept;
+
+#endif //PHYSICS_SIMULATION_PROGRAM_FIELD_SOURCES_H
@@ -0,0 +1,364 @@
+//
+// Physics Simulation Program
+// File: optical_element.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of optical_element.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "physics/optics/optical_element.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <random>
+#include <stdexcept>
+
+#include "config/program_config.h"
+#include "core/random/random_manager.h"
+#include "objects/object.h"
+#include "particles/particle-types/photon.h"
+
+namespace {
+    using Direction = std::array<double, 3>;
+
+    constexpr std::size_t k_tableSamples = config::program::fresnelTableSamples;
+    static_assert(k_tableSamples >= 2, "Fresnel tables need at least 2 samples to interpolate between");
+
+    constexpr double k_degenerateDirection = 1e-12; // Squared length below which a projected axis is unusable
+    constexpr double k_parallelToX = 0.9;           // |k_x| above which the photon frame is built from world y instead
+
+    struct Stokes {
+        double i = 0.0;
+        double q = 0.0;
+        double u = 0.0;
+        double v = 0.0;
+    };
+
+    double dot(const Direction& a, const Direction& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    Direction cross(const Direction& a, const Direction& b) noexcept {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    bool normalise(Direction& direction) noexcept {
+        const double lengthSquared = dot(direction, direction);
+        if (lengthSquared <= k_degenerateDirection) {
+            return false;
+        }
+        const double inverse = 1.0 / std::sqrt(lengthSquared);
+        for (auto& component : direction) {
+            component *= inverse;
+        }
+        return true;
+    }
+
+    Direction toDirection(const Vector<3>& vector) noexcept {
+        return {vector[0].value, vector[1].value, vector[2].value};
+    }
+
+    // Component of axis perpendicular to the unit vector k, normalised; false if axis is (near) parallel to k
+    bool perpendicularAxis(Direction axis, const Direction& k, Direction& result) noexcept {
+        const double along = dot(axis, k);
+        for (std::size_t index = 0; index < 3; ++index) {
+            axis[index] -= along * k[index];
+        }
+        if (!normalise(axis)) {
+            return false;
+        }
+        result = axis;
+        return true;
+    }
+
+    // First axis of the frame photon Stokes vectors are referred to, for unit momentum direction k
+    Direction photonFrameAxis(const Direction& k) noexcept {
+        Direction axis{};
+        const Direction reference = std::abs(k[0]) > k_parallelToX ? Direction{0.0, 1.0, 0.0} : Direction{1.0, 0.0, 0.0};
+        (void)perpendicularAxis(reference, k, axis); // Cannot fail with the reference picked this way
+        return axis;
+    }
+
+    // Re-express a Stokes vector referred to the frame (from, k x from) in the frame (to, k x to)
+    void rotateFrame(Stokes& stokes, const Direction& from, const Direction& to, const Direction& k) noexcept {
+        const double c = dot(to, from);
+        const double s = dot(to, cross(k, from));
+        const double norm = c * c + s * s;
+        if (norm <= k_degenerateDirection) {
+            return;
+        }
+        const double cos2 = (c * c - s * s) / norm;
+        const double sin2 = 2.0 * c * s / norm;
+        const double q = cos2 * stokes.q + sin2 * stokes.u;
+        const double u = -sin2 * stokes.q + cos2 * stokes.u;
+        stokes.q = q;
+        stokes.u = u;
+    }
+
+    // Apply the Jones matrix diag(a, b) given |a|^2, |b|^2 and a b*
+    void applyDiagonal(Stokes& stokes, const double a2, const double b2, const double crossRe, const double crossIm) noexcept {
+        const double sum = 0.5 * (a2 + b2);
+        const double difference = 0.5 * (a2 - b2);
+        const Stokes result{
+            sum * stokes.i + difference * stokes.q,
+            difference * stokes.i + sum * stokes.q,
+            crossRe * stokes.u + crossIm * stokes.v,
+            -crossIm * stokes.u + crossRe * stokes.v
+        };
+        stokes = result;
+    }
+
+    void rescale(Stokes& stokes, const double intensity) noexcept {
+        if (stokes.i <= 0.0) {
+            stokes = {intensity, 0.0, 0.0, 0.0};
+            return;
+        }
+        const double factor = intensity / stokes.i;
+        stokes = {intensity, stokes.q * factor, stokes.u * factor, stokes.v * factor};
+    }
+
+    using JonesMatrix = OpticalElement::JonesMatrix;
+
+    JonesMatrix multiply(const JonesMatrix& a, const JonesMatrix& b) noexcept {
+        JonesMatrix result{};
+        for (std::size_t row = 0; row < 2; ++row) {
+            for (std::size_t column = 0; column < 2; ++column) {
+                result[row][column] = a[row][0] * b[0][column] + a[row][1] * b[1][column];
+            }
+        }
+        return result;
+    }
+
+    JonesMatrix adjoint(const JonesMatrix& matrix) noexcept {
+        return {{{std::conj(matrix[0][0]), std::conj(matrix[1][0])}, {std::conj(matrix[0][1]), std::conj(matrix[1][1])}}};
+    }
+
+    // Pauli basis in the order (identity, Q, U, V) matching the Stokes definitions
+    constexpr std::array<JonesMatrix, 4> k_pauli{{
+        {{{1.0, 0.0}, {0.0, 1.0}}},
+        {{{1.0, 0.0}, {0.0, -1.0}}},
+        {{{0.0, 1.0}, {1.0, 0.0}}},
+        {{{0.0, std::complex<double>(0.0, -1.0)}, {std::complex<double>(0.0, 1.0), 0.0}}}
+    }};
+
+    OpticalElement::MuellerMatrix muellerFromJones(const JonesMatrix& jones, const double transmittance) noexcept {
+        const auto jonesAdjoint = adjoint(jones);
+        OpticalElement::MuellerMatrix mueller{};
+        for (std::size_t row = 0; row < 4; ++row) {
+            for (std::size_t column = 0; column < 4; ++column) {
+                const auto product = multiply(k_pauli[row], multiply(jones, multiply(k_pauli[column], jonesAdjoint)));
+                mueller[row][column] = 0.5 * transmittance * (product[0][0] + product[1][1]).real();
+            }
+        }
+        return mueller;
+    }
+
+    bool isIdentity(const OpticalElement::MuellerMatrix& mueller) noexcept {
+        for (std::size_t row = 0; row < 4; ++row) {
+            for (std::size_t column = 0; column < 4; ++column) {
+                const double expected = row == column ? 1.0 : 0.0;
+                if (std::abs(mueller[row][column] - expected) > 1e-12) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void validateIndex(const double index, const std::string_view which) {
+        if (!(index > 0.0) || !std::isfinite(index)) {
+            throw std::invalid_argument(std::format("Optical element {} refractive index must be positive but got {}", which, index));
+        }
+    }
+} // namespace
+
+OpticalElement::OpticalElement(
+    const double outsideIndex,
+    const double insideIndex,
+    const JonesMatrix& jones,
+    const Vector<3>& localAxis,
+    const double transmittance
+) :
+    m_outsideIndex(outsideIndex),
+    m_insideIndex(insideIndex)
+{
+    validateIndex(outsideIndex, "outside");
+    validateIndex(insideIndex, "inside");
+    if (!(transmittance >= 0.0 && transmittance <= 1.0)) {
+        throw std::invalid_argument(std::format("Optical element transmittance must be within [0, 1] but got {}", transmittance));
+    }
+    this->m_localAxis = toDirection(localAxis);
+    if (!normalise(this->m_localAxis)) {
+        throw std::invalid_argument("Optical element axis must be a non-zero vector");
+    }
+
+    this->m_mueller = muellerFromJones(jones, transmittance);
+    this->m_identityMueller = isIdentity(this->m_mueller);
+    this->m_indexMatched = outsideIndex == insideIndex;
+    this->m_entering = buildFresnelTable(outsideIndex, insideIndex);
+    this->m_leaving = buildFresnelTable(insideIndex, outsideIndex);
+}
+
+OpticalElement OpticalElement::window(const double refractiveIndex, const double transmittance, const double outsideIndex) {
+    return {outsideIndex, refractiveIndex, k_identityJones, Vector<3>({1.0, 0.0, 0.0}), transmittance};
+}
+
+OpticalElement OpticalElement::polariser(
+    const Vector<3>& localAxis,
+    const double extinctionRatio,
+    const double refractiveIndex,
+    const double outsideIndex
+) {
+    if (!(extinctionRatio >= 0.0 && extinctionRatio <= 1.0)) {
+        throw std::invalid_argument(std::format("Polariser extinction ratio must be within [0, 1] but got {}", extinctionRatio));
+    }
+    const JonesMatrix jones{{{1.0, 0.0}, {0.0, std::sqrt(extinctionRatio)}}};
+    return {outsideIndex, refractiveIndex, jones, localAxis};
+}
+
+OpticalElement OpticalElement::waveplate(
+    const Vector<3>& localFastAxis,
+    const double retardance,
+    const double refractiveIndex,
+    const double outsideIndex
+) {
+    const JonesMatrix jones{{{1.0, 0.0}, {0.0, std::polar(1.0, retardance)}}};
+    return {outsideIndex, refractiveIndex, jones, localFastAxis};
+}
+
+std::vector<OpticalElement::FresnelSample> OpticalElement::buildFresnelTable(const double incidentIndex, const double transmittedIndex) {
+    std::vector<FresnelSample> table(k_tableSamples);
+    if (incidentIndex == transmittedIndex) {
+        return table; // Defaults are full transmission
+    }
+
+    const double ratioSquared = (incidentIndex / transmittedIndex) * (incidentIndex / transmittedIndex);
+    for (std::size_t index = 0; index < k_tableSamples; ++index) {
+        const double cosIncidence = static_cast<double>(index) / static_cast<double>(k_tableSamples - 1);
+        const double sinTransmittedSquared = ratioSquared * (1.0 - cosIncidence * cosIncidence);
+        const bool totalInternalReflection = sinTransmittedSquared >= 1.0;
+        // Imaginary past the critical angle, giving |r| = 1 and the phase shift between s and p
+        const auto cosTransmitted = std::sqrt(std::complex<double>(1.0 - sinTransmittedSquared, 0.0));
+
+        const auto rs = (incidentIndex * cosIncidence - transmittedIndex * cosTransmitted)
+            / (incidentIndex * cosIncidence + transmittedIndex * cosTransmitted);
+        const auto rp = (transmittedIndex * cosIncidence - incidentIndex * cosTransmitted)
+            / (transmittedIndex * cosIncidence + incidentIndex * cosTransmitted);
+        const auto reflectedCross = rs * std::conj(rp);
+
+        auto& sample = table[index];
+        sample.rs = std::min(std::norm(rs), 1.0);
+        sample.rp = std::min(std::norm(rp), 1.0);
+        sample.reflectedRe = reflectedCross.real();
+        sample.reflectedIm = reflectedCross.imag();
+        if (totalInternalReflection) {
+            sample.ts = 0.0;
+            sample.tp = 0.0;
+            sample.transmitted = 0.0;
+        } else {
+            // Lossless interface, so T = 1 - R; avoids the 0/0 of the amplitude form at grazing incidence
+            sample.ts = 1.0 - sample.rs;
+            sample.tp = 1.0 - sample.rp;
+            sample.transmitted = std::sqrt(sample.ts * sample.tp);
+        }
+    }
+    return table;
+}
+
+OpticalElement::FresnelSample OpticalElement::lookup(const std::vector<FresnelSample>& table, const double cosIncidence) noexcept {
+    const double position = std::clamp(cosIncidence, 0.0, 1.0) * static_cast<double>(table.size() - 1);
+    const auto lower = std::min(static_cast<std::size_t>(position), table.size() - 2);
+    const double fraction = position - static_cast<double>(lower);
+    const auto& a = table[lower];
+    const auto& b = table[lower + 1];
+    const auto mix = [fraction](const double from, const double to) { return from + (to - from) * fraction; };
+    return {
+        mix(a.rs, b.rs),
+        mix(a.rp, b.rp),
+        mix(a.reflectedRe, b.reflectedRe),
+        mix(a.reflectedIm, b.reflectedIm),
+        mix(a.ts, b.ts),
+        mix(a.tp, b.tp),
+        mix(a.transmitted, b.transmitted)
+    };
+}
+
+double OpticalElement::reflectance(const double cosIncidence, const bool entering) const noexcept {
+    const auto sample = lookup(entering ? this->m_entering : this->m_leaving, std::abs(cosIncidence));
+    return 0.5 * (sample.rs + sample.rp);
+}
+
+OpticalOutcome OpticalElement::apply(Photon& photon, const Object& surface, const Vector<3>& worldNormal, const bool entering) const {
+    Direction k = toDirection(photon.getMomentum());
+    if (!normalise(k)) {
+        return OpticalOutcome::Transmitted;
+    }
+    const Direction normal = toDirection(worldNormal);
+    const double cosIncidence = std::min(std::abs(dot(k, normal)), 1.0);
+
+    const auto& polarisation = photon.getPolarisation();
+    Stokes stokes{polarisation[0].value, polarisation[1].value, polarisation[2].value, polarisation[3].value};
+    if (stokes.i <= 0.0) {
+        stokes = {1.0, 0.0, 0.0, 0.0}; // Unset polarisation -> unpolarised
+    }
+    const double incomingIntensity = stokes.i;
+
+    const Direction photonAxis = photonFrameAxis(k);
+    Direction sAxis{};
+    if (!perpendicularAxis(cross(k, normal), k, sAxis)) {
+        sAxis = photonAxis; // Normal incidence: every frame is an s/p frame
+    }
+    rotateFrame(stokes, photonAxis, sAxis, k);
+
+    auto& engine = random_manager::engine(random_manager::Stream::OpticalSurfaces);
+    std::uniform_real_distribution uniform(0.0, 1.0);
+
+    const auto sample = lookup(entering ? this->m_entering : this->m_leaving, cosIncidence);
+    if (!this->m_indexMatched) {
+        const double reflectedIntensity = 0.5 * (sample.rs * (stokes.i + stokes.q) + sample.rp * (stokes.i - stokes.q));
+        if (reflectedIntensity > 0.0 && uniform(engine) * stokes.i < reflectedIntensity) {
+            applyDiagonal(stokes, sample.rs, sample.rp, sample.reflectedRe, sample.reflectedIm);
+
+            // s is unchanged by the mirror, so it stays a valid first axis for the reflected direction
+            const double along = dot(k, normal);
+            const Direction reflected{k[0] - 2.0 * along * normal[0], k[1] - 2.0 * along * normal[1], k[2] - 2.0 * along * normal[2]};
+            rotateFrame(stokes, sAxis, photonFrameAxis(reflected), reflected);
+            rescale(stokes, incomingIntensity);
+            photon.setPolarisation(Vector<4>({stokes.i, stokes.q, stokes.u, stokes.v}));
+            return OpticalOutcome::Reflected;
+        }
+        applyDiagonal(stokes, sample.ts, sample.tp, sample.transmitted, 0.0);
+    }
+
+    Direction frameAxis = sAxis;
+    if (entering && !this->m_identityMueller) {
+        const auto worldAxis = toDirection(surface.localToWorldDirection(Vector<3>(this->m_localAxis)));
+        if (perpendicularAxis(worldAxis, k, frameAxis)) {
+            rotateFrame(stokes, sAxis, frameAxis, k);
+        } else {
+            frameAxis = sAxis; // Axis along the beam: the element frame is arbitrary about it
+        }
+
+        const std::array<double, 4> in{stokes.i, stokes.q, stokes.u, stokes.v};
+        std::array<double, 4> out{};
+        for (std::size_t row = 0; row < 4; ++row) {
+            for (std::size_t column = 0; column < 4; ++column) {
+                out[row] += this->m_mueller[row][column] * in[column];
+            }
+        }
+        if (out[0] <= 0.0 || uniform(engine) * in[0] >= out[0]) {
+            return OpticalOutcome::Absorbed;
+        }
+        stokes = {out[0], out[1], out[2], out[3]};
+    }
+
+    rotateFrame(stokes, frameAxis, photonAxis, k);
+    rescale(stokes, incomingIntensity);
+    photon.setPolarisation(Vector<4>({stokes.i, stokes.q, stokes.u, stokes.v}));
+    return OpticalOutcome::Transmitted;
+}
@@ -0,0 +1,156 @@
+//
+// Physics Simulation Program
+// File: optical_element.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes optical elements attached to object surfaces that act on photon polarisation at boundary crossings
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_OPTICAL_ELEMENT_H
+#define PHYSICS_SIMULATION_PROGRAM_OPTICAL_ELEMENT_H
+
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include "core/linear-algebra/vector.h"
+
+class Object;
+class Photon;
+
+// Result of a photon meeting an optical element surface
+enum class OpticalOutcome : std::uint8_t {
+    Transmitted = 0,
+    Reflected = 1,
+    Absorbed = 2
+};
+
+// OpticalElement
+//
+// Describes how the surface of an object acts on photons crossing it: Fresnel reflection and transmission between the
+// refractive indices either side of the surface, followed on entry by a Jones matrix (polariser, waveplate, ...) and a
+// bulk transmittance for one pass through the object
+//
+// Notes on initialisation:
+//   - Constructed from the refractive indices outside and inside the object, a Jones matrix acting in the element's
+//     own frame, the element axis (local coordinates of the owning object) defining that frame, and a transmittance
+//         -> The first Jones basis vector is the element axis projected perpendicular to the photon direction, the
+//            second completes the right-handed frame about the direction
+//   - window(), polariser() and waveplate() build the common elements
+//   - Attach to an object with the opticalElement() tag or Object::setOpticalElement(); elements are immutable and may
+//     be shared between objects
+//
+// Notes on algorithms:
+//   - Photon polarisation is the Stokes vector (I, Q, U, V) referred to the frame whose first axis is world x projected
+//     perpendicular to the momentum (world y when the momentum is near x) and whose second axis is the momentum crossed
+//     with the first; a zero Stokes vector is treated as unpolarised light of unit intensity
+//   - The Mueller matrix M_kj = 1/2 tr(sigma_k J sigma_j J^dagger) (scaled by the transmittance) and Fresnel tables
+//     for both crossing directions are built once on construction; the tables hold Rs, Rp and the s/p cross term of
+//     the reflection, and Ts, Tp and sqrt(Ts Tp) of the transmission at config::program::fresnelTableSamples points
+//     uniform in the cosine of the incidence angle, covering total internal reflection
+//   - A crossing costs one table lookup with linear interpolation, up to three frame rotations and one 4x4 multiply:
+//         -> The Stokes vector is rotated into the s/p frame of the plane of incidence and the photon is reflected
+//            with probability (Rs (I + Q) + Rp (I - Q)) / 2I, drawn from random_manager::Stream::OpticalSurfaces
+//         -> On entry the transmitted Stokes vector is rotated into the element frame, multiplied by the Mueller matrix
+//            and the photon is absorbed with probability 1 - I'/I; leaving crossings apply the Fresnel terms only
+//         -> The surviving Stokes vector is rescaled to the incoming intensity and referred back to the photon frame
+//   - Refraction is not modelled: transmitted photons keep their direction, and reflected photons are mirrored about
+//     the normal by the caller
+//
+// Supported overloads / operations and functions / methods:
+//   - Constructors:           OpticalElement(), window(), polariser(), waveplate()
+//   - Crossing:               apply()
+//   - Getters:                get_____() (OutsideIndex, InsideIndex, MuellerMatrix)
+//   - Reflectance:            reflectance()
+//
+// Example usage:
+//   const auto analyser = std::make_shared<OpticalElement>(OpticalElement::polariser(Vector<3>({0.0, 1.0, 0.0}), 1e-4, 1.5));
+//   const auto sheet = world->addChild<Box>(
+//       name("Analyser"),
+//       material("glass"),
+//       position(Vector<3>({20.0, 0.0, 0.0}, "mm")),
+//       size(Vector<3>({1.0, 25.0, 25.0}, "mm")),
+//       opticalElement(analyser)
+//       );
+class OpticalElement {
+    public:
+        using JonesMatrix = std::array<std::array<std::complex<double>, 2>, 2>;
+        using MuellerMatrix = std::array<std::array<double, 4>, 4>;
+
+        static constexpr JonesMatrix k_identityJones{{{1.0, 0.0}, {0.0, 1.0}}};
+
+        // Throws std::invalid_argument for non-positive indices, a transmittance outside [0, 1] or a zero axis
+        OpticalElement(
+            double outsideIndex,
+            double insideIndex,
+            const JonesMatrix& jones = k_identityJones,
+            const Vector<3>& localAxis = Vector<3>({1.0, 0.0, 0.0}),
+            double transmittance = 1.0
+        );
+
+        // Lossy dielectric window of index refractiveIndex; transmittance is the bulk loss of one pass
+        [[nodiscard]] static OpticalElement window(double refractiveIndex, double transmittance = 1.0, double outsideIndex = 1.0);
+
+        // Linear polariser transmitting along localAxis; extinctionRatio is the intensity transmitted across it
+        [[nodiscard]] static OpticalElement polariser(
+            const Vector<3>& localAxis,
+            double extinctionRatio = 0.0,
+            double refractiveIndex = 1.0,
+            double outsideIndex = 1.0
+        );
+
+        // Linear retarder delaying the component across localFastAxis by retardance (rad); pi/2 -> quarter wave
+        [[nodiscard]] static OpticalElement waveplate(
+            const Vector<3>& localFastAxis,
+            double retardance,
+            double refractiveIndex = 1.0,
+            double outsideIndex = 1.0
+        );
+
+        // Crossing method
+        //
+        // Act on a photon at the surface of its owning object; worldNormal is the unit outward or inward normal at the
+        // crossing and entering is true when the photon passes from outside to inside. Updates the polarisation only;
+        // the caller reflects or removes the photon according to the outcome
+        [[nodiscard]] OpticalOutcome apply(Photon& photon, const Object& surface, const Vector<3>& worldNormal, bool entering) const;
+
+        // Getters
+        [[nodiscard]] constexpr double getOutsideIndex() const noexcept { return this->m_outsideIndex; }
+        [[nodiscard]] constexpr double getInsideIndex() const noexcept { return this->m_insideIndex; }
+        [[nodiscard]] constexpr const MuellerMatrix& getMuellerMatrix() const noexcept { return this->m_mueller; }
+
+        // Reflectance method
+        //
+        // Unpolarised reflectance (Rs + Rp) / 2 at the given incidence angle cosine, from the precomputed table
+        [[nodiscard]] double reflectance(double cosIncidence, bool entering) const noexcept;
+
+    private:
+        struct FresnelSample {
+            double rs = 0.0;          // Reflectance, s component
+            double rp = 0.0;          // Reflectance, p component
+            double reflectedRe = 0.0; // Re(r_s r_p*)
+            double reflectedIm = 0.0; // Im(r_s r_p*)
+            double ts = 1.0;          // Transmittance, s component
+            double tp = 1.0;          // Transmittance, p component
+            double transmitted = 1.0; // sqrt(Ts Tp), as t_s and t_p are real outside total internal reflection
+        };
+
+        double m_outsideIndex;
+        double m_insideIndex;
+        std::array<double, 3> m_localAxis{};
+        MuellerMatrix m_mueller{};
+        bool m_identityMueller = false; // Skip the element frame and multiply when it would not change the photon
+        bool m_indexMatched = false;    // No reflection, so no draw
+        std::vector<FresnelSample> m_entering; // Indexed by cos(incidence) in [0, 1]
+        std::vector<FresnelSample> m_leaving;
+
+        [[nodiscard]] static std::vector<FresnelSample> buildFresnelTable(double incidentIndex, double transmittedIndex);
+        [[nodiscard]] static FresnelSample lookup(const std::vector<FresnelSample>& table, double cosIncidence) noexcept;
+};
+
+#endif //PHYSICS_SIMULATION_PROGRAM_OPTICAL_ELEMENT_H
@@ -12,9 +12,7 @@
 
 #include "physics/processes/discrete/core/decay_utilities.h"
 
-#include <algorithm>
 #include <limits>
-#include <random>
 
 #include "core/random/random_manager.h"
 
@@ -25,12 +23,7 @@ namespace discrete_interaction {
             return {std::numeric_limits<double>::infinity(), lifetime.unit};
         }
 
-        auto &rng = random_manager::engine(random_manager::Stream::DiscreteInteractions);
-        std::uniform_real_distribution uniform(0.0, 1.0);
-        double u = uniform(rng);
-        u = std::clamp(u, std::numeric_limits<double>::min(), 1.0 - std::numeric_limits<double>::epsilon());
-
-        const double factor = -std::log(u);
+        const double factor = random_manager::exponentialVariate(random_manager::Stream::DiscreteInteractions);
         return lifetime * factor;
     }
 } // namespace discrete_interaction
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "core/quantities/units.h"
+#include "core/tracing/tracing.h"
 #include "physics/processes/discrete/core/interaction_process_registry.h"
 
 namespace discrete_interaction {
@@ -49,22 +50,34 @@ namespace discrete_interaction {
         const Particle &particle,
         const Object *medium
     ) {
+        TRACE_SCOPE("sampleInteractionEvent");
         InteractionSample result{};
         result.length = infiniteInteractionLength();
 
-        const auto channelLengths = computeChannelInteractionLengths(particle, medium);
-        if (channelLengths.empty()) {
+        if (medium == nullptr) {
             return result;
         }
 
+        // Same channels and sampling order as computeChannelInteractionLengths, but walks the registry directly so the
+        // per-step call does not build intermediate vectors
         bool assigned = false;
-        for (const auto &[channel, length]: channelLengths) {
+        for (const auto *process : registeredInteractionProcesses()) {
+            if (process == nullptr || !process->isApplicable(particle, medium)) {
+                continue;
+            }
+
+            const auto channel = process->buildChannel(particle, medium);
+            if (!channel.has_value() || channel->process == nullptr) {
+                continue;
+            }
+
+            const auto length = channel->process->sampleLength(particle, medium, *channel);
             if (!std::isfinite(length.value) || length.value <= 0.0) {
                 continue;
             }
 
             if (!assigned || length.value < result.length.value) {
-                result.process = channel.process;
+                result.process = channel->process;
                 result.length = length;
                 assigned = true;
             }
@@ -23,6 +23,8 @@
 #include <string_view>
 
 #include "core/quantities/units.h"
+#include "core/random/random_manager.h"
+#include "core/tracing/tracing.h"
 #include "databases/material-data/material_database.h"
 #include "databases/particle-data/particle_database.h"
 #include "particles/particle-types/atom.h"
@@ -95,11 +97,7 @@ namespace discrete_interaction::photon_absorption {
         }
 
         const auto meanFreePath = Quantity::dimensionless(1.0) / channel.macroscopicCrossSection;
-        auto &rngEngine = rng();
-        std::uniform_real_distribution uniform(0.0, 1.0);
-        auto draw = uniform(rngEngine);
-        draw = std::clamp(draw, std::numeric_limits<double>::min(), 1.0 - std::numeric_limits<double>::epsilon());
-        const double opticalDepth = -std::log(draw);
+        const double opticalDepth = random_manager::exponentialVariate(random_manager::Stream::DiscreteInteractions);
         return meanFreePath * opticalDepth;
     }
 
@@ -107,6 +105,7 @@ namespace discrete_interaction::photon_absorption {
         if (!particle) {
             return;
         }
+        TRACE_SCOPE("photon_absorption::apply");
 
         if (particle->getType() != "photon" || !particle->getAlive()) {
             logInteractionWarning(k_photonAbsorptionTag, "Invalid particle state; interaction skipped");
@@ -20,6 +20,7 @@
 #include <string_view>
 
 #include "config/program_config.h"
+#include "core/tracing/tracing.h"
 #include "databases/particle-data/particle_database.h"
 #include "particles/particle-types/photon.h"
 #include "physics/distributions.h"
@@ -55,6 +56,7 @@ namespace discrete_interaction::spontaneous_emission {
         if (!particle) {
             return;
         }
+        TRACE_SCOPE("spontaneous_emission::apply");
 
         (void) medium;
 
@@ -0,0 +1,144 @@
+//
+// Physics Simulation Program
+// File: daemon_client.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of daemon_client.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/daemon/daemon_client.h"
+
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace daemon_client {
+    bool submit(
+        const std::filesystem::path& socketPath,
+        const nlohmann::json& request,
+        const std::function<void(const nlohmann::json&)>& onReply
+    ) {
+        const int socket = connectTo(socketPath);
+        bool succeeded = true;
+        try {
+            if (!sendLine(socket, request.dump())) {
+                throw std::runtime_error(std::format("Daemon at '{}' closed the connection", socketPath.string()));
+            }
+            std::string buffer;
+            std::string line;
+            while (readLine(socket, buffer, line)) {
+                const auto reply = nlohmann::json::parse(line);
+                succeeded = reply.value("event", "") != "error";
+                onReply(reply);
+            }
+        } catch (const nlohmann::json::exception& error) {
+            closeSocket(socket);
+            throw std::runtime_error(std::format("Malformed reply from the daemon: {}", error.what()));
+        } catch (...) {
+            closeSocket(socket);
+            throw;
+        }
+        closeSocket(socket);
+        return succeeded;
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    int connectTo(const std::filesystem::path& socketPath) {
+        sockaddr_un address{};
+        const auto path = socketPath.string();
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error(std::format("Daemon socket path '{}' is too long", path));
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        const int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0) {
+            throw std::runtime_error(std::format("Failed to create daemon socket: {}", std::strerror(errno)));
+        }
+        if (connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            const int error = errno;
+            close(socket);
+            throw std::runtime_error(std::format("No daemon is listening on '{}': {}", path, std::strerror(error)));
+        }
+        return socket;
+    }
+
+    bool sendLine(const int socket, const std::string_view text) noexcept {
+#ifdef MSG_NOSIGNAL
+        constexpr int flags = MSG_NOSIGNAL; // A vanished peer is reported as an error rather than SIGPIPE
+#else
+        constexpr int flags = 0;
+#endif
+        for (const auto part : {text, std::string_view("\n")}) {
+            std::size_t sent = 0;
+            while (sent < part.size()) {
+                const auto written = send(socket, part.data() + sent, part.size() - sent, flags);
+                if (written < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (written <= 0) {
+                    return false;
+                }
+                sent += static_cast<std::size_t>(written);
+            }
+        }
+        return true;
+    }
+
+    bool readLine(const int socket, std::string& buffer, std::string& line) {
+        std::size_t searched = 0;
+        while (true) {
+            if (const auto newline = buffer.find('\n', searched); newline != std::string::npos) {
+                line.assign(buffer, 0, newline);
+                buffer.erase(0, newline + 1);
+                return true;
+            }
+            searched = buffer.size();
+            if (buffer.size() > k_maxLineBytes) {
+                throw std::runtime_error(std::format("Message exceeds {} bytes", k_maxLineBytes));
+            }
+
+            char chunk[4096];
+            const auto received = recv(socket, chunk, sizeof(chunk), 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received < 0) {
+                throw std::runtime_error(std::format("Failed to read from socket: {}", std::strerror(errno)));
+            }
+            if (received == 0) {
+                return false; // A partial line at close is dropped
+            }
+            buffer.append(chunk, static_cast<std::size_t>(received));
+        }
+    }
+
+    void closeSocket(const int socket) noexcept {
+        if (socket >= 0) {
+            close(socket);
+        }
+    }
+#else
+    int connectTo(const std::filesystem::path& socketPath) {
+        throw std::runtime_error(std::format("Cannot reach '{}': the run daemon requires POSIX sockets", socketPath.string()));
+    }
+
+    bool sendLine(int, std::string_view) noexcept { return false; }
+
+    bool readLine(int, std::string&, std::string&) { return false; }
+
+    void closeSocket(int) noexcept {}
+#endif
+} // namespace daemon_client
@@ -0,0 +1,64 @@
+//
+// Physics Simulation Program
+// File: daemon_client.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Client side of the run daemon protocol, plus the line-based socket helpers both sides share
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_DAEMON_CLIENT_H
+#define PHYSICS_SIMULATION_PROGRAM_DAEMON_CLIENT_H
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+// daemon_client
+//
+// Notes on initialisation:
+//   - Depends only on nlohmann_json and POSIX sockets (no databases), so the client program starts instantly
+//
+// Notes on algorithms:
+//   - Messages are single lines of JSON; readLine() keeps whatever follows the newline in buffer for the next call and
+//     fails lines longer than k_maxLineBytes so a runaway peer cannot exhaust memory
+//
+// Supported overloads / operations and functions / methods:
+//   - Submission:             submit()
+//   - Socket helpers:         connectTo(), sendLine(), readLine(), closeSocket()
+//
+// Example usage:
+//   const bool ok = daemon_client::submit(config::paths::daemonSocketPath, request, [](const nlohmann::json& reply) {
+//       std::cout << reply.dump() << '\n';
+//   });
+namespace daemon_client {
+    inline constexpr std::size_t k_maxLineBytes = std::size_t{64} << 20; // Scenarios with inline geometry stay far below
+
+    // Send request to the daemon at socketPath and pass every reply line to onReply until the daemon closes the
+    // connection; returns false if the last reply was an error. Throws std::runtime_error if the daemon cannot be
+    // reached or a reply is malformed
+    bool submit(const std::filesystem::path& socketPath,
+                const nlohmann::json& request,
+                const std::function<void(const nlohmann::json&)>& onReply);
+
+    // Connect to a Unix socket; throws std::runtime_error on failure
+    [[nodiscard]] int connectTo(const std::filesystem::path& socketPath);
+
+    // Write text and a newline; false if the peer has gone
+    bool sendLine(int socket, std::string_view text) noexcept;
+
+    // Next line (without its newline) into line; false once the peer closes. Throws std::runtime_error if the line
+    // exceeds k_maxLineBytes or the read fails
+    [[nodiscard]] bool readLine(int socket, std::string& buffer, std::string& line);
+
+    void closeSocket(int socket) noexcept;
+} // namespace daemon_client
+
+#endif //PHYSICS_SIMULATION_PROGRAM_DAEMON_CLIENT_H
@@ -0,0 +1,292 @@
+//
+// Physics Simulation Program
+// File: run_daemon.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of run_daemon.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/daemon/run_daemon.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "config/program_config.h"
+#include "core/random/random_manager.h"
+#include "objects/object_manager.h"
+#include "simulation/daemon/daemon_client.h"
+#include "simulation/scenarios/scenario_file.h"
+#include "simulation/scenarios/sweep_runner.h"
+#include "simulation/simulation_context.h"
+#include "simulation/stepping/step_manager.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace run_daemon {
+    namespace {
+        constexpr int k_pollIntervalMilliseconds = 200; // Bounds how long stop() waits for serve() to notice
+        constexpr int k_requestTimeoutSeconds = 10;     // A client that connects but never sends cannot hold the daemon
+
+        double secondsSince(const std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Replies are the only way a job reports back, so a failed send abandons the job
+        void reply(const int connection, const nlohmann::json& message) {
+            if (!daemon_client::sendLine(connection, message.dump())) {
+                throw std::runtime_error("Client disconnected");
+            }
+        }
+
+        // The request's scenario with its seed and run limits overridden
+        scenario_file::Scenario scenarioFor(const nlohmann::json& request) {
+            const auto it = request.find("scenario");
+            if (it == request.end() || !it->is_object()) {
+                throw std::invalid_argument("Request field '/scenario' must be an object");
+            }
+            auto document = *it;
+            if (const auto seed = request.find("seed"); seed != request.end()) {
+                document["seed"] = *seed;
+            }
+            if (const auto run = request.find("run"); run != request.end()) {
+                if (!run->is_object()) {
+                    throw std::invalid_argument("Request field '/run' must be an object");
+                }
+                document["run"].update(*run);
+            }
+            return scenario_file::parse(document);
+        }
+
+        std::size_t particleCount(ParticleManager& particles) {
+            const auto handle = particles.acquireReadHandle();
+            return handle.particles().size();
+        }
+    } // namespace
+
+#if defined(__unix__) || defined(__APPLE__)
+    RunDaemon::RunDaemon(std::filesystem::path socketPath) : m_socketPath(std::move(socketPath)) {
+        const auto path = this->m_socketPath.string();
+        sockaddr_un address{};
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error(std::format("Daemon socket path '{}' is too long", path));
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+        // A socket file nobody answers on is left over from a daemon that did not shut down cleanly
+        if (std::filesystem::exists(this->m_socketPath)) {
+            bool answered = false;
+            try {
+                daemon_client::closeSocket(daemon_client::connectTo(this->m_socketPath));
+                answered = true;
+            } catch (const std::runtime_error&) {
+                // Stale; removed below
+            }
+            if (answered) {
+                throw std::runtime_error(std::format("Another daemon is already listening on '{}'", path));
+            }
+            std::error_code ec;
+            std::filesystem::remove(this->m_socketPath, ec);
+        }
+
+        this->m_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (this->m_socket < 0) {
+            throw std::runtime_error(std::format("Failed to create daemon socket: {}", std::strerror(errno)));
+        }
+        if (bind(this->m_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+            || listen(this->m_socket, 8) < 0) {
+            const int error = errno;
+            close(this->m_socket);
+            throw std::runtime_error(std::format("Failed to listen on '{}': {}", path, std::strerror(error)));
+        }
+    }
+
+    RunDaemon::~RunDaemon() {
+        close(this->m_socket);
+        std::error_code ec;
+        std::filesystem::remove(this->m_socketPath, ec);
+    }
+
+    void RunDaemon::serve() {
+        while (this->m_running.load(std::memory_order_relaxed)) {
+            pollfd descriptor{this->m_socket, POLLIN, 0};
+            if (poll(&descriptor, 1, k_pollIntervalMilliseconds) <= 0) {
+                continue;
+            }
+            const int connection = accept(this->m_socket, nullptr, nullptr);
+            if (connection < 0) {
+                continue;
+            }
+
+            timeval timeout{k_requestTimeoutSeconds, 0};
+            setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            this->handleConnection(connection);
+            close(connection);
+        }
+    }
+#else
+    RunDaemon::RunDaemon(std::filesystem::path socketPath) : m_socketPath(std::move(socketPath)) {
+        throw std::runtime_error(std::format("Cannot listen on '{}': the run daemon requires POSIX sockets", this->m_socketPath.string()));
+    }
+
+    RunDaemon::~RunDaemon() = default;
+
+    void RunDaemon::serve() {}
+#endif
+
+    void RunDaemon::handleConnection(const int connection) {
+        nlohmann::json request;
+        try {
+            std::string buffer;
+            std::string line;
+            if (!daemon_client::readLine(connection, buffer, line)) {
+                return;
+            }
+            request = nlohmann::json::parse(line);
+            if (!request.is_object()) {
+                throw std::invalid_argument("Request must be a JSON object");
+            }
+        } catch (const std::exception& error) {
+            (void)daemon_client::sendLine(connection, nlohmann::json{{"event", "error"}, {"message", error.what()}}.dump());
+            return;
+        }
+
+        if (const auto command = request.value("command", "run"); command == "ping") {
+            (void)daemon_client::sendLine(connection, nlohmann::json{
+                {"event", "pong"}, {"jobs_completed", this->m_jobsCompleted}, {"cached_worlds", this->m_worlds.size()}
+            }.dump());
+        } else if (command == "clear-cache") {
+            const auto destroyed = this->clearWorlds();
+            (void)daemon_client::sendLine(connection, nlohmann::json{{"event", "cache-cleared"}, {"worlds", destroyed}}.dump());
+        } else if (command == "shutdown") {
+            this->stop();
+            (void)daemon_client::sendLine(connection, nlohmann::json{{"event", "shutdown"}}.dump());
+        } else if (command == "run") {
+            this->runJob(connection, request);
+        } else {
+            (void)daemon_client::sendLine(connection, nlohmann::json{
+                {"event", "error"}, {"message", std::format("Unknown command '{}'", command)}
+            }.dump());
+        }
+    }
+
+    void RunDaemon::runJob(const int connection, const nlohmann::json& request) {
+        const auto job = this->m_nextJob++;
+        try {
+            const auto setupStart = std::chrono::steady_clock::now();
+            const auto scenario = scenarioFor(request);
+            bool cached = false;
+            auto* world = this->worldFor(scenario.geometry, cached);
+            const auto* detector = scenario_file::findObject(world, scenario.detector);
+
+            const auto outputFolder = std::filesystem::path(config::paths::outputDirectory) / "daemon" / std::format("job_{}", job);
+            SimulationContext context(outputFolder.string());
+            context.setWorld(world);
+            if (const auto threads = request.find("threads"); threads != request.end()) {
+                context.setWorkerThreads(threads->get<std::size_t>());
+            }
+            context.setRandomSeed(scenario.seed);
+            const random_manager::ScopedThreadMasterSeed seedScope(scenario.seed); // Source sampling on this thread
+            const double setupSeconds = secondsSince(setupStart);
+
+            reply(connection, {
+                {"event", "accepted"}, {"job", job}, {"name", scenario.name}, {"seed", scenario.seed},
+                {"geometry_cached", cached}, {"threads", context.workerThreads()}
+            });
+
+            const auto generationStart = std::chrono::steady_clock::now();
+            scenario_file::generateParticles(scenario, context.particles());
+            const double generationSeconds = secondsSince(generationStart);
+
+            const auto steppingStart = std::chrono::steady_clock::now();
+            const auto& dt = scenario.run.timeStep;
+            const auto chunk = dt * static_cast<double>(config::program::daemonProgressInterval);
+            while (true) {
+                auto target = context.clock().currentTime() + chunk;
+                const bool finalChunk = scenario.run.endTime && target.value >= scenario.run.endTime->value;
+                if (finalChunk) {
+                    target = *scenario.run.endTime;
+                }
+                stepUntilTime(context, detector, target, dt);
+
+                const auto alive = particleCount(context.particles());
+                reply(connection, {
+                    {"event", "progress"}, {"job", job}, {"time_seconds", context.clock().currentTime().value},
+                    {"particles_alive", alive}, {"particles_spilled", context.spill().size()},
+                    {"steps", context.statistics().totals().steps}
+                });
+                if (finalChunk || (!scenario.run.endTime && alive == 0 && context.spill().empty())) {
+                    break;
+                }
+            }
+            const double steppingSeconds = secondsSince(steppingStart);
+
+            auto result = nlohmann::json{
+                {"event", "result"},
+                {"job", job},
+                {"name", scenario.name},
+                {"setup_seconds", setupSeconds},
+                {"generation_seconds", generationSeconds},
+                {"stepping_seconds", steppingSeconds},
+                {"particles_discarded", particleCount(context.particles()) + context.spill().size()},
+                {"output_folder", outputFolder.string()}
+            };
+            result.update(sweep_runner::toJson(context.statistics().totals()));
+            ++this->m_jobsCompleted;
+            reply(connection, result);
+        } catch (const std::exception& error) {
+            std::cerr << std::format("Daemon job {} failed: {}\n", job, error.what());
+            (void)daemon_client::sendLine(connection, nlohmann::json{
+                {"event", "error"}, {"job", job}, {"message", error.what()}
+            }.dump());
+        }
+    }
+
+    // Jobs run one at a time, so no cached world is in use while this runs
+    Object* RunDaemon::worldFor(const nlohmann::json& geometry, bool& cached) {
+        auto key = geometry.dump();
+        if (const auto it = this->m_worlds.find(key); it != this->m_worlds.end()) {
+            cached = true;
+            it->second.lastUsed = this->m_nextJob;
+            return it->second.world;
+        }
+
+        cached = false;
+        auto* world = scenario_file::buildGeometry(geometry);
+        if (constexpr auto capacity = config::program::daemonWorldCacheSize; capacity > 0) {
+            while (this->m_worlds.size() >= capacity) {
+                const auto oldest = std::ranges::min_element(
+                    this->m_worlds, {}, [](const auto& entry) { return entry.second.lastUsed; });
+                g_objectManager.destroyWorld(oldest->second.world);
+                this->m_worlds.erase(oldest);
+            }
+        }
+        this->m_worlds.emplace(std::move(key), CachedWorld{world, this->m_nextJob});
+        return world;
+    }
+
+    std::size_t RunDaemon::clearWorlds() {
+        const auto count = this->m_worlds.size();
+        for (const auto& [key, entry] : this->m_worlds) {
+            g_objectManager.destroyWorld(entry.world);
+        }
+        this->m_worlds.clear();
+        return count;
+    }
+} // namespace run_daemon
@@ -0,0 +1,110 @@
+//
+// Physics Simulation Program
+// File: run_daemon.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Long-running process accepting scenario runs over a local Unix socket, reusing loaded databases and geometry
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_RUN_DAEMON_H
+#define PHYSICS_SIMULATION_PROGRAM_RUN_DAEMON_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+#include "config/path_config.h"
+#include "objects/object.h"
+
+// run_daemon
+//
+// Notes on initialisation:
+//   - Constructing a RunDaemon binds the socket (replacing a stale socket file, but refusing if another daemon still
+//     answers on it); serve() then blocks until a shutdown request or stop()
+//   - The databases are loaded once by static initialisation, so every job after the first skips that cost
+//
+// Notes on algorithms:
+//   - One request per connection, as a single line of JSON; connections are served one at a time, so jobs run one at
+//     a time, each using every worker thread of stepAll. A job runs in a fresh SimulationContext seeded with the
+//     scenario seed (setRandomSeed, plus a ScopedThreadMasterSeed for source sampling), leaving the global context's
+//     seed untouched
+//   - Built worlds are cached by their geometry JSON and reused by later jobs with identical geometry. Their geometry
+//     is never changed, but each stepUntil* call writes the job's field into their volumes (cacheVolumeFields), so a
+//     cached world must not be stepped by two jobs at once. The cache holds at most config::program::daemonWorldCacheSize worlds; building one more
+//     destroys the least recently used (in g_objectManager too), so memory stays bounded however varied the geometries.
+//     The "clear-cache" command destroys every cached world
+//   - Jobs step in chunks of config::program::daemonProgressInterval stepAll calls with a progress message after
+//     each; a job without an end time stops at the first chunk boundary with no particles left, so its clock may
+//     run past the last particle by up to one chunk
+//   - A client that disconnects mid-job makes the next message fail, which abandons the job
+//
+// Notes on output:
+//   - Replies are lines of JSON with an "event" field: "accepted", "progress" (simulation time, particles alive,
+//     steps so far), then "result" (timings and step counters, see sweep_runner::toJson) or "error" (message);
+//     "clear-cache" answers "cache-cleared" with the number of worlds destroyed
+//   - Detector logs of each job go to <outputDirectory>/daemon/job_<n>/
+//
+// Supported overloads / operations and functions / methods:
+//   - Serving:                RunDaemon::serve(), RunDaemon::stop()
+//   - Getters:                RunDaemon::socketPath(), RunDaemon::jobsCompleted()
+//   - Client:                 see daemon_client.h
+//
+// Example usage:
+//   run_daemon::RunDaemon daemon;   // Simulation_program --daemon
+//   daemon.serve();
+//
+// Example requests:
+//   {"scenario": {...scenario file contents...}, "seed": 7, "run": {"end_time": {"value": 1e-9, "unit": "s"}}}
+//   {"command": "ping"}
+//   {"command": "clear-cache"}
+//   {"command": "shutdown"}
+namespace run_daemon {
+    // RunDaemon
+    //
+    // Serves run requests on a Unix socket; available on POSIX systems only
+    class RunDaemon {
+        public:
+            explicit RunDaemon(std::filesystem::path socketPath = config::paths::daemonSocketPath);
+
+            RunDaemon(const RunDaemon&) = delete;
+            RunDaemon& operator=(const RunDaemon&) = delete;
+
+            ~RunDaemon();
+
+            // Handle connections until a shutdown request or stop()
+            void serve();
+            void stop() noexcept { this->m_running.store(false, std::memory_order_relaxed); }
+
+            [[nodiscard]] const std::filesystem::path& socketPath() const noexcept { return this->m_socketPath; }
+            [[nodiscard]] std::size_t jobsCompleted() const noexcept { return this->m_jobsCompleted; }
+
+        private:
+            void handleConnection(int connection);
+            void runJob(int connection, const nlohmann::json& request);
+            [[nodiscard]] Object* worldFor(const nlohmann::json& geometry, bool& cached);
+            std::size_t clearWorlds();
+
+            struct CachedWorld {
+                Object* world = nullptr;
+                std::uint64_t lastUsed = 0; // Value of m_nextJob when last requested, for least recently used eviction
+            };
+
+            std::filesystem::path m_socketPath;
+            int m_socket = -1;
+            std::atomic<bool> m_running{true};
+            std::size_t m_jobsCompleted = 0;
+            std::size_t m_nextJob = 1;
+            std::unordered_map<std::string, CachedWorld> m_worlds; // Keyed by the geometry JSON
+    };
+} // namespace run_daemon
+
+#endif //PHYSICS_SIMULATION_PROGRAM_RUN_DAEMON_H
@@ -12,6 +12,8 @@
 
 #include "particle_collection.h"
 
+#include <chrono>
+#include <cstdio>
 #include <filesystem>
 #include <format>
 #include <fstream>
@@ -23,43 +25,22 @@
 #include <unordered_map>
 
 #include "particles/particle-types/atom.h"
+#include "core/tracing/lock_profiling.h"
+#include "core/tracing/memory_accounting.h"
+#include "core/tracing/metrics.h"
+#include "core/tracing/tracing.h"
 #include "particles/particle-types/photon.h"
+#include "simulation/stepping/step_statistics.h"
 
 namespace {
-    // Per-detector logging state so we only create folders/files once per run
-    struct DetectorLogContext {
-        std::filesystem::path baseFolder;                                        // Detector-specific output root
-        std::string baseFilename;                                                // Prefix used when creating new CSV files
-        std::unordered_map<std::string, std::unique_ptr<std::ofstream>> streams; // Cache of open streams keyed by particle type
-        std::mutex mutex;                                                        // Guards stream map and file writes
-    };
-
-    std::shared_ptr<DetectorLogContext> getContext(
-        const Object *detector,
-        const std::string_view baseFolder,
-        const std::string_view baseFilename
-    ) {
-        static std::mutex contextMapMutex;
-        static std::unordered_map<const Object *, std::shared_ptr<DetectorLogContext>> contextMap;
-
-        std::scoped_lock mapLock(contextMapMutex);
-        auto it = contextMap.find(detector);
-        if (it == contextMap.end()) {
-            auto context = std::make_shared<DetectorLogContext>();
-            context->baseFolder = std::filesystem::path(baseFolder);
-            context->baseFilename = std::string(baseFilename);
-            std::error_code ec;
-            std::filesystem::create_directories(context->baseFolder, ec);
-            if (ec) {
-                std::cerr << std::format(
-                    "Failed to create detector base folder '{}' : {}\n",
-                    context->baseFolder.string(),
-                    ec.message()
-                );
-            }
-            it = contextMap.emplace(detector, std::move(context)).first;
-        }
-        return it->second;
+    // Acquire mutex, adding the time spent waiting to the calling thread's step statistics
+    std::unique_lock<lock_profiling::ProfiledMutex> lockTimed(lock_profiling::ProfiledMutex &mutex) {
+        const auto waitStart = std::chrono::steady_clock::now();
+        std::unique_lock lock(mutex);
+        StepStatistics::local().detectorLockWaitNanoseconds += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - waitStart).count()
+        );
+        return lock;
     }
 
     std::string sanitiseComponent(const std::string_view component) {
@@ -91,15 +72,25 @@ namespace {
         }
         return std::nullopt;
     }
+} // namespace
+
+// Per-detector logging state so we only create folders/files once per run
+struct DetectorLogs::Context {
+    std::filesystem::path baseFolder;                                        // Detector-specific output root
+    std::string baseFilename;                                                // Prefix used when creating new CSV files
+    std::unordered_map<std::string, std::unique_ptr<std::ofstream>> streams; // Cache of open streams keyed by particle type
+    lock_profiling::ProfiledMutex mutex{"detector_stream"};                  // Guards stream map and file writes
+    memory_accounting::TrackedBytes memory{memory_accounting::Category::DetectorStreams}; // Open streams and their buffers
+    metrics::Metric* hits = nullptr;                                         // Live count of logged particles (global logs only)
 
     // Retrieve (or lazily create) the CSV stream associated with a particle type
-    // Callers must hold context.mutex before invoking this helper
-    std::ofstream *getStreamLocked(DetectorLogContext &context, const std::string &type) {
-        if (const auto existing = context.streams.find(type); existing != context.streams.end()) {
+    // Callers must hold mutex before invoking this helper
+    std::ofstream *getStreamLocked(const std::string &type) {
+        if (const auto existing = this->streams.find(type); existing != this->streams.end()) {
             return existing->second.get();
         }
 
-        const auto folder = context.baseFolder / sanitiseComponent(type);
+        const auto folder = this->baseFolder / sanitiseComponent(type);
         std::error_code ec;
         std::filesystem::create_directories(folder, ec);
         if (ec) {
@@ -107,7 +98,7 @@ namespace {
             return nullptr;
         }
 
-        const auto filename = reserveLogFile(folder, context.baseFilename);
+        const auto filename = reserveLogFile(folder, this->baseFilename);
         if (!filename) {
             std::cerr << std::format("Failed to reserve detector log filename inside '{}'\n", folder.string());
             return nullptr;
@@ -119,27 +110,81 @@ namespace {
             return nullptr;
         }
 
-        auto [entryIt, inserted] = context.streams.emplace(type, std::move(file));
+        auto [entryIt, inserted] = this->streams.emplace(type, std::move(file));
         (void)inserted;
+        this->memory.resize(this->streams.size() * (sizeof(std::ofstream) + BUFSIZ), this->streams.size());
         return entryIt->second.get();
     }
-} // namespace
+};
 
-void logEnergyIfInside(
+DetectorLogs g_detectorLogs(config::paths::outputDirectory, true);
+
+DetectorLogs::DetectorLogs(const std::string_view outputRoot, const bool publishMetrics)
+    : m_outputRoot(outputRoot), m_publishMetrics(publishMetrics) {}
+
+DetectorLogs::~DetectorLogs() = default;
+
+std::shared_ptr<DetectorLogs::Context> DetectorLogs::getContext(
+    const Object *detector,
+    const std::string_view baseFolder,
+    const std::string_view baseFilename
+) {
+    const auto mapLock = lockTimed(this->m_mutex);
+    auto it = this->m_contexts.find(detector);
+    if (it == this->m_contexts.end()) {
+        auto context = std::make_shared<Context>();
+        context->baseFolder = std::filesystem::path(baseFolder);
+        context->baseFilename = std::string(baseFilename);
+        if (this->m_publishMetrics) {
+            context->hits = &metrics::metric(
+                "simulation_detector_hits_total", "Particles logged by each detector", metrics::Type::Counter,
+                metrics::label("detector", detector->getName()));
+        }
+        std::error_code ec;
+        std::filesystem::create_directories(context->baseFolder, ec);
+        if (ec) {
+            std::cerr << std::format(
+                "Failed to create detector base folder '{}' : {}\n",
+                context->baseFolder.string(),
+                ec.message()
+            );
+        }
+        it = this->m_contexts.emplace(detector, std::move(context)).first;
+    }
+    return it->second;
+}
+
+void DetectorLogs::close() {
+    std::scoped_lock lock(this->m_mutex);
+    this->m_contexts.clear(); // Streams close once no logger still holds their context
+}
+
+void DetectorLogs::setOutputRoot(const std::string_view folder) {
+    std::scoped_lock lock(this->m_mutex);
+    this->m_contexts.clear();
+    this->m_outputRoot = std::string(folder);
+}
+
+void DetectorLogs::logEnergyIfInside(std::unique_ptr<Particle> &particle, const Object *detector) {
+    this->logEnergyIfInside(particle, detector, this->m_outputRoot, config::paths::filenamePrefix);
+}
+
+void DetectorLogs::logEnergyIfInside(
     std::unique_ptr<Particle> &particle,
     const Object *detector,
-    const std::string_view &baseFolder,
-    const std::string_view &baseFilename
+    const std::string_view baseFolder,
+    const std::string_view baseFilename
 ) {
     if (!particle || detector == nullptr) { return; }
 
     if (!detector->contains(particle->getPosition())) { return; }
+    TRACE_SCOPE("logEnergyIfInside");
 
-    auto context = getContext(detector, baseFolder, baseFilename);
+    auto context = this->getContext(detector, baseFolder, baseFilename);
     if (!context) { return; }
 
-    std::scoped_lock lock(context->mutex);
-    if (auto *stream = getStreamLocked(*context, particle->getType())) {
+    const auto lock = lockTimed(context->mutex);
+    if (auto *stream = context->getStreamLocked(particle->getType())) {
         *stream << particle->getEnergy();
 
         if (const auto *atom = dynamic_cast<const Atom*>(particle.get())) {
@@ -149,6 +194,30 @@ void logEnergyIfInside(
         }
 
         *stream << "\n";
+        if (context->hits != nullptr) {
+            context->hits->add(1.0);
+        }
         particle.reset();
     }
 }
+
+void closeDetectorLogs() {
+    g_detectorLogs.close();
+}
+
+void setDetectorOutputRoot(const std::string_view folder) {
+    g_detectorLogs.setOutputRoot(folder);
+}
+
+std::string_view detectorOutputRoot() noexcept {
+    return g_detectorLogs.outputRoot();
+}
+
+void logEnergyIfInside(
+    std::unique_ptr<Particle> &particle,
+    const Object *detector,
+    const std::string_view &baseFolder,
+    const std::string_view &baseFilename
+) {
+    g_detectorLogs.logEnergyIfInside(particle, detector, baseFolder, baseFilename);
+}
@@ -14,12 +14,89 @@
 #define PHYSICS_SIMULATION_PROGRAM_PARTICLE_COLLECTION_H
 
 #include <memory>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include "config/path_config.h"
+#include "core/tracing/lock_profiling.h"
 #include "objects/object.h"
 #include "particles/particle.h"
 
+// DetectorLogs
+//
+// Notes on initialisation:
+//   - Logs into config::paths::outputDirectory unless given another root; a global instance g_detectorLogs backs the
+//     free functions below and each owning SimulationContext has its own, so concurrent runs never share a file
+//   - Only an instance constructed with publishMetrics (g_detectorLogs, the global context's) counts its hits in the
+//     simulation_detector_hits_total metric, so other contexts never add to the process-wide counters
+//
+// Notes on algorithms:
+//   - One logging context per detector is created on its first hit (folders made once) and holds an open CSV stream
+//     per particle type, each guarded by the context's mutex
+//
+// Supported overloads / operations and functions / methods:
+//   - Logging:                logEnergyIfInside()
+//   - Output root:            setOutputRoot(), outputRoot()
+//   - Closing:                close()
+//   - Global instance:        g_detectorLogs
+//
+// Example usage:
+//   DetectorLogs logs("Output/run_2");
+//   logs.logEnergyIfInside(particle, detector);
+//   logs.close();
+class DetectorLogs {
+    public:
+        explicit DetectorLogs(std::string_view outputRoot = config::paths::outputDirectory, bool publishMetrics = false);
+        ~DetectorLogs();
+
+        DetectorLogs(const DetectorLogs&) = delete;
+        DetectorLogs& operator=(const DetectorLogs&) = delete;
+
+        // Logging methods
+        //
+        // Log the particle's energy (and polarisation when available) when it intersects the detector volume,
+        // deleting it afterwards; the short form logs under outputRoot()
+        void logEnergyIfInside(std::unique_ptr<Particle>& particle, const Object* detector);
+        void logEnergyIfInside(std::unique_ptr<Particle>& particle,
+                               const Object* detector,
+                               std::string_view baseFolder,
+                               std::string_view baseFilename = config::paths::filenamePrefix);
+
+        // Output root methods
+        //
+        // setOutputRoot() closes every open file first; neither may be called while stepAll is running, as
+        // outputRoot() is read without locking
+        void setOutputRoot(std::string_view folder);
+        [[nodiscard]] std::string_view outputRoot() const noexcept { return this->m_outputRoot; }
+
+        // Flush and close every open detector file so the next hit starts new files
+        void close();
+
+    private:
+        struct Context;
+
+        [[nodiscard]] std::shared_ptr<Context> getContext(const Object* detector,
+                                                          std::string_view baseFolder,
+                                                          std::string_view baseFilename);
+
+        lock_profiling::ProfiledMutex m_mutex{"detector_context_map"};
+        std::unordered_map<const Object*, std::shared_ptr<Context>> m_contexts;
+        std::string m_outputRoot;
+        bool m_publishMetrics;
+};
+
+extern DetectorLogs g_detectorLogs;
+
+// Detector log control methods
+//
+// Forward to g_detectorLogs: closeDetectorLogs() flushes and closes every open detector file so the next hit starts
+// new files; setDetectorOutputRoot() does the same and changes the folder stepping logs into
+// (config::paths::outputDirectory by default)
+void closeDetectorLogs();
+void setDetectorOutputRoot(std::string_view folder);
+[[nodiscard]] std::string_view detectorOutputRoot() noexcept;
+
 // Log the particle's energy (and polarisation when available) when it intersects the detector volume, deleting it afterwards
 void logEnergyIfInside(std::unique_ptr<Particle>& particle,
                        const Object* detector,
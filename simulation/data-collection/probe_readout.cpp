@@ -0,0 +1,340 @@
+//
+// Physics Simulation Program
+// File: probe_readout.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of probe_readout.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/data-collection/probe_readout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "config/program_config.h"
+#include "core/tracing/tracing.h"
+#include "particles/particle-types/atom.h"
+
+namespace {
+    constexpr double k_infinity = std::numeric_limits<double>::infinity();
+
+    // Split [0, count) into at most workerCount contiguous chunks, running the last one on the calling thread
+    template <typename Chunk>
+    void runChunks(const std::size_t count, const std::size_t workerCount, const Chunk& chunk) {
+        const std::size_t workers = std::max<std::size_t>(1, std::min(workerCount, count));
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+
+        std::size_t begin = 0;
+        for (std::size_t worker = 0; worker < workers; ++worker) {
+            const std::size_t end = begin + count / workers + (worker < count % workers ? 1 : 0);
+            if (worker + 1 == workers) {
+                chunk(begin, end, worker);
+            } else {
+                threads.emplace_back(chunk, begin, end, worker);
+            }
+            begin = end;
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+} // namespace
+
+ProbeReadout::ProbeReadout(
+    const Vector<3>& lowerCorner,
+    const Vector<3>& upperCorner,
+    const std::array<std::size_t, 3>& voxelCounts,
+    std::vector<ProbeRay> rays,
+    const double rotationCoefficient,
+    const double absorptionCrossSection,
+    const double atomWeight,
+    const Quantity& interval)
+    : m_voxelCounts(voxelCounts),
+      m_rotationCoefficient(rotationCoefficient),
+      m_absorptionCrossSection(absorptionCrossSection),
+      m_atomWeight(atomWeight),
+      m_interval(interval.value)
+{
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        if (lowerCorner[axis].unit != Unit::lengthDimension() || upperCorner[axis].unit != Unit::lengthDimension()) {
+            throw std::invalid_argument("ProbeReadout corners must have length dimensions");
+        }
+        if (voxelCounts[axis] == 0) {
+            throw std::invalid_argument(std::format("ProbeReadout requires at least 1 voxel per axis but axis {} has 0", axis));
+        }
+        const double extent = upperCorner[axis].asDouble() - lowerCorner[axis].asDouble();
+        if (!(extent > 0.0)) {
+            throw std::invalid_argument(std::format(
+                "ProbeReadout upper corner must exceed lower corner on axis {} (extent = {} m)",
+                axis,
+                extent
+            ));
+        }
+        this->m_lower[axis] = lowerCorner[axis].asDouble();
+        this->m_upper[axis] = upperCorner[axis].asDouble();
+        this->m_spacing[axis] = extent / static_cast<double>(voxelCounts[axis]);
+    }
+    if (!(rotationCoefficient >= 0.0) || !(absorptionCrossSection >= 0.0) || !(atomWeight >= 0.0)) {
+        throw std::invalid_argument(std::format(
+            "ProbeReadout coefficients must be non-negative but got rotation {}, cross section {}, atom weight {}",
+            rotationCoefficient,
+            absorptionCrossSection,
+            atomWeight
+        ));
+    }
+    if (interval.unit != Unit::timeDimension() || !(interval.value >= 0.0) || !std::isfinite(interval.value)) {
+        throw std::invalid_argument("ProbeReadout interval must be a non-negative finite time");
+    }
+
+    this->m_rays.reserve(rays.size());
+    for (const auto& ray : rays) {
+        if (!(ray.weight >= 0.0)) {
+            throw std::invalid_argument(std::format("Probe ray weight must be non-negative but got {}", ray.weight));
+        }
+        std::array<double, 3> direction{};
+        double length = 0.0;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            if (ray.origin[axis].unit != Unit::lengthDimension()) {
+                throw std::invalid_argument("Probe ray origin must have length dimensions");
+            }
+            direction[axis] = ray.direction[axis].asDouble();
+            length += direction[axis] * direction[axis];
+        }
+        length = std::sqrt(length);
+        if (!(length > 0.0) || !std::isfinite(length)) {
+            throw std::invalid_argument("Probe ray direction must be a finite non-zero vector");
+        }
+        for (auto& component : direction) {
+            component /= length;
+        }
+        this->m_rays.push_back({
+            {ray.origin[0].asDouble(), ray.origin[1].asDouble(), ray.origin[2].asDouble()},
+            direction,
+            ray.weight
+        });
+    }
+
+    this->m_grid.assign(voxelCounts[0] * voxelCounts[1] * voxelCounts[2], Voxel{});
+}
+
+double ProbeReadout::getVoxelVolume() const noexcept {
+    return this->m_spacing[0] * this->m_spacing[1] * this->m_spacing[2];
+}
+
+std::size_t ProbeReadout::voxelIndex(const std::size_t x, const std::size_t y, const std::size_t z) const noexcept {
+    return (z * this->m_voxelCounts[1] + y) * this->m_voxelCounts[0] + x;
+}
+
+bool ProbeReadout::due(const Quantity& time) const noexcept {
+    return time.value >= this->m_nextSample * (1.0 - config::program::geometryTolerance);
+}
+
+void ProbeReadout::deposit(
+    const std::vector<std::unique_ptr<Particle> >& particles,
+    const std::size_t begin,
+    const std::size_t end,
+    std::vector<Voxel>& grid,
+    std::size_t& atoms) const
+{
+    const double scale = this->m_atomWeight / this->getVoxelVolume();
+    for (std::size_t index = begin; index < end; ++index) {
+        const auto& particle = particles[index];
+        if (!particle || !particle->getAlive()) {
+            continue;
+        }
+        const auto* atom = dynamic_cast<const Atom*>(particle.get());
+        if (atom == nullptr) {
+            continue;
+        }
+
+        const auto& position = atom->getPosition();
+        std::array<std::size_t, 3> cell{};
+        bool inside = true;
+        for (std::size_t axis = 0; axis < 3 && inside; ++axis) {
+            const double offset = (position[axis].value - this->m_lower[axis]) / this->m_spacing[axis];
+            inside = offset >= 0.0 && offset < static_cast<double>(this->m_voxelCounts[axis]);
+            cell[axis] = inside ? static_cast<std::size_t>(offset) : 0;
+        }
+        if (!inside) {
+            continue;
+        }
+
+        const auto& spin = atom->getPolarisation();
+        auto& voxel = grid[this->voxelIndex(cell[0], cell[1], cell[2])];
+        voxel[0] += spin[0].value * scale;
+        voxel[1] += spin[1].value * scale;
+        voxel[2] += spin[2].value * scale;
+        voxel[3] += scale;
+        ++atoms;
+    }
+}
+
+ProbeReadout::Integral ProbeReadout::integrate(const Ray& ray) const noexcept {
+    // Slab clip of the forward ray against the box
+    double entry = 0.0;
+    double exit = k_infinity;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double origin = ray.origin[axis];
+        const double direction = ray.direction[axis];
+        if (direction == 0.0) {
+            if (origin < this->m_lower[axis] || origin > this->m_upper[axis]) {
+                return {};
+            }
+            continue;
+        }
+        double near = (this->m_lower[axis] - origin) / direction;
+        double far = (this->m_upper[axis] - origin) / direction;
+        if (near > far) {
+            std::swap(near, far);
+        }
+        entry = std::max(entry, near);
+        exit = std::min(exit, far);
+    }
+    if (!(exit > entry)) {
+        return {};
+    }
+
+    // 3D-DDA set up at the entry point
+    std::array<std::ptrdiff_t, 3> cell{};
+    std::array<std::ptrdiff_t, 3> step{};
+    std::array<double, 3> nextFace{};
+    std::array<double, 3> faceStep{};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double direction = ray.direction[axis];
+        const double point = ray.origin[axis] + direction * entry;
+        const auto last = static_cast<std::ptrdiff_t>(this->m_voxelCounts[axis]) - 1;
+        cell[axis] = std::clamp(static_cast<std::ptrdiff_t>(std::floor((point - this->m_lower[axis]) / this->m_spacing[axis])), std::ptrdiff_t{0}, last);
+        if (direction > 0.0) {
+            step[axis] = 1;
+            nextFace[axis] = (this->m_lower[axis] + static_cast<double>(cell[axis] + 1) * this->m_spacing[axis] - ray.origin[axis]) / direction;
+            faceStep[axis] = this->m_spacing[axis] / direction;
+        } else if (direction < 0.0) {
+            step[axis] = -1;
+            nextFace[axis] = (this->m_lower[axis] + static_cast<double>(cell[axis]) * this->m_spacing[axis] - ray.origin[axis]) / direction;
+            faceStep[axis] = -this->m_spacing[axis] / direction;
+        } else {
+            nextFace[axis] = k_infinity;
+            faceStep[axis] = k_infinity;
+        }
+    }
+
+    Integral integral{};
+    double position = entry;
+    while (position < exit) {
+        std::size_t axis = 0;
+        if (nextFace[1] < nextFace[axis]) { axis = 1; }
+        if (nextFace[2] < nextFace[axis]) { axis = 2; }
+
+        const double next = std::min(nextFace[axis], exit);
+        if (const double chord = next - position; chord > 0.0) {
+            const auto& voxel = this->m_grid[this->voxelIndex(
+                static_cast<std::size_t>(cell[0]),
+                static_cast<std::size_t>(cell[1]),
+                static_cast<std::size_t>(cell[2])
+            )];
+            integral.spin += (voxel[0] * ray.direction[0] + voxel[1] * ray.direction[1] + voxel[2] * ray.direction[2]) * chord;
+            integral.density += voxel[3] * chord;
+        }
+        position = next;
+
+        cell[axis] += step[axis];
+        if (cell[axis] < 0 || cell[axis] >= static_cast<std::ptrdiff_t>(this->m_voxelCounts[axis])) {
+            break;
+        }
+        nextFace[axis] += faceStep[axis];
+    }
+    return integral;
+}
+
+void ProbeReadout::sample(
+    const std::vector<std::unique_ptr<Particle> >& particles,
+    const Quantity& time,
+    const std::size_t workerCount)
+{
+    TRACE_SCOPE("ProbeReadout::sample");
+
+    // Deposition into one grid per worker, then summed into the readout's grid
+    const std::size_t depositWorkers = std::max<std::size_t>(1, std::min(workerCount, particles.size()));
+    std::vector<std::vector<Voxel> > grids(depositWorkers);
+    std::vector<std::size_t> atomCounts(depositWorkers, 0);
+    runChunks(particles.size(), depositWorkers, [&](const std::size_t begin, const std::size_t end, const std::size_t worker) {
+        grids[worker].assign(this->m_grid.size(), Voxel{});
+        this->deposit(particles, begin, end, grids[worker], atomCounts[worker]);
+    });
+
+    std::fill(this->m_grid.begin(), this->m_grid.end(), Voxel{});
+    std::size_t atoms = 0;
+    for (std::size_t worker = 0; worker < depositWorkers; ++worker) {
+        atoms += atomCounts[worker];
+        if (atomCounts[worker] == 0) {
+            continue;
+        }
+        for (std::size_t index = 0; index < this->m_grid.size(); ++index) {
+            for (std::size_t component = 0; component < 4; ++component) {
+                this->m_grid[index][component] += grids[worker][index][component];
+            }
+        }
+    }
+
+    // Ray integration, each ray written to its own slot
+    std::vector<Integral> integrals(this->m_rays.size());
+    runChunks(this->m_rays.size(), workerCount, [&](const std::size_t begin, const std::size_t end, std::size_t) {
+        for (std::size_t index = begin; index < end; ++index) {
+            integrals[index] = this->integrate(this->m_rays[index]);
+        }
+    });
+
+    ProbeSample result{};
+    result.time = time.value;
+    result.atoms = atoms;
+    double totalWeight = 0.0;
+    for (std::size_t index = 0; index < this->m_rays.size(); ++index) {
+        const double weight = this->m_rays[index].weight;
+        const double rotation = this->m_rotationCoefficient * integrals[index].spin;
+        const double transmission = std::exp(-this->m_absorptionCrossSection * integrals[index].density);
+        totalWeight += weight;
+        result.rotation += weight * rotation;
+        result.transmission += weight * transmission;
+        result.signal += weight * transmission * std::sin(2.0 * rotation);
+    }
+    if (totalWeight > 0.0) {
+        result.rotation /= totalWeight;
+        result.transmission /= totalWeight;
+    } else {
+        result.transmission = 1.0;
+    }
+    this->m_samples.push_back(result);
+
+    // Next sample on the interval grid strictly after time
+    if (this->m_interval > 0.0) {
+        this->m_nextSample = (std::floor(time.value / this->m_interval) + 1.0) * this->m_interval;
+    } else {
+        this->m_nextSample = time.value;
+    }
+}
+
+void ProbeReadout::writeCsv(const std::filesystem::path& file) const {
+    if (file.has_parent_path()) {
+        std::error_code ec;
+        std::filesystem::create_directories(file.parent_path(), ec);
+    }
+    std::ofstream out(file);
+    if (!out) {
+        throw std::runtime_error(std::format("Failed to open probe readout file: {}", file.string()));
+    }
+    out << "time,rotation,transmission,signal,atoms\n";
+    for (const auto& sample : this->m_samples) {
+        out << std::format("{},{},{},{},{}\n", sample.time, sample.rotation, sample.transmission, sample.signal, sample.atoms);
+    }
+}
@@ -0,0 +1,159 @@
+//
+// Physics Simulation Program
+// File: probe_readout.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes the probe beam readout integrating atomic spin and number density along probe rays
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_PROBE_READOUT_H
+#define PHYSICS_SIMULATION_PROGRAM_PROBE_READOUT_H
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "core/linear-algebra/vector.h"
+#include "core/quantities/quantity.h"
+#include "particles/particle.h"
+
+// ProbeRay
+//
+// One straight probe ray; the beam is sampled by as many rays as its profile needs, each with its share of the power
+struct ProbeRay {
+    Vector<3> origin;    // Length dimensions; may lie outside the grid
+    Vector<3> direction; // Dimensionless, normalised on construction of the readout
+    double weight = 1.0; // Relative probe power carried by the ray
+};
+
+// ProbeSample
+//
+// One point of the photodiode time series
+struct ProbeSample {
+    double time = 0.0;         // s
+    double rotation = 0.0;     // Weight averaged polarisation rotation (in radians)
+    double transmission = 0.0; // Weight averaged exp(-optical depth)
+    double signal = 0.0;       // Balanced polarimeter signal, sum of weight * transmission * sin(2 * rotation)
+    std::size_t atoms = 0;     // Live atoms deposited on the grid
+};
+
+// ProbeReadout
+//
+// Notes on initialisation:
+//   - Built from an axis aligned world box (lower and upper corners with length dimensions) split into voxel counts per
+//     axis, the probe rays, the coefficients and the sampling interval; throws std::invalid_argument on a degenerate
+//     box, a zero voxel count, a zero ray direction, a negative weight or coefficient, or a negative interval
+//   - rotationCoefficient (in rad m^2) turns the line integral of spin density along the ray into a rotation angle and
+//     absorptionCrossSection (in m^2) the line integral of number density into an optical depth; both depend on the
+//     probe detuning and line shape, which the simulation does not model, so they are supplied by the caller
+//   - atomWeight is the number of real atoms each simulated Atom stands for
+//   - Attach to a context with SimulationContext::setReadout(); the context does not own the readout, which must outlive
+//     every stepAll it is attached for
+//
+// Notes on algorithms:
+//   - The probe light is never simulated. Instead, when the clock reaches the next sample time at the end of a stepAll,
+//     every live Atom inside the box deposits its polarisation (a spin vector) and a unit count, scaled by
+//     atomWeight / voxel volume, into its voxel, giving spin density S and number density n
+//   - Each ray is clipped to the box (slab test) and walked voxel by voxel with 3D-DDA (Amanatides and Woo): per axis,
+//     the ray parameter of the next voxel face and the parameter step between faces, always advancing the axis with the
+//     nearest face. Every voxel crossed adds its S . k and n times the chord length, so cost is linear in the voxels a
+//     ray crosses with no sampling error along the ray. Then
+//         -> rotation = rotationCoefficient * integral(S . k dl)
+//         -> optical depth = absorptionCrossSection * integral(n dl)
+//   - Deposition splits the atoms across workers, each filling its own grid, and the grids are summed; rays are split
+//     across workers the same way. Results do not depend on the worker count beyond floating point summation order
+//   - Samples are taken at most once per stepAll, so the series resolution is the larger of interval and the stepAll
+//     interval; a sample is stamped with the clock time it was taken at. An interval of 0 samples every stepAll
+//   - Particles held in the context's spill are not live and are not deposited
+//
+// Notes on output:
+//   - writeCsv() writes time, rotation, transmission, signal and atoms per sample, one line each
+//
+// Supported overloads / operations and functions / methods:
+//   - Constructor:            ProbeReadout()
+//   - Sampling:               due(), sample()
+//   - Results:                samples(), clearSamples(), writeCsv()
+//   - Grid:                   getVoxelCounts(), getVoxelVolume()
+//
+// Example usage:
+//   ProbeReadout readout(
+//       Vector<3>({-0.01, -0.01, -0.01}, "m"), Vector<3>({0.01, 0.01, 0.01}, "m"), {32, 32, 32},
+//       {{Vector<3>({-0.02, 0.0, 0.0}, "m"), Vector<3>({1.0, 0.0, 0.0})}},
+//       1e-20, 1e-17, 1e6, Quantity(1e-6, "s")
+//   );
+//   context.setReadout(&readout);
+//   stepUntilTime(context, detector, Quantity(1e-3, "s"), Quantity(1e-7, "s"));
+//   readout.writeCsv("Output/probe.csv");
+class ProbeReadout {
+    public:
+        ProbeReadout(const Vector<3>& lowerCorner,
+                     const Vector<3>& upperCorner,
+                     const std::array<std::size_t, 3>& voxelCounts,
+                     std::vector<ProbeRay> rays,
+                     double rotationCoefficient,
+                     double absorptionCrossSection,
+                     double atomWeight,
+                     const Quantity& interval);
+
+        // Sampling methods
+        //
+        // due() is true once time reaches the next sample time; sample() deposits the atoms among particles, integrates
+        // every ray with up to workerCount threads and appends one sample stamped with time. particles must not change
+        // during the call
+        [[nodiscard]] bool due(const Quantity& time) const noexcept;
+        void sample(const std::vector<std::unique_ptr<Particle> >& particles, const Quantity& time, std::size_t workerCount);
+
+        // Result methods
+        [[nodiscard]] const std::vector<ProbeSample>& samples() const noexcept { return this->m_samples; }
+        void clearSamples() noexcept { this->m_samples.clear(); }
+        // Throws std::runtime_error if the file cannot be opened; creates missing parent folders
+        void writeCsv(const std::filesystem::path& file) const;
+
+        // Grid getters
+        [[nodiscard]] const std::array<std::size_t, 3>& getVoxelCounts() const noexcept { return this->m_voxelCounts; }
+        [[nodiscard]] double getVoxelVolume() const noexcept; // m^3
+
+    private:
+        // Per voxel spin density (x, y, z) and number density
+        using Voxel = std::array<double, 4>;
+
+        struct Ray {
+            std::array<double, 3> origin;
+            std::array<double, 3> direction;
+            double weight;
+        };
+
+        struct Integral {
+            double spin = 0.0;    // integral(S . k dl), m^-2
+            double density = 0.0; // integral(n dl), m^-2
+        };
+
+        [[nodiscard]] std::size_t voxelIndex(std::size_t x, std::size_t y, std::size_t z) const noexcept;
+        void deposit(const std::vector<std::unique_ptr<Particle> >& particles,
+                     std::size_t begin,
+                     std::size_t end,
+                     std::vector<Voxel>& grid,
+                     std::size_t& atoms) const;
+        [[nodiscard]] Integral integrate(const Ray& ray) const noexcept;
+
+        std::array<double, 3> m_lower{};
+        std::array<double, 3> m_upper{};
+        std::array<double, 3> m_spacing{};
+        std::array<std::size_t, 3> m_voxelCounts{};
+        std::vector<Ray> m_rays;
+        double m_rotationCoefficient;
+        double m_absorptionCrossSection;
+        double m_atomWeight;
+        double m_interval;
+        double m_nextSample = 0.0;
+        std::vector<Voxel> m_grid;
+        std::vector<ProbeSample> m_samples;
+};
+
+#endif //PHYSICS_SIMULATION_PROGRAM_PROBE_READOUT_H
@@ -16,7 +16,11 @@
 #include <optional>
 
 #include "config/program_config.h"
+#include "core/tracing/tracing.h"
+#include "particles/particle-types/photon.h"
+#include "physics/optics/optical_element.h"
 #include "physics/processes/interaction_utilities.h"
+#include "simulation/stepping/step_statistics.h"
 
 namespace {
     constexpr double geometryTolerance = config::program::geometryTolerance;
@@ -116,6 +120,7 @@ bool particleBoundaryConditions(
     Quantity& dt,
     BoundaryEvent& event
 ) {
+    TRACE_SCOPE("particleBoundaryConditions");
     if (world == nullptr || startMedium == nullptr) {
         return false;
     }
@@ -147,6 +152,7 @@ bool particleBoundaryConditions(
     }
 
     if (!bestHit.has_value()) {
+        ++StepStatistics::local().boundaryFallbacks;
         // Fallback: trim step slightly to avoid getting stuck on boundary ambiguity
         // Scale the step so the move is roughly a few geometry tolerances long
         const double stepLength = displacement.length().value;
@@ -184,19 +190,19 @@ bool particleBoundaryConditions(
     return true;
 }
 
-void processBoundaryResponse(Particle& particle,
+const Object* processBoundaryResponse(Particle& particle,
     const BoundaryEvent& event,
     const Vector<3>& eventDisplacement,
     const Quantity& travelledDistance)
 {
     if (event.surface == nullptr || travelledDistance.value <= 0.0) {
-        return;
+        return event.mediumAfter;
     }
 
     const auto worldNormalOpt = selectWorldNormal(event, eventDisplacement, particle);
 
     if (!worldNormalOpt.has_value()) {
-        return;
+        return event.mediumAfter;
     }
 
     const auto& worldNormal = *worldNormalOpt;
@@ -212,11 +218,33 @@ void processBoundaryResponse(Particle& particle,
         particle.reflectMomentumAcrossNormal(worldNormal);
         const double sign = displacementDot >= 0.0 ? -1.0 : 1.0;
         particle.setPosition(particle.getPosition() + worldNormal * (epsilon * sign));
-        return;
+        return event.mediumAfter;
+    }
+
+    // Only a crossing between two distinct media meets an element; fallback events carry no intersection normal
+    if (const auto* element = event.surface->getOpticalElement();
+        element != nullptr && event.hasNormal && event.mediumAfter != event.mediumBefore) {
+        if (auto* photon = dynamic_cast<Photon*>(&particle)) {
+            const bool entering = event.surface == event.mediumAfter;
+            switch (element->apply(*photon, *event.surface, worldNormal, entering)) {
+                case OpticalOutcome::Absorbed:
+                    particle.setAlive(false);
+                    return nullptr;
+                case OpticalOutcome::Reflected: {
+                    particle.reflectMomentumAcrossNormal(worldNormal);
+                    const double sign = displacementDot >= 0.0 ? -1.0 : 1.0;
+                    particle.setPosition(particle.getPosition() + worldNormal * (epsilon * sign));
+                    return event.mediumBefore;
+                }
+                case OpticalOutcome::Transmitted:
+                    break;
+            }
+        }
     }
 
     if (event.nudgeIntoMediumAfter) {
         const double sign = displacementDot >= 0.0 ? 1.0 : -1.0;
         particle.setPosition(particle.getPosition() + worldNormal * (epsilon * sign));
     }
+    return event.mediumAfter;
 }
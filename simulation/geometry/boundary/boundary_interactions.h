@@ -36,7 +36,9 @@ bool particleBoundaryConditions(const Particle& particle,
     Quantity& dt,
     BoundaryEvent& event);
 
-void processBoundaryResponse(Particle& particle,
+// Reflect or nudge the particle across the surface; photons crossing a surface with an optical element may instead be
+// reflected or absorbed by it. Returns the medium the particle is in afterwards (nullptr if it was absorbed)
+const Object* processBoundaryResponse(Particle& particle,
     const BoundaryEvent& event,
     const Vector<3>& eventDisplacement,
     const Quantity& travelledDistance);
@@ -0,0 +1,214 @@
+//
+// Physics Simulation Program
+// File: convex_bounces.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of convex_bounces.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/geometry/boundary/convex_bounces.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "config/program_config.h"
+#include "core/linear-algebra/vector.h"
+#include "core/tracing/tracing.h"
+#include "objects/object-types/box.h"
+#include "objects/object-types/sphere.h"
+#include "physics/processes/continuous/particle_continuous_interactions.h"
+
+namespace {
+    using Coordinates = std::array<double, 3>;
+
+    constexpr double k_tolerance = config::program::geometryTolerance;
+    constexpr double k_twoPi = 6.283185307179586476925286766559;
+
+    // Local end state of the interval
+    struct Bounced {
+        Coordinates position{};
+        Coordinates direction{}; // Unit vector, or sign per axis for a box
+        std::uint64_t bounces = 0;
+    };
+
+    Coordinates toCoordinates(const Vector<3>& vector) noexcept {
+        return {vector[0].value, vector[1].value, vector[2].value};
+    }
+
+    double dot(const Coordinates& a, const Coordinates& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    Coordinates cross(const Coordinates& a, const Coordinates& b) noexcept {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    // Rodrigues rotation of v by angle about the unit axis
+    Coordinates rotate(const Coordinates& v, const Coordinates& axis, const double angle) noexcept {
+        const double c = std::cos(angle);
+        const double s = std::sin(angle);
+        const auto axv = cross(axis, v);
+        const double along = dot(axis, v) * (1.0 - c);
+        return {
+            v[0] * c + axv[0] * s + axis[0] * along,
+            v[1] * c + axv[1] * s + axis[1] * along,
+            v[2] * c + axv[2] * s + axis[2] * along
+        };
+    }
+
+    // Per axis, the unfolded coordinate folded back into [-h, h]; direction holds +1 or -1 per axis
+    std::optional<Bounced> bounceInBox(const Box& box, const Coordinates& start, const Coordinates& travel) {
+        const auto& size = box.getSize();
+        Bounced result{};
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            const double half = 0.5 * std::abs(size[axis].value);
+            if (half <= 0.0 || std::abs(start[axis]) > half) {
+                return std::nullopt;
+            }
+            const double width = 2.0 * half;
+            const double unfolded = start[axis] + half + travel[axis]; // Measured from the lower wall
+            const double folds = std::floor(unfolded / width);
+            double offset = unfolded - 2.0 * width * std::floor(unfolded / (2.0 * width)); // [0, 2 width)
+            result.direction[axis] = 1.0;
+            if (offset > width) {
+                offset = 2.0 * width - offset;
+                result.direction[axis] = -1.0;
+            }
+            const double margin = half * k_tolerance;
+            result.position[axis] = std::clamp(offset - half, -half + margin, half - margin);
+            result.bounces += static_cast<std::uint64_t>(std::abs(folds));
+        }
+        if (result.bounces == 0) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    // First chord by intersection, then every later chord as the same rotation about the plane normal of the orbit
+    std::optional<Bounced> bounceInSphere(const Sphere& sphere, const Coordinates& start, const Coordinates& travel) {
+        const double radius = std::abs(sphere.getRadius().value);
+        const double distance = std::sqrt(dot(travel, travel));
+        if (radius <= 0.0 || dot(start, start) > radius * radius) {
+            return std::nullopt;
+        }
+        const Coordinates direction{travel[0] / distance, travel[1] / distance, travel[2] / distance};
+
+        // |start + direction t| = radius, taking the forward root
+        const double b = dot(start, direction);
+        const double c = dot(start, start) - radius * radius;
+        const double toWall = -b + std::sqrt(std::max(b * b - c, 0.0));
+        if (toWall >= distance) {
+            return std::nullopt;
+        }
+
+        const Coordinates hit{start[0] + direction[0] * toWall, start[1] + direction[1] * toWall, start[2] + direction[2] * toWall};
+        const double normalComponent = dot(direction, hit) / radius;
+        const Coordinates reflected{
+            direction[0] - 2.0 * normalComponent * hit[0] / radius,
+            direction[1] - 2.0 * normalComponent * hit[1] / radius,
+            direction[2] - 2.0 * normalComponent * hit[2] / radius
+        };
+
+        const double chord = -2.0 * dot(hit, reflected);
+        if (chord <= radius * k_tolerance) {
+            return std::nullopt; // Grazing orbit; ordinary steps handle the tangent case
+        }
+
+        // Hit point and direction after each chord turn by the angle the chord subtends
+        auto axis = cross(hit, reflected);
+        double axisLength = std::sqrt(dot(axis, axis));
+        if (axisLength <= radius * k_tolerance) {
+            // Radial orbit: any axis perpendicular to the hit point gives the half turn
+            axis = cross(hit, std::abs(hit[0]) < 0.9 * radius ? Coordinates{1.0, 0.0, 0.0} : Coordinates{0.0, 1.0, 0.0});
+            axisLength = std::sqrt(dot(axis, axis));
+        }
+        for (auto& component : axis) {
+            component /= axisLength;
+        }
+        const double subtended = 2.0 * std::asin(std::min(0.5 * chord / radius, 1.0));
+
+        const double afterFirst = distance - toWall;
+        const double chords = std::floor(afterFirst / chord);
+        const double rest = afterFirst - chords * chord;
+        const double turn = std::fmod(chords * subtended, k_twoPi);
+
+        const auto wallPoint = rotate(hit, axis, turn);
+        const auto heading = rotate(reflected, axis, turn);
+
+        Bounced result{};
+        result.direction = heading;
+        result.position = {wallPoint[0] + heading[0] * rest, wallPoint[1] + heading[1] * rest, wallPoint[2] + heading[2] * rest};
+        const double limit = radius * (1.0 - k_tolerance);
+        if (const double length = std::sqrt(dot(result.position, result.position)); length > limit) {
+            for (auto& component : result.position) {
+                component *= limit / length;
+            }
+        }
+        result.bounces = 1 + static_cast<std::uint64_t>(chords);
+        return result;
+    }
+} // namespace
+
+std::optional<std::uint64_t> convex_bounces::advance(Particle& particle, const Object* medium, const Quantity& dt) {
+    if constexpr (!config::program::analyticWallBounces) {
+        return std::nullopt;
+    }
+    if (medium == nullptr || !particle.isReflective() || !medium->getChildren().empty()
+        || !std::isfinite(dt.value) || dt.value <= 0.0) {
+        return std::nullopt;
+    }
+    const auto* box = dynamic_cast<const Box*>(medium);
+    const auto* sphere = dynamic_cast<const Sphere*>(medium);
+    if (box == nullptr && sphere == nullptr) {
+        return std::nullopt;
+    }
+
+    const auto worldTravel = displacement(particle, dt);
+    const auto distance = worldTravel.length();
+    if (!(distance.value > 0.0)) {
+        return std::nullopt;
+    }
+    if (particle.hasPendingInteractionLength() && particle.getInteractionLengthRemaining().value <= distance.value) {
+        return std::nullopt;
+    }
+    if (particle.hasDecayClock() && particle.getDecayTimeRemaining().value <= dt.value) {
+        return std::nullopt;
+    }
+    TRACE_SCOPE("convex_bounces::advance");
+
+    const auto start = toCoordinates(medium->worldToLocalPoint(particle.getPosition()));
+    const auto travel = toCoordinates(medium->worldToLocalDirection(worldTravel));
+    const auto bounced = box != nullptr ? bounceInBox(*box, start, travel) : bounceInSphere(*sphere, start, travel);
+    if (!bounced) {
+        return std::nullopt;
+    }
+
+    const auto localMomentum = toCoordinates(medium->worldToLocalDirection(particle.getMomentum()));
+    Coordinates momentum{};
+    if (box != nullptr) {
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            momentum[axis] = localMomentum[axis] * bounced->direction[axis];
+        }
+    } else {
+        const double magnitude = std::sqrt(dot(localMomentum, localMomentum));
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            momentum[axis] = bounced->direction[axis] * magnitude;
+        }
+    }
+
+    particle.setPosition(medium->localToWorldPoint(Vector<3>(bounced->position, particle.getPosition()[0].unit)));
+    particle.setMomentum(medium->localToWorldDirection(Vector<3>(momentum, particle.getMomentum()[0].unit)));
+    particle.setTime(particle.getTime() + dt);
+    if (particle.hasPendingInteractionLength()) {
+        particle.consumeInteractionLength(distance);
+    }
+    if (particle.hasDecayClock()) {
+        particle.consumeDecayTime(dt);
+    }
+    return bounced->bounces;
+}
@@ -0,0 +1,54 @@
+//
+// Physics Simulation Program
+// File: convex_bounces.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes the closed-form advance of reflective particles bouncing inside convex cells
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_CONVEX_BOUNCES_H
+#define PHYSICS_SIMULATION_PROGRAM_CONVEX_BOUNCES_H
+
+#include <cstdint>
+#include <optional>
+
+#include "core/quantities/quantity.h"
+#include "objects/object.h"
+#include "particles/particle.h"
+
+// convex_bounces
+//
+// Notes on initialisation:
+//   - Stateless; enabled by config::program::analyticWallBounces
+//
+// Notes on algorithms:
+//   - A reflective particle never leaves its medium (every boundary hit is a specular bounce back into it), and between
+//     bounces it moves in a straight line, so inside a Box or Sphere with no children the whole bounce sequence of an
+//     interval has a closed form:
+//         -> Box: each local axis is independent; the unfolded coordinate p + d is folded back into the box with a
+//            triangle wave of period 4 half-extents, and the velocity component flips on every odd fold
+//         -> Sphere: after the first hit every chord has the same length and rotates the hit point and direction by
+//            the same angle about (hit point x direction), so the state after k further bounces is one rotation
+//   - The fast path only applies when the particle would bounce at least once, starts inside the cell and neither its
+//     pending interaction nor its decay falls within the interval; otherwise the caller takes ordinary steps
+//   - Cost is independent of the number of bounces, replacing one boundary-limited step (intersection search, reflect
+//     and epsilon nudge) per wall hit; the final position is kept geometryTolerance inside the walls
+//
+// Supported overloads / operations and functions / methods:
+//   - Advance:                advance()
+//
+// Example usage:
+//   if (const auto bounces = convex_bounces::advance(*particle, medium, remainingTime)) {
+//       counters.analyticBounces += *bounces;
+//   }
+namespace convex_bounces {
+    // Move particle through dt inside medium, updating position, momentum, time, interaction length and decay clock;
+    // returns the number of bounces applied, or std::nullopt with the particle untouched if the fast path does not apply
+    [[nodiscard]] std::optional<std::uint64_t> advance(Particle& particle, const Object* medium, const Quantity& dt);
+} // namespace convex_bounces
+
+#endif //PHYSICS_SIMULATION_PROGRAM_CONVEX_BOUNCES_H
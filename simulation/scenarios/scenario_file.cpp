@@ -0,0 +1,336 @@
+//
+// Physics Simulation Program
+// File: scenario_file.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of scenario_file.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/scenarios/scenario_file.h"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include "core/linear-algebra/matrix.h"
+#include "objects/object_manager.h"
+#include "objects/object-types/box.h"
+#include "objects/object-types/sphere.h"
+#include "particles/particle_source.h"
+#include "physics/processes/interaction_utilities.h"
+
+namespace scenario_file {
+    namespace {
+        constexpr double k_boundaryStepsPerVolume = 2.0; // Entry and exit of each volume a particle may cross
+
+        const nlohmann::json& require(const nlohmann::json& object, const std::string_view key, const std::string& path) {
+            if (!object.is_object()) {
+                throw std::invalid_argument(std::format("Scenario field '{}' must be an object", path));
+            }
+            const auto it = object.find(key);
+            if (it == object.end()) {
+                throw std::invalid_argument(std::format("Scenario field '{}/{}' is required", path, key));
+            }
+            return *it;
+        }
+
+        std::string requireString(const nlohmann::json& object, const std::string_view key, const std::string& path) {
+            const auto& value = require(object, key, path);
+            if (!value.is_string()) {
+                throw std::invalid_argument(std::format("Scenario field '{}/{}' must be a string", path, key));
+            }
+            return value.get<std::string>();
+        }
+
+        double requireNumber(const nlohmann::json& value, const std::string& path) {
+            if (!value.is_number()) {
+                throw std::invalid_argument(std::format("Scenario field '{}' must be a number", path));
+            }
+            return value.get<double>();
+        }
+
+        template<std::size_t N>
+        std::array<double, N> requireNumbers(const nlohmann::json& value, const std::string& path) {
+            if (!value.is_array() || value.size() != N) {
+                throw std::invalid_argument(std::format("Scenario field '{}' must be an array of {} numbers", path, N));
+            }
+            std::array<double, N> numbers{};
+            for (std::size_t i = 0; i < N; ++i) {
+                numbers[i] = requireNumber(value[i], std::format("{}/{}", path, i));
+            }
+            return numbers;
+        }
+
+        std::string unitOf(const nlohmann::json& object, const std::string& path) {
+            const auto it = object.find("unit");
+            if (it == object.end()) {
+                return {};
+            }
+            if (!it->is_string()) {
+                throw std::invalid_argument(std::format("Scenario field '{}/unit' must be a string", path));
+            }
+            return it->get<std::string>();
+        }
+
+        Quantity parseQuantity(const nlohmann::json& object, const std::string& path) {
+            const auto value = requireNumber(require(object, "value", path), path + "/value");
+            return Quantity(value, unitOf(object, path));
+        }
+
+        Vector<3> parseVector(const nlohmann::json& object, const std::string& path) {
+            return Vector<3>(requireNumbers<3>(require(object, "value", path), path + "/value"), unitOf(object, path));
+        }
+
+        QuantitySpec parseQuantitySpec(const nlohmann::json& object, const std::string& path) {
+            const auto centre = parseQuantity(object, path);
+            if (!object.contains("spread")) {
+                return centre;
+            }
+            return std::pair{centre, Quantity(requireNumber(object["spread"], path + "/spread"), unitOf(object, path))};
+        }
+
+        VectorSpec parseVectorSpec(const nlohmann::json& object, const std::string& path) {
+            const auto centre = parseVector(object, path);
+            if (!object.contains("spread")) {
+                return centre;
+            }
+            return std::pair{centre, Vector<3>(requireNumbers<3>(object["spread"], path + "/spread"), unitOf(object, path))};
+        }
+
+        PolarisationSpec parsePolarisation(const nlohmann::json& source, const std::string& path) {
+            const auto it = source.find("polarisation");
+            if (it == source.end()) {
+                return std::monostate{};
+            }
+            const auto polarisationPath = path + "/polarisation";
+            if (it->is_array() && it->size() == 4) {
+                return Vector<4>(requireNumbers<4>(*it, polarisationPath));
+            }
+            return Vector<3>(requireNumbers<3>(*it, polarisationPath));
+        }
+
+        Source parseSource(const nlohmann::json& object, const std::string& path) {
+            Source source;
+            source.particle = requireString(object, "particle", path);
+            const auto& count = require(object, "count", path);
+            if (!count.is_number_unsigned()) {
+                throw std::invalid_argument(std::format("Scenario field '{}/count' must be a non-negative integer", path));
+            }
+            source.count = count.get<std::size_t>();
+            source.time = object.contains("time") ? parseQuantity(object["time"], path + "/time") : Quantity(0.0, "s");
+            source.position = parseVectorSpec(require(object, "position", path), path + "/position");
+            source.energy = parseQuantitySpec(require(object, "energy", path), path + "/energy");
+            source.momentum = parseVectorSpec(require(object, "momentum", path), path + "/momentum");
+            source.polarisation = parsePolarisation(object, path);
+            return source;
+        }
+
+        Quantity parseTime(const nlohmann::json& object, const std::string& path) {
+            auto time = parseQuantity(object, path);
+            if (!Unit::hasTimeDimension(time.unit)) {
+                throw std::invalid_argument(std::format("Scenario field '{}' must have time dimensions", path));
+            }
+            return time;
+        }
+
+        template<typename T, typename Size>
+        Object* constructObject(Object* parent, const std::string& objectName, const std::string& objectMaterial, const Size& objectSize) {
+            if (parent == nullptr) {
+                return g_objectManager.createWorld<T>(name(objectName), material(objectMaterial), size(objectSize));
+            }
+            return parent->addChild<T>(name(objectName), material(objectMaterial), size(objectSize));
+        }
+
+        Object* buildObject(Object* parent, const nlohmann::json& description, const std::string& path) {
+            const auto shape = requireString(description, "shape", path);
+            const auto objectName = requireString(description, "name", path);
+            const auto objectMaterial = requireString(description, "material", path);
+
+            Object* object = nullptr;
+            if (shape == "box") {
+                object = constructObject<Box>(parent, objectName, objectMaterial, parseVector(require(description, "size", path), path + "/size"));
+            } else if (shape == "sphere") {
+                object = constructObject<Sphere>(parent, objectName, objectMaterial, parseQuantity(require(description, "radius", path), path + "/radius"));
+            } else {
+                throw std::invalid_argument(std::format("Scenario field '{}/shape' must be \"box\" or \"sphere\" but got \"{}\"", path, shape));
+            }
+
+            if (description.contains("position")) {
+                object->setPosition(parseVector(description["position"], path + "/position"));
+            }
+            if (description.contains("rotation")) {
+                const auto& rows = description["rotation"];
+                if (!rows.is_array() || rows.size() != 3) {
+                    throw std::invalid_argument(std::format("Scenario field '{}/rotation' must be a 3x3 array", path));
+                }
+                Matrix<3, 3> rotation;
+                for (std::size_t i = 0; i < 3; ++i) {
+                    const auto row = requireNumbers<3>(rows[i], std::format("{}/rotation/{}", path, i));
+                    for (std::size_t j = 0; j < 3; ++j) {
+                        rotation[i][j] = Quantity::dimensionless(row[j]);
+                    }
+                }
+                object->setRotation(rotation);
+            }
+            if (description.contains("temperature")) {
+                object->setTemperature(parseQuantity(description["temperature"], path + "/temperature"));
+            }
+            if (description.contains("number_density")) {
+                object->setNumberDensity(parseQuantity(description["number_density"], path + "/number_density"));
+            }
+            if (description.contains("relative_permeability")) {
+                object->setRelativePermeability(requireNumber(description["relative_permeability"], path + "/relative_permeability"));
+            }
+
+            if (description.contains("children")) {
+                const auto& children = description["children"];
+                if (!children.is_array()) {
+                    throw std::invalid_argument(std::format("Scenario field '{}/children' must be an array", path));
+                }
+                for (std::size_t i = 0; i < children.size(); ++i) {
+                    (void)buildObject(object, children[i], std::format("{}/children/{}", path, i));
+                }
+            }
+            return object;
+        }
+
+        const Object* findNamed(const Object* root, const std::string_view name) noexcept {
+            if (root->getName() == name) {
+                return root;
+            }
+            for (const auto& child : root->getChildren()) {
+                if (const auto* object = findNamed(child.get(), name)) {
+                    return object;
+                }
+            }
+            return nullptr;
+        }
+
+        std::size_t countObjects(const Object* root) noexcept {
+            std::size_t count = 1;
+            for (const auto& child : root->getChildren()) {
+                count += countObjects(child.get());
+            }
+            return count;
+        }
+
+        double worldExtent(const Object* world) {
+            if (const auto* box = dynamic_cast<const Box*>(world)) {
+                return box->getSize().length().value;
+            }
+            if (const auto* sphere = dynamic_cast<const Sphere*>(world)) {
+                return 2.0 * sphere->getRadius().value;
+            }
+            return 0.0;
+        }
+
+        template<typename Spec>
+        const auto& centre(const Spec& spec) {
+            return std::visit([](const auto& value) -> const auto& {
+                if constexpr (requires { value.first; }) {
+                    return value.first;
+                } else {
+                    return value;
+                }
+            }, spec);
+        }
+    } // namespace
+
+    Scenario parse(const nlohmann::json& document) {
+        const std::string root;
+        Scenario scenario;
+        scenario.name = requireString(document, "name", root);
+        if (const auto it = document.find("seed"); it != document.end()) {
+            if (!it->is_number_unsigned()) {
+                throw std::invalid_argument("Scenario field '/seed' must be a non-negative integer");
+            }
+            scenario.seed = it->get<std::uint64_t>();
+        }
+
+        const auto& run = require(document, "run", root);
+        scenario.run.timeStep = parseTime(require(run, "time_step", "/run"), "/run/time_step");
+        if (scenario.run.timeStep.value <= 0.0) {
+            throw std::invalid_argument("Scenario field '/run/time_step' must be positive");
+        }
+        if (run.contains("end_time")) {
+            scenario.run.endTime = parseTime(run["end_time"], "/run/end_time");
+        }
+
+        scenario.geometry = require(document, "geometry", root);
+        scenario.detector = requireString(document, "detector", root);
+
+        const auto& sources = require(document, "sources", root);
+        if (!sources.is_array() || sources.empty()) {
+            throw std::invalid_argument("Scenario field '/sources' must be a non-empty array");
+        }
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            scenario.sources.push_back(parseSource(sources[i], std::format("/sources/{}", i)));
+        }
+        return scenario;
+    }
+
+    Scenario load(const std::filesystem::path& path) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::runtime_error(std::format("Failed to open scenario file '{}'", path.string()));
+        }
+        try {
+            return parse(nlohmann::json::parse(file));
+        } catch (const nlohmann::json::exception& error) {
+            throw std::runtime_error(std::format("Failed to parse scenario file '{}': {}", path.string(), error.what()));
+        }
+    }
+
+    Object* buildGeometry(const nlohmann::json& geometry) {
+        return buildObject(nullptr, geometry, "/geometry");
+    }
+
+    const Object* findObject(const Object* root, const std::string_view name) {
+        if (const auto* object = findNamed(root, name)) {
+            return object;
+        }
+        throw std::invalid_argument(std::format("No object named '{}' under '{}'", name, root->getName()));
+    }
+
+    void generateParticles(const Scenario& scenario, ParticleManager& target) {
+        ParticleSource source(target);
+        for (const auto& description : scenario.sources) {
+            std::visit([&](const auto& position, const auto& energy, const auto& momentum, const auto& polarisation) {
+                using Polarisation = std::decay_t<decltype(polarisation)>;
+                if constexpr (std::same_as<Polarisation, std::monostate>) {
+                    source.generateParticles(description.particle, description.count, description.time, position, energy, momentum, Vector<3>());
+                } else {
+                    source.generateParticles(description.particle, description.count, description.time, position, energy, momentum, polarisation);
+                }
+            }, description.position, description.energy, description.momentum, description.polarisation);
+        }
+    }
+
+    double estimateCost(const Scenario& scenario, const Object* world) {
+        const double c = speedOfLight().value;
+        const double extent = worldExtent(world);
+        const double boundarySteps = k_boundaryStepsPerVolume * static_cast<double>(countObjects(world));
+        double timeLimit = std::numeric_limits<double>::infinity();
+        if (scenario.run.endTime) {
+            timeLimit = scenario.run.endTime->value;
+        }
+
+        double cost = 0.0;
+        for (const auto& source : scenario.sources) {
+            const double energy = centre(source.energy).value;
+            const double momentum = centre(source.momentum).length().value;
+            const double speed = energy > 0.0 && momentum > 0.0 ? std::min(c, momentum * c * c / energy) : c;
+            const double flightTime = std::min(extent / speed, timeLimit);
+            cost += static_cast<double>(source.count) * (flightTime / scenario.run.timeStep.value + boundarySteps);
+        }
+        return cost;
+    }
+} // namespace scenario_file
@@ -0,0 +1,127 @@
+//
+// Physics Simulation Program
+// File: scenario_file.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes a complete run (geometry, materials, sources, detector and run limits) read from a JSON file
+//   - Builds the geometry into g_objectManager and generates the sources into a particle manager
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_SCENARIO_FILE_H
+#define PHYSICS_SIMULATION_PROGRAM_SCENARIO_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "core/linear-algebra/vector.h"
+#include "core/quantities/quantity.h"
+#include "objects/object.h"
+#include "particles/particle_manager.h"
+
+// scenario_file
+//
+// Notes on initialisation:
+//   - Materials are referenced by name from the material database; an object may override the material's
+//     temperature, number density and relative permeability
+//   - Quantities are written as {"value": x, "unit": "mm"}, with value an array for vectors; source position, energy
+//     and momentum may add "spread" (same shape as value) to sample uniformly in value +- spread
+//   - Polarisation is a plain array: 4 Stokes components for photons, 3 spin components for atoms, omitted otherwise
+//
+// Notes on algorithms:
+//   - The geometry is kept as JSON after parsing so callers can tell when two scenarios share identical geometry and
+//     reuse one built world (see sweep_runner.h)
+//   - estimateCost() is a rough relative cost for scheduling: initial particles times the steps expected for each to
+//     cross the world (time-limited steps at the source speed plus a few boundary steps per volume)
+//
+// Supported overloads / operations and functions / methods:
+//   - Parsing:                parse(), load()
+//   - Construction:           buildGeometry(), findObject(), generateParticles()
+//   - Scheduling:             estimateCost()
+//
+// Example usage:
+//   const auto scenario = scenario_file::load("scenarios/photon_cell.json");
+//   const Object* world = scenario_file::buildGeometry(scenario.geometry);
+//   g_objectManager.setActiveWorld(world);
+//   scenario_file::generateParticles(scenario);
+//   stepUntilEmpty(scenario_file::findObject(world, scenario.detector), scenario.run.timeStep);
+//
+// Example file:
+//   {
+//     "name": "photon_cell",
+//     "seed": 1,
+//     "run": {"time_step": {"value": 1e-13, "unit": "s"}},
+//     "geometry": {
+//       "shape": "box", "name": "World", "material": "vacuum", "size": {"value": [100, 50, 50], "unit": "mm"},
+//       "children": [{"shape": "sphere", "name": "Bulb", "material": "glass", "radius": {"value": 5, "unit": "mm"}}]
+//     },
+//     "detector": "Bulb",
+//     "sources": [{
+//       "particle": "photon", "count": 1000, "time": {"value": 0, "unit": "s"},
+//       "position": {"value": [-20, 0, 0], "spread": [0, 1, 1], "unit": "mm"},
+//       "energy": {"value": 1, "unit": "J"}, "momentum": {"value": [1, 0, 0], "unit": "kg m s^-1"},
+//       "polarisation": [1, 0, 0, 1]
+//     }]
+//   }
+namespace scenario_file {
+    using QuantitySpec = std::variant<Quantity, std::pair<Quantity, Quantity>>;    // Fixed, or centre and spread
+    using VectorSpec = std::variant<Vector<3>, std::pair<Vector<3>, Vector<3>>>;   // Fixed, or centre and spread
+    using PolarisationSpec = std::variant<std::monostate, Vector<4>, Vector<3>>;   // None, photon Stokes, atom spin
+
+    struct Source {
+        std::string particle;
+        std::size_t count = 0;
+        Quantity time;
+        VectorSpec position;
+        QuantitySpec energy;
+        VectorSpec momentum;
+        PolarisationSpec polarisation;
+    };
+
+    struct RunLimits {
+        Quantity timeStep;               // Interval of each stepAll
+        std::optional<Quantity> endTime; // Stop here and discard survivors instead of stepping until empty
+    };
+
+    struct Scenario {
+        std::string name;
+        std::uint64_t seed = 0;
+        nlohmann::json geometry; // Root object description, validated by buildGeometry()
+        std::string detector;    // Name of the object that logs particles
+        std::vector<Source> sources;
+        RunLimits run;
+    };
+
+    // Parse a scenario document; throws std::invalid_argument naming the offending JSON path
+    [[nodiscard]] Scenario parse(const nlohmann::json& document);
+
+    // Read and parse a scenario file; throws std::runtime_error if it cannot be read
+    [[nodiscard]] Scenario load(const std::filesystem::path& path);
+
+    // Create the world described by geometry in g_objectManager (without activating it) and return it; throws
+    // std::invalid_argument for malformed objects
+    [[nodiscard]] Object* buildGeometry(const nlohmann::json& geometry);
+
+    // Depth-first search of the tree under root; throws std::invalid_argument if no object has that name
+    [[nodiscard]] const Object* findObject(const Object* root, std::string_view name);
+
+    // Add every source's particles to target (draws from the SourceSampling stream)
+    void generateParticles(const Scenario& scenario, ParticleManager& target = g_particleManager);
+
+    // Relative cost in expected particle steps
+    [[nodiscard]] double estimateCost(const Scenario& scenario, const Object* world);
+} // namespace scenario_file
+
+#endif //PHYSICS_SIMULATION_PROGRAM_SCENARIO_FILE_H
@@ -0,0 +1,371 @@
+//
+// Physics Simulation Program
+// File: sweep_runner.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of sweep_runner.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/scenarios/sweep_runner.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "config/path_config.h"
+#include "core/random/random_manager.h"
+#include "core/tracing/memory_accounting.h"
+#include "simulation/simulation_context.h"
+#include "simulation/stepping/step_manager.h"
+
+namespace sweep_runner {
+    namespace {
+        constexpr std::size_t k_minParticlesPerWorker = 256; // Below this a worker's start-up outweighs its share
+
+        double secondsSince(const std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Variant names become folder names
+        std::string folderName(const std::string_view name) {
+            std::string result;
+            result.reserve(name.size());
+            for (const unsigned char ch : name) {
+                result.push_back(std::isalnum(ch) || ch == '_' || ch == '-' || ch == '.' ? static_cast<char>(ch) : '_');
+            }
+            return result.empty() ? "variant" : result;
+        }
+
+        Variant makeVariant(const nlohmann::json& base, std::string name, nlohmann::json overrides) {
+            auto document = base;
+            for (const auto& [pointer, value] : overrides.items()) {
+                try {
+                    document[nlohmann::json::json_pointer(pointer)] = value;
+                } catch (const nlohmann::json::exception& error) {
+                    throw std::invalid_argument(std::format("Variant '{}' cannot set '{}': {}", name, pointer, error.what()));
+                }
+            }
+            try {
+                auto scenario = scenario_file::parse(document);
+                return {std::move(name), std::move(overrides), std::move(scenario)};
+            } catch (const std::invalid_argument& error) {
+                throw std::invalid_argument(std::format("Variant '{}': {}", name, error.what()));
+            }
+        }
+
+        // One variant per combination of the grid values, last pointer varying fastest
+        void expandGrid(const nlohmann::json& base, const nlohmann::json& grid, std::vector<Variant>& variants) {
+            std::vector<std::pair<std::string, const nlohmann::json*>> axes;
+            std::size_t combinations = 1;
+            for (const auto& [pointer, values] : grid.items()) {
+                if (!values.is_array() || values.empty()) {
+                    throw std::invalid_argument(std::format("Sweep grid entry '{}' must be a non-empty array", pointer));
+                }
+                axes.emplace_back(pointer, &values);
+                combinations *= values.size();
+            }
+
+            for (std::size_t combination = 0; combination < combinations; ++combination) {
+                auto overrides = nlohmann::json::object();
+                std::size_t remainder = combination;
+                for (auto axis = axes.rbegin(); axis != axes.rend(); ++axis) {
+                    const auto& values = *axis->second;
+                    overrides[axis->first] = values[remainder % values.size()];
+                    remainder /= values.size();
+                }
+                variants.push_back(makeVariant(base, std::format("grid_{}", combination), std::move(overrides)));
+            }
+        }
+
+        std::size_t initialParticles(const scenario_file::Scenario& scenario) {
+            return std::accumulate(scenario.sources.begin(), scenario.sources.end(), std::size_t{0},
+                                   [](const std::size_t total, const auto& source) { return total + source.count; });
+        }
+
+        struct Planned {
+            const Variant* variant = nullptr;
+            Object* world = nullptr;
+            bool geometryShared = false;
+            double setupSeconds = 0.0;
+            double cost = 0.0;
+            std::size_t threads = 1;
+        };
+
+        // Runs one variant start to finish in its own context, seeded with the scenario seed; safe to call concurrently
+        // for variants with different worlds
+        VariantResult runVariant(const Planned& planned, const std::filesystem::path& sweepFolder) {
+            const auto& scenario = planned.variant->scenario;
+            VariantResult result;
+            result.name = planned.variant->name;
+            result.overrides = planned.variant->overrides;
+            result.estimatedCost = planned.cost;
+            result.threads = planned.threads;
+            result.geometryShared = planned.geometryShared;
+            result.setupSeconds = planned.setupSeconds;
+            result.outputFolder = sweepFolder / folderName(planned.variant->name);
+
+            // Fresh particles, clock, statistics and detector logs; discarded with any survivors afterwards
+            SimulationContext context(result.outputFolder.string());
+            context.setWorld(planned.world);
+            context.setWorkerThreads(result.threads);
+            context.setRandomSeed(scenario.seed);
+            const random_manager::ScopedThreadMasterSeed seedScope(scenario.seed); // Source sampling on this thread
+            const auto* detector = scenario_file::findObject(planned.world, scenario.detector);
+
+            const auto generationStart = std::chrono::steady_clock::now();
+            scenario_file::generateParticles(scenario, context.particles());
+            result.generationSeconds = secondsSince(generationStart);
+
+            const auto steppingStart = std::chrono::steady_clock::now();
+            if (scenario.run.endTime) {
+                stepUntilTime(context, detector, *scenario.run.endTime, scenario.run.timeStep);
+                context.particles().withExclusiveAccess([&result, &context](const auto& particles) {
+                    result.particlesDiscarded = particles.size() + context.spill().size();
+                });
+            } else {
+                stepUntilEmpty(context, detector, scenario.run.timeStep);
+            }
+            result.steppingSeconds = secondsSince(steppingStart);
+            result.counters = context.statistics().totals();
+            return result;
+        }
+    } // namespace
+
+    Sweep parse(const nlohmann::json& document, const std::filesystem::path& baseDirectory) {
+        if (!document.is_object()) {
+            throw std::invalid_argument("Sweep document must be an object");
+        }
+
+        // A plain scenario is a sweep of one
+        if (!document.contains("base")) {
+            auto variant = makeVariant(document, "base", nlohmann::json::object());
+            Sweep sweep{variant.scenario.name, {}};
+            sweep.variants.push_back(std::move(variant));
+            return sweep;
+        }
+
+        nlohmann::json base = document["base"];
+        if (base.is_string()) {
+            const auto path = baseDirectory / base.get<std::string>();
+            std::ifstream file(path);
+            if (!file) {
+                throw std::invalid_argument(std::format("Failed to open base scenario '{}'", path.string()));
+            }
+            base = nlohmann::json::parse(file);
+        }
+
+        Sweep sweep;
+        sweep.name = document.contains("name") ? document["name"].get<std::string>() : base.value("name", "sweep");
+
+        if (const auto it = document.find("variants"); it != document.end()) {
+            if (!it->is_array()) {
+                throw std::invalid_argument("Sweep field '/variants' must be an array");
+            }
+            for (std::size_t i = 0; i < it->size(); ++i) {
+                const auto& entry = (*it)[i];
+                auto overrides = entry.value("set", nlohmann::json::object());
+                if (!overrides.is_object()) {
+                    throw std::invalid_argument(std::format("Sweep field '/variants/{}/set' must be an object", i));
+                }
+                sweep.variants.push_back(makeVariant(base, entry.value("name", std::format("variant_{}", i)), std::move(overrides)));
+            }
+        }
+        if (const auto it = document.find("grid"); it != document.end()) {
+            if (!it->is_object()) {
+                throw std::invalid_argument("Sweep field '/grid' must be an object");
+            }
+            expandGrid(base, *it, sweep.variants);
+        }
+        if (sweep.variants.empty()) {
+            sweep.variants.push_back(makeVariant(base, "base", nlohmann::json::object()));
+        }
+
+        std::unordered_map<std::string, std::size_t> names;
+        for (const auto& variant : sweep.variants) {
+            if (++names[folderName(variant.name)] > 1) {
+                throw std::invalid_argument(std::format("Sweep '{}' has more than one variant named '{}'", sweep.name, variant.name));
+            }
+        }
+        return sweep;
+    }
+
+    Sweep load(const std::filesystem::path& path) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::runtime_error(std::format("Failed to open sweep file '{}'", path.string()));
+        }
+        try {
+            return parse(nlohmann::json::parse(file), path.parent_path());
+        } catch (const nlohmann::json::exception& error) {
+            throw std::runtime_error(std::format("Failed to parse sweep file '{}': {}", path.string(), error.what()));
+        }
+    }
+
+    std::vector<VariantResult> run(const Sweep& sweep, std::ostream& progress) {
+        const std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        // Build every distinct geometry first: validates the whole sweep and gives the cost estimates their world size
+        std::vector<Planned> plan;
+        std::unordered_map<std::string, Object*> worlds; // Keyed by the geometry JSON
+        for (const auto& variant : sweep.variants) {
+            const auto setupStart = std::chrono::steady_clock::now();
+            auto [it, inserted] = worlds.try_emplace(variant.scenario.geometry.dump(), nullptr);
+            if (inserted) {
+                it->second = scenario_file::buildGeometry(variant.scenario.geometry);
+            }
+            (void)scenario_file::findObject(it->second, variant.scenario.detector);
+            plan.push_back({&variant, it->second, !inserted, secondsSince(setupStart),
+                            scenario_file::estimateCost(variant.scenario, it->second),
+                            std::clamp<std::size_t>(initialParticles(variant.scenario) / k_minParticlesPerWorker, 1, hardwareThreads)});
+        }
+        std::ranges::stable_sort(plan, std::ranges::greater{}, &Planned::cost);
+
+        const double totalCost = std::accumulate(plan.begin(), plan.end(), 0.0,
+                                                 [](const double total, const Planned& planned) { return total + planned.cost; });
+        const auto sweepFolder = std::filesystem::path(config::paths::outputDirectory) / folderName(sweep.name);
+        memory_accounting::resetPeaks();
+        const auto sweepStart = std::chrono::steady_clock::now();
+
+        // Scheduler state, all guarded by mutex
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::vector<std::optional<VariantResult>> results(plan.size());
+        std::vector<bool> started(plan.size(), false);
+        std::unordered_set<const Object*> busyWorlds;
+        std::size_t freeThreads = hardwareThreads;
+        std::size_t running = 0;
+        std::size_t completed = 0;
+        double completedCost = 0.0;
+        std::exception_ptr failure;
+
+        const auto runPlanned = [&](const std::size_t index) {
+            const auto& planned = plan[index];
+            std::optional<VariantResult> result;
+            std::exception_ptr error;
+            try {
+                result = runVariant(planned, sweepFolder);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::scoped_lock lock(mutex);
+            if (result) {
+                completedCost += planned.cost;
+                const double elapsed = secondsSince(sweepStart);
+                progress << std::format(
+                    "[{}/{}] {}: {:.2f} s stepping, {} steps, {} threads{}; about {:.0f} s of the sweep remaining\n",
+                    ++completed,
+                    plan.size(),
+                    result->name,
+                    result->steppingSeconds,
+                    result->counters.steps,
+                    result->threads,
+                    planned.geometryShared ? ", shared geometry" : "",
+                    completedCost > 0.0 ? elapsed * (totalCost - completedCost) / completedCost : 0.0
+                );
+                results[index] = std::move(result);
+            } else if (!failure) {
+                failure = error;
+            }
+            freeThreads += planned.threads;
+            busyWorlds.erase(planned.world);
+            --running;
+            finished.notify_one();
+        };
+
+        // Start the costliest variant whose world is free and whose workers fit the idle threads (each fits an idle
+        // machine, as threads never exceed hardware_concurrency), so small variants fill the cores left beside large ones
+        std::vector<std::thread> variantThreads;
+        variantThreads.reserve(plan.size());
+        {
+            std::unique_lock lock(mutex);
+            std::size_t pending = plan.size();
+            while (pending > 0 && !failure) {
+                std::optional<std::size_t> next;
+                for (std::size_t i = 0; i < plan.size() && !next; ++i) {
+                    if (!started[i] && !busyWorlds.contains(plan[i].world) && plan[i].threads <= freeThreads) {
+                        next = i;
+                    }
+                }
+                if (!next) {
+                    finished.wait(lock);
+                    continue;
+                }
+                started[*next] = true;
+                busyWorlds.insert(plan[*next].world);
+                freeThreads -= plan[*next].threads;
+                ++running;
+                --pending;
+                variantThreads.emplace_back(runPlanned, *next);
+            }
+        }
+        for (auto& thread : variantThreads) {
+            thread.join();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+
+        std::vector<VariantResult> ordered;
+        ordered.reserve(results.size());
+        for (auto& result : results) {
+            ordered.push_back(std::move(*result));
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(sweepFolder, ec);
+        if (std::ofstream summary(sweepFolder / "results.json"); summary) {
+            summary << toJson(sweep, ordered).dump(2) << '\n';
+        } else {
+            progress << std::format("Failed to write sweep results to '{}'\n", (sweepFolder / "results.json").string());
+        }
+        return ordered;
+    }
+
+    nlohmann::json toJson(const Sweep& sweep, const std::vector<VariantResult>& results) {
+        auto variants = nlohmann::json::array();
+        for (const auto& result : results) {
+            nlohmann::json variant = {
+                {"name", result.name},
+                {"set", result.overrides},
+                {"estimated_cost", result.estimatedCost},
+                {"threads", result.threads},
+                {"geometry_shared", result.geometryShared},
+                {"setup_seconds", result.setupSeconds},
+                {"generation_seconds", result.generationSeconds},
+                {"stepping_seconds", result.steppingSeconds},
+                {"particles_discarded", result.particlesDiscarded},
+                {"output_folder", result.outputFolder.string()}
+            };
+            variant.update(toJson(result.counters));
+            variants.push_back(std::move(variant));
+        }
+        return {{"sweep", sweep.name}, {"variants", std::move(variants)}};
+    }
+
+    nlohmann::json toJson(const StepCounters& counters) {
+        return {
+            {"steps", counters.steps},
+            {"steps_by_limiter", counters.stepsByLimiter},
+            {"secondaries", counters.secondaries},
+            {"step_all_calls", counters.stepAllCalls},
+            {"boundary_fallbacks", counters.boundaryFallbacks},
+            {"watchdog_trips", counters.watchdogTrips}
+        };
+    }
+} // namespace sweep_runner
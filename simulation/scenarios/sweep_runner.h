@@ -0,0 +1,112 @@
+//
+// Physics Simulation Program
+// File: sweep_runner.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Runs many variants of a scenario file in one process, sharing the loaded databases and identical geometry
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_SWEEP_RUNNER_H
+#define PHYSICS_SIMULATION_PROGRAM_SWEEP_RUNNER_H
+
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "simulation/scenarios/scenario_file.h"
+#include "simulation/stepping/step_statistics.h"
+
+// sweep_runner
+//
+// Notes on initialisation:
+//   - A sweep file names a base scenario ("base": a path relative to the sweep file, or an inline scenario) and lists
+//     "variants" (each {"name": ..., "set": {JSON pointer: value}}) and/or a "grid" ({JSON pointer: [values]}) whose
+//     cartesian product adds one variant per combination; a plain scenario file loads as a single-variant sweep
+//   - Every variant is parsed and its geometry built before the first one runs, so a malformed variant fails the sweep
+//     up front rather than after hours of earlier runs
+//
+// Notes on algorithms:
+//   - Databases are loaded once per process and shared by every variant; variants whose geometry JSON is identical
+//     share one built world (worlds are immutable while stepping)
+//   - Each variant runs in its own SimulationContext (particles, clock, statistics and detector logs), so nothing
+//     carries over between variants and the global state is left untouched
+//   - Each variant gets at most one worker per k_minParticlesPerWorker initial particles (up to hardware_concurrency),
+//     so small variants do not pay thread start-up for idle workers
+//   - Variants run concurrently, packed onto the cores by estimated cost: whenever threads are idle, the costliest
+//     waiting variant whose workers fit them starts on its own thread. Large variants so start first and small ones
+//     fill the cores beside them. Variants sharing a world never overlap (stepping caches the field on its volumes)
+//   - Each variant's context and its source sampling are seeded with the scenario seed as a thread master seed, so a
+//     variant's results depend neither on its position in the sweep nor on what runs beside it
+//   - A failing variant stops further variants from starting; those running finish and the first error is rethrown
+//
+// Notes on output:
+//   - Detector logs go to <outputDirectory>/<sweep name>/<variant name>/ and a summary of every variant to
+//     <outputDirectory>/<sweep name>/results.json
+//
+// Supported overloads / operations and functions / methods:
+//   - Parsing:                parse(), load()
+//   - Running:                run()
+//   - Output:                 toJson()
+//
+// Example usage:
+//   const auto sweep = sweep_runner::load("scenarios/photon_cell_sweep.json");
+//   const auto results = sweep_runner::run(sweep, std::cout);
+//
+// Example file:
+//   {
+//     "name": "photon_cell_sweep",
+//     "base": "photon_cell.json",
+//     "variants": [{"name": "coarse", "set": {"/run/time_step/value": 1e-12}}],
+//     "grid": {"/sources/0/count": [1000, 4000]}
+//   }
+namespace sweep_runner {
+    struct Variant {
+        std::string name;
+        nlohmann::json overrides = nlohmann::json::object(); // JSON pointer -> value applied to the base scenario
+        scenario_file::Scenario scenario;
+    };
+
+    struct Sweep {
+        std::string name;
+        std::vector<Variant> variants;
+    };
+
+    struct VariantResult {
+        std::string name;
+        nlohmann::json overrides;
+        double estimatedCost = 0.0;
+        std::size_t threads = 0;
+        bool geometryShared = false;         // World reused from an earlier variant
+        double setupSeconds = 0.0;
+        double generationSeconds = 0.0;
+        double steppingSeconds = 0.0;
+        std::size_t particlesDiscarded = 0;  // Alive at end_time
+        StepCounters counters;
+        std::filesystem::path outputFolder;
+    };
+
+    // Expand a sweep document; baseDirectory resolves a relative "base" path. Throws std::invalid_argument for
+    // malformed sweeps and variants
+    [[nodiscard]] Sweep parse(const nlohmann::json& document, const std::filesystem::path& baseDirectory);
+
+    // Read a sweep or plain scenario file; throws std::runtime_error if it cannot be read
+    [[nodiscard]] Sweep load(const std::filesystem::path& path);
+
+    // Run every variant, writing one progress line per variant to progress as it finishes; results are returned in
+    // descending estimated cost
+    [[nodiscard]] std::vector<VariantResult> run(const Sweep& sweep, std::ostream& progress);
+
+    // JSON summary of the results; the second form gives the step counters alone (also used by run_daemon)
+    [[nodiscard]] nlohmann::json toJson(const Sweep& sweep, const std::vector<VariantResult>& results);
+    [[nodiscard]] nlohmann::json toJson(const StepCounters& counters);
+} // namespace sweep_runner
+
+#endif //PHYSICS_SIMULATION_PROGRAM_SWEEP_RUNNER_H
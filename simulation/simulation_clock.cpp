@@ -18,10 +18,9 @@
 
 #include "core/quantities/units.h"
 
-namespace {
-    std::mutex g_clockMutex;
-    Quantity g_simulationTime{0.0, Unit::timeDimension()};
+SimulationClock g_simulationClock;
 
+namespace {
     // Extension on has time dimension to have proper handling for non-finite times
     void verifyTimeDimension(const Quantity& quantity, const char* context) {
         if (!Unit::hasTimeDimension(quantity.unit)) {
@@ -34,26 +33,26 @@ namespace {
     }
 } // namespace
 
-Quantity simulation_clock::currentTime() {
-    std::scoped_lock lock(g_clockMutex);
+Quantity SimulationClock::currentTime() const {
+    std::scoped_lock lock(this->m_mutex);
 
-    return g_simulationTime;
+    return this->m_time;
 }
 
-void simulation_clock::setTime(const Quantity& time) {
+void SimulationClock::setTime(const Quantity& time) {
     verifyTimeDimension(time, "Simulation time must have time dimensions");
 
-    std::scoped_lock lock(g_clockMutex);
+    std::scoped_lock lock(this->m_mutex);
 
-    g_simulationTime = time;
+    this->m_time = time;
 }
 
-Quantity simulation_clock::advance(const Quantity& dt) {
+Quantity SimulationClock::advance(const Quantity& dt) {
     verifyTimeDimension(dt, "Simulation time step must have time dimensions");
 
-    std::scoped_lock lock(g_clockMutex);
+    std::scoped_lock lock(this->m_mutex);
 
-    g_simulationTime += dt;
+    this->m_time += dt;
 
-    return g_simulationTime;
+    return this->m_time;
 }
@@ -4,7 +4,7 @@
 // Created by Tobias Sharman on 29/11/2025
 //
 // Description:
-//   - Global simulation clock helpers for tracking absolute simulation time
+//   - Simulation clock tracking absolute simulation time, with helpers for the global clock
 //
 // Copyright (c) 2025, Tobias Sharman
 // Licensed under a Non-Commercial License. See LICENSE file for details
@@ -14,19 +14,58 @@
 #define PHYSICS_SIMULATION_PROGRAM_SIMULATION_CLOCK_H
 
 #include "core/quantities/quantity.h"
+#include "core/tracing/lock_profiling.h"
+
+// SimulationClock
+//
+// Notes on initialisation:
+//   - Starts at t = 0 s; a global instance g_simulationClock backs the simulation_clock helpers and each owning
+//     SimulationContext has its own
+//
+// Supported overloads / operations and functions / methods:
+//   - Getter:                 currentTime()
+//   - Setters:                setTime(), reset(), advance()
+//   - Global instance:        g_simulationClock
+//
+// Example usage:
+//   SimulationClock clock;
+//   clock.advance(Quantity(1e-12, "s"));
+class SimulationClock {
+    public:
+        SimulationClock() = default;
+
+        SimulationClock(const SimulationClock&) = delete;
+        SimulationClock& operator=(const SimulationClock&) = delete;
+
+        // Current absolute simulation time (thread-safe copy)
+        [[nodiscard]] Quantity currentTime() const;
+
+        // Set the clock to a specific absolute time; reset() is an alias defaulting to 0
+        void setTime(const Quantity& time = Quantity(0.0, Unit::timeDimension()));
+        void reset(const Quantity& time = Quantity(0.0, Unit::timeDimension())) { this->setTime(time); }
+
+        // Advance the clock by dt and return the new absolute time
+        [[nodiscard]] Quantity advance(const Quantity& dt);
+
+    private:
+        mutable lock_profiling::ProfiledMutex m_mutex{"simulation_clock"};
+        Quantity m_time{0.0, Unit::timeDimension()};
+};
+
+extern SimulationClock g_simulationClock;
 
 namespace simulation_clock {
     // Current absolute simulation time (thread-safe copy)
-    [[nodiscard]] Quantity currentTime();
+    [[nodiscard]] inline Quantity currentTime() { return g_simulationClock.currentTime(); }
 
     // Set the simulation clock to a specific absolute time
-    void setTime(const Quantity& time = Quantity(0.0, Unit::timeDimension()));
+    inline void setTime(const Quantity& time = Quantity(0.0, Unit::timeDimension())) { g_simulationClock.setTime(time); }
 
     // Convenience alias for setTime to set the global absolute time to 0
     inline void reset(const Quantity& time = Quantity(0.0, Unit::timeDimension())) { setTime(time); }
 
     // Advance the simulation clock by dt and return the new absolute time
-    [[nodiscard]] Quantity advance(const Quantity& dt);
+    [[nodiscard]] inline Quantity advance(const Quantity& dt) { return g_simulationClock.advance(dt); }
 } // namespace simulation_clock
 
 #endif //PHYSICS_SIMULATION_PROGRAM_SIMULATION_CLOCK_H
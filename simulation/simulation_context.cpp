@@ -0,0 +1,101 @@
+//
+// Physics Simulation Program
+// File: simulation_context.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of simulation_context.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/simulation_context.h"
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <thread>
+
+#include "objects/object_manager.h"
+#include "physics/fields/field_solver.h"
+#include "simulation/stepping/step_manager.h"
+
+struct SimulationContext::Owned {
+    explicit Owned(const std::string_view outputRoot) : detectorLogs(outputRoot) {}
+
+    ParticleManager particles;
+    SimulationClock clock;
+    DetectorLogs detectorLogs;
+    StepStatistics statistics;
+    Vector<3> backgroundField = g_BFieldStrength;
+};
+
+SimulationContext::SimulationContext(const std::string_view outputRoot) :
+    m_owned(std::make_unique<Owned>(outputRoot)),
+    m_particles(&this->m_owned->particles),
+    m_clock(&this->m_owned->clock),
+    m_detectorLogs(&this->m_owned->detectorLogs),
+    m_statistics(&this->m_owned->statistics),
+    m_backgroundField(&this->m_owned->backgroundField) {}
+
+SimulationContext::SimulationContext(GlobalTag) :
+    m_particles(&g_particleManager),
+    m_clock(&g_simulationClock),
+    m_detectorLogs(&g_detectorLogs),
+    m_statistics(&g_stepStatistics),
+    m_backgroundField(&g_BFieldStrength) {}
+
+SimulationContext::~SimulationContext() = default;
+
+SimulationContext& SimulationContext::global() {
+    static SimulationContext instance{GlobalTag{}};
+    return instance;
+}
+
+Object* SimulationContext::world(const std::string_view context) const {
+    if (this->isGlobal()) {
+        return g_objectManager.getActiveWorld(context);
+    }
+    if (this->m_world == nullptr) {
+        throw std::runtime_error(std::format("Cannot {} because the simulation context has no world", context));
+    }
+    return this->m_world;
+}
+
+void SimulationContext::setWorld(Object* world) {
+    if (world == nullptr) {
+        throw std::invalid_argument("Cannot set a null world on a simulation context");
+    }
+    if (this->isGlobal()) {
+        g_objectManager.setActiveWorld(world);
+        return;
+    }
+    this->m_world = world;
+}
+
+void SimulationContext::setBackgroundField(const Vector<3>& field) {
+    *this->m_backgroundField = field;
+}
+
+std::size_t SimulationContext::workerThreads() const {
+    if (this->isGlobal()) {
+        return workerThreadCount();
+    }
+    return this->m_workerThreads > 0 ? this->m_workerThreads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+void SimulationContext::setWorkerThreads(const std::size_t count) {
+    if (this->isGlobal()) {
+        setWorkerThreadCount(count);
+        return;
+    }
+    if (const std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency()); count > hardwareThreads) {
+        throw std::invalid_argument(std::format(
+            "Requested worker thread count {} exceeds hardware_concurrency ({})",
+            count,
+            hardwareThreads
+        ));
+    }
+    this->m_workerThreads = count;
+}
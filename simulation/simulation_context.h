@@ -0,0 +1,154 @@
+//
+// Physics Simulation Program
+// File: simulation_context.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Bundles the mutable state of one simulation so several can run in one process
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_SIMULATION_CONTEXT_H
+#define PHYSICS_SIMULATION_PROGRAM_SIMULATION_CONTEXT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "config/path_config.h"
+#include "core/linear-algebra/vector.h"
+#include "databases/material-data/material_database.h"
+#include "databases/particle-data/particle_database.h"
+#include "objects/object.h"
+#include "particles/particle_manager.h"
+#include "particles/particle_spill.h"
+#include "simulation/data-collection/particle_collection.h"
+#include "simulation/data-collection/probe_readout.h"
+#include "simulation/simulation_clock.h"
+#include "simulation/stepping/step_statistics.h"
+
+// SimulationContext
+//
+// Notes on initialisation:
+//   - SimulationContext::global() wraps the process-wide state (g_particleManager, g_objectManager's active world,
+//     g_simulationClock, g_detectorLogs, g_stepStatistics, g_BFieldStrength and setWorkerThreadCount()); the context-free
+//     stepping functions use it, so existing callers are unaffected
+//   - A constructed context owns fresh particles, clock (t = 0 s), detector logs (rooted at outputRoot) and statistics,
+//     and copies the current g_BFieldStrength; its world must be set before stepping
+//   - Every context, the global one included, has its own ParticleSpill holding particles above its live budget
+//     (config::program::liveParticleBudget by default); stepAll balances it after purging dead particles
+//   - A ProbeReadout may be attached with setReadout(); the context only references it, and stepAll samples it after
+//     the purge whenever it is due
+//   - Worlds are still created through g_objectManager (during setup, which is not thread-safe) and only referenced
+//     here; the material and particle databases are shared as const references by every context
+//
+// Notes on algorithms:
+//   - Contexts share nothing mutable while stepping, so contexts with disjoint worlds may step concurrently from
+//     different threads; a world must not be stepped by two contexts at once, as stepUntil* caches the context's
+//     field on its volumes
+//   - Workers of a context draw from random streams randomStreamBase() + worker index. A context given a seed with
+//     setRandomSeed() installs it as the thread master seed of every thread stepping it, so concurrent contexts with
+//     their own seeds draw from independent streams whatever their bases; without one the process-wide master seed is
+//     used and concurrent contexts need disjoint bases (e.g. base = run index * worker count)
+//   - Step statistics are gathered in thread-local counters and flushed into the stepping context's statistics at the
+//     end of every worker chunk and stepAll, so concurrent contexts keep separate totals. Only the global context
+//     publishes to the metrics registry
+//
+// Supported overloads / operations and functions / methods:
+//   - Global context:         global(), isGlobal()
+//   - Mutable state:          particles(), spill(), clock(), detectorLogs(), statistics()
+//   - World:                  world(), setWorld()
+//   - Probe readout:          readout(), setReadout()
+//   - Field:                  backgroundField(), setBackgroundField()
+//   - Threads and streams:    workerThreads(), setWorkerThreads(), randomStreamBase(), setRandomStreamBase(),
+//                             randomSeed(), setRandomSeed()
+//   - Shared databases:       materials(), particleTypes()
+//
+// Example usage:
+//   SimulationContext context("Output/run_a");
+//   context.setWorld(world);
+//   context.setWorkerThreads(4);
+//   ParticleSource(context.particles()).generateParticles(...);
+//   stepUntilEmpty(context, detector, Quantity(1e-13, "s"));
+class SimulationContext {
+    public:
+        explicit SimulationContext(std::string_view outputRoot = config::paths::outputDirectory);
+        ~SimulationContext();
+
+        SimulationContext(const SimulationContext&) = delete;
+        SimulationContext& operator=(const SimulationContext&) = delete;
+
+        // Global context methods
+        [[nodiscard]] static SimulationContext& global();
+        [[nodiscard]] bool isGlobal() const noexcept { return this->m_owned == nullptr; }
+
+        // Mutable state getters
+        [[nodiscard]] ParticleManager& particles() const noexcept { return *this->m_particles; }
+        [[nodiscard]] ParticleSpill& spill() const noexcept { return *this->m_spill; }
+        [[nodiscard]] SimulationClock& clock() const noexcept { return *this->m_clock; }
+        [[nodiscard]] DetectorLogs& detectorLogs() const noexcept { return *this->m_detectorLogs; }
+        [[nodiscard]] StepStatistics& statistics() const noexcept { return *this->m_statistics; }
+
+        // World methods
+        //
+        // world() throws std::runtime_error naming context if no world is set; the global context reads and sets the
+        // active world of g_objectManager
+        [[nodiscard]] Object* world(std::string_view context) const;
+        void setWorld(Object* world);
+
+        // Probe readout methods
+        //
+        // Not owned; pass nullptr to detach. Must not be changed while stepAll is running
+        [[nodiscard]] ProbeReadout* readout() const noexcept { return this->m_readout; }
+        void setReadout(ProbeReadout* readout) noexcept { this->m_readout = readout; }
+
+        // Background field methods
+        //
+        // Uniform field scaled by each volume's relative permeability; takes effect at the next stepUntil* call
+        [[nodiscard]] const Vector<3>& backgroundField() const noexcept { return *this->m_backgroundField; }
+        void setBackgroundField(const Vector<3>& field);
+
+        // Worker thread methods
+        //
+        // Same rules as setWorkerThreadCount(): 0 -> hardware_concurrency, throws std::invalid_argument above it
+        [[nodiscard]] std::size_t workerThreads() const;
+        void setWorkerThreads(std::size_t count);
+
+        // Random stream methods
+        //
+        // randomSeed() is std::nullopt (the process-wide master seed) unless set; particles generated outside stepping
+        // need a random_manager::ScopedThreadMasterSeed with the same seed to draw from the context's streams
+        [[nodiscard]] std::size_t randomStreamBase() const noexcept { return this->m_randomStreamBase; }
+        void setRandomStreamBase(const std::size_t base) noexcept { this->m_randomStreamBase = base; }
+        [[nodiscard]] std::optional<std::uint64_t> randomSeed() const noexcept { return this->m_randomSeed; }
+        void setRandomSeed(const std::optional<std::uint64_t> seed) noexcept { this->m_randomSeed = seed; }
+
+        // Shared database getters
+        [[nodiscard]] const MaterialDatabase& materials() const noexcept { return g_materialDatabase; }
+        [[nodiscard]] const ParticleDatabase& particleTypes() const noexcept { return g_particleDatabase; }
+
+    private:
+        struct Owned;
+        struct GlobalTag {};
+
+        explicit SimulationContext(GlobalTag);
+
+        std::unique_ptr<Owned> m_owned; // Null for the global context
+        std::unique_ptr<ParticleSpill> m_spill = std::make_unique<ParticleSpill>();
+        ParticleManager* m_particles = nullptr;
+        SimulationClock* m_clock = nullptr;
+        DetectorLogs* m_detectorLogs = nullptr;
+        StepStatistics* m_statistics = nullptr;
+        Vector<3>* m_backgroundField = nullptr;
+        Object* m_world = nullptr;
+        ProbeReadout* m_readout = nullptr;
+        std::size_t m_workerThreads = 0;
+        std::size_t m_randomStreamBase = 0;
+        std::optional<std::uint64_t> m_randomSeed;
+};
+
+#endif //PHYSICS_SIMULATION_PROGRAM_SIMULATION_CONTEXT_H
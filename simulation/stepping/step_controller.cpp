@@ -0,0 +1,87 @@
+//
+// Physics Simulation Program
+// File: step_controller.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of step_controller.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/stepping/step_controller.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+#include "simulation/stepping/step_events.h"
+
+namespace {
+    step_controller::Settings g_settings{};
+
+    double clampToBounds(const double seconds, const step_controller::Settings& settings) noexcept {
+        return std::clamp(seconds, settings.minTimeStep, settings.maxTimeStep);
+    }
+} // namespace
+
+void step_controller::setSettings(const Settings& settings) {
+    if (!(settings.minTimeStep > 0.0) || !std::isfinite(settings.maxTimeStep) || settings.maxTimeStep < settings.minTimeStep) {
+        throw std::invalid_argument(std::format(
+            "Adaptive time step bounds must satisfy 0 < min <= max but got [{}, {}] s",
+            settings.minTimeStep,
+            settings.maxTimeStep
+        ));
+    }
+    if (!(settings.targetStepsPerVisit > 0.0) || !(settings.maxSecondariesPerVisit > 0.0) || !(settings.maxWallSeconds >= 0.0)) {
+        throw std::invalid_argument("Adaptive time step targets must be positive (maxWallSeconds may be 0)");
+    }
+    if (!(settings.maxShrink > 0.0 && settings.maxShrink <= 1.0) || !(settings.maxGrowth >= 1.0) || !std::isfinite(settings.maxGrowth)) {
+        throw std::invalid_argument(std::format(
+            "Adaptive time step factors must satisfy 0 < maxShrink <= 1 <= maxGrowth but got {} and {}",
+            settings.maxShrink,
+            settings.maxGrowth
+        ));
+    }
+    g_settings = settings;
+}
+
+const step_controller::Settings& step_controller::settings() noexcept {
+    return g_settings;
+}
+
+step_controller::Controller::Controller(const double initial) noexcept :
+    m_seconds(g_settings.enabled ? clampToBounds(initial, g_settings) : initial) {}
+
+void step_controller::Controller::update(const StepCounters& lastStepAll) noexcept {
+    const auto& settings = g_settings;
+    if (!settings.enabled || lastStepAll.particleVisits == 0) {
+        return;
+    }
+
+    const auto visits = static_cast<double>(lastStepAll.particleVisits);
+    const auto timeLimited = lastStepAll.stepsByLimiter[static_cast<std::size_t>(StepLimiter::Time)];
+    const auto eventSteps = static_cast<double>(lastStepAll.steps - std::min(timeLimited, lastStepAll.steps));
+
+    // Work per barrier; with no event steps at all the interval is too short to see any
+    double factor = eventSteps > 0.0 ? settings.targetStepsPerVisit * visits / eventSteps : settings.maxGrowth;
+
+    if (lastStepAll.secondaries > 0) {
+        factor = std::min(factor, settings.maxSecondariesPerVisit * visits / static_cast<double>(lastStepAll.secondaries));
+    }
+
+    if (settings.maxWallSeconds > 0.0) {
+        std::uint64_t wallNanoseconds = 0;
+        for (const auto phase : lastStepAll.phaseNanoseconds) {
+            wallNanoseconds += phase;
+        }
+        if (wallNanoseconds > 0) {
+            factor = std::min(factor, settings.maxWallSeconds * 1e9 / static_cast<double>(wallNanoseconds));
+        }
+    }
+
+    factor = std::clamp(factor, settings.maxShrink, settings.maxGrowth);
+    this->m_seconds = clampToBounds(this->m_seconds * factor, settings);
+}
@@ -0,0 +1,83 @@
+//
+// Physics Simulation Program
+// File: step_controller.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes the adaptive controller choosing the stepAll interval of stepUntilTime and stepUntilEmpty
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_STEP_CONTROLLER_H
+#define PHYSICS_SIMULATION_PROGRAM_STEP_CONTROLLER_H
+
+#include "config/program_config.h"
+#include "core/quantities/quantity.h"
+#include "simulation/stepping/step_statistics.h"
+
+// step_controller
+//
+// Notes on initialisation:
+//   - Settings default to the adaptive step values in config/program_config.h and may be replaced with setSettings()
+//     before stepping; they are read without synchronisation, so do not change them while a stepUntil* call is running
+//   - Disabled by default: stepUntil* then steps with the dt it is given, exactly as before. When enabled that dt is
+//     only the first interval and the controller picks every later one
+//
+// Notes on algorithms:
+//   - After each stepAll the controller reads the context's StepStatistics::lastStepAll() and rescales dt by one
+//     factor, the smallest of:
+//         -> Work per barrier: targetStepsPerVisit / (non-Time limited steps per particle visit). Boundary, decay and
+//            interaction steps grow roughly linearly with dt, while a Time limited step ends every visit regardless, so
+//            a run where almost every step is Time limited is dominated by barriers and dt grows
+//         -> Serial spawn loop: maxSecondariesPerVisit / (secondaries per particle visit), as secondaries created
+//            mid-step are stepped serially to the end of the interval
+//         -> Wall time: maxWallSeconds / (wall time of the stepAll), keeping progress reports and cancellation
+//            responsive (0 disables this bound)
+//   - The factor is clamped to [maxShrink, maxGrowth] per stepAll and dt to [minTimeStep, maxTimeStep]; a stepAll
+//     with no particle visits (only spilled particles left) leaves dt unchanged
+//   - stepUntilTime still shortens the last interval to land on the target time
+//
+// Supported overloads / operations and functions / methods:
+//   - Settings:               setSettings(), settings()
+//   - Control:                Controller::timeStep(), Controller::update()
+//
+// Example usage:
+//   step_controller::setSettings({.enabled = true, .minTimeStep = 1e-16, .maxTimeStep = 1e-10});
+//   stepUntilEmpty(detector, Quantity(1e-13, "s")); // 1e-13 s is the first interval only
+namespace step_controller {
+    struct Settings {
+        bool enabled = config::program::adaptiveTimeStep;
+        double minTimeStep = config::program::adaptiveMinTimeStep;                     // s
+        double maxTimeStep = config::program::adaptiveMaxTimeStep;                     // s
+        double targetStepsPerVisit = config::program::adaptiveTargetStepsPerVisit;     // Non-Time limited steps per particle per stepAll
+        double maxSecondariesPerVisit = config::program::adaptiveMaxSecondariesPerVisit;
+        double maxWallSeconds = config::program::adaptiveMaxWallSeconds;               // 0 -> unbounded
+        double maxGrowth = 2.0;                                                        // Per stepAll
+        double maxShrink = 0.25;                                                       // Per stepAll
+    };
+
+    // Throws std::invalid_argument if the bounds are not positive and ordered or the factors do not bracket 1
+    void setSettings(const Settings& settings);
+    [[nodiscard]] const Settings& settings() noexcept;
+
+    // Controller
+    //
+    // Holds the interval for one stepUntil* call
+    class Controller {
+        public:
+            // initial is the dt passed to stepUntil*, in seconds; clamped to the settings' bounds when enabled
+            explicit Controller(double initial) noexcept;
+
+            [[nodiscard]] Quantity timeStep() const { return Quantity(this->m_seconds, "s"); }
+
+            // Rescale the interval from the counters of the stepAll just finished; no-op when disabled
+            void update(const StepCounters& lastStepAll) noexcept;
+
+        private:
+            double m_seconds;
+    };
+} // namespace step_controller
+
+#endif //PHYSICS_SIMULATION_PROGRAM_STEP_CONTROLLER_H
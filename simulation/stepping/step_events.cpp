@@ -17,6 +17,7 @@
 #include <stdexcept>
 
 #include "config/program_config.h"
+#include "core/tracing/tracing.h"
 #include "physics/processes/interaction_utilities.h"
 #include "physics/processes/continuous/particle_continuous_interactions.h"
 #include "physics/processes/discrete/core/interaction_process_registry.h"
@@ -122,6 +123,7 @@ StepEvent determineStepEvent(
     const StepPoint &preStep,
     const Object *world
 ) {
+    TRACE_SCOPE("determineStepEvent");
     if (world == nullptr) {
         throw std::runtime_error("Active world is not available while determining the step event");
     }
@@ -13,8 +13,13 @@
 #include "simulation/stepping/step_manager.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <format>
 #include <cmath>
 #include <limits>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 #include <vector>
@@ -22,18 +27,127 @@
 #include "config/program_config.h"
 #include "core/linear-algebra/vector.h"
 #include "core/random/random_manager.h"
-#include "objects/object_manager.h"
+#include "core/tracing/allocation_tracking.h"
+#include "core/tracing/memory_accounting.h"
+#include "core/tracing/tracing.h"
 #include "particles/particle_manager.h"
+#include "physics/fields/field_solver.h"
 #include "physics/processes/interaction_utilities.h"
 #include "physics/processes/discrete/core/decay_utilities.h"
 #include "physics/processes/discrete/core/interaction_sampling.h"
-#include "simulation/simulation_clock.h"
+#include "simulation/simulation_context.h"
 #include "simulation/geometry/boundary/boundary_interactions.h"
+#include "simulation/geometry/boundary/convex_bounces.h"
 #include "simulation/motion/particle_motion.h"
+#include "simulation/stepping/step_controller.h"
 #include "simulation/stepping/step_events.h"
+#include "simulation/stepping/step_statistics.h"
 #include "simulation/stepping/step_utilities.h"
+#include "simulation/stepping/step_watchdog.h"
+
+static_assert(static_cast<std::size_t>(StepLimiter::Interaction) + 1 == k_stepLimiterCount,
+              "k_stepLimiterCount must match the number of StepLimiter values");
 
 namespace {
+    constexpr std::size_t k_cacheLineBytes = 64;
+
+    void recordAllocations(const allocation_tracking::AllocationScope &scope) noexcept {
+        const auto counts = scope.counts();
+        auto &counters = StepStatistics::local();
+        counters.allocations += counts.allocations;
+        counters.allocatedBytes += counts.bytes;
+    }
+
+    std::atomic<std::size_t> g_workerThreadCount{config::program::maxWorkerThreads}; // 0 -> hardware_concurrency
+
+    std::size_t hardwareThreadCount() {
+        return std::max<unsigned>(1, std::thread::hardware_concurrency());
+    }
+
+    // Records the steps a particle took on every exit path of stepParticle
+    struct VisitRecorder {
+        StepCounters &counters;
+        const std::uint64_t &steps;
+
+        ~VisitRecorder() { this->counters.recordVisit(this->steps); }
+    };
+
+    // Progress of one particle through the interval, so a worker can suspend it between steps and resume another
+    struct Track {
+        std::unique_ptr<Particle> *particle = nullptr;
+        Quantity remainingTime{};
+        const Object *currentMedium = nullptr;
+        std::uint64_t steps = 0;
+        std::optional<step_watchdog::TrackMonitor> watchdog;
+    };
+
+    // Running: more steps to take. Finished: the step loop ended and the particle still needs its end-of-interval
+    // checks. Removed: the particle was logged, killed or released and needs nothing more
+    enum class TrackStatus {
+        Running,
+        Finished,
+        Removed
+    };
+
+    // Records the steps of the tracks still in flight when stepInterleaved exits early, as VisitRecorder does for
+    // stepParticle; slots are deactivated as soon as their visit is recorded
+    template<std::size_t Width>
+    struct InFlightVisits {
+        StepCounters &counters;
+        const std::array<Track, Width> &tracks;
+        const std::array<bool, Width> &active;
+
+        ~InFlightVisits() {
+            for (std::size_t slot = 0; slot < Width; ++slot) {
+                if (this->active[slot]) {
+                    this->counters.recordVisit(this->tracks[slot].steps);
+                }
+            }
+        }
+    };
+
+    // Cache prefetch hint; a no-op where the compiler has no builtin
+    void prefetch(const void *address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#else
+        (void) address;
+#endif
+    }
+
+    // The base Particle fields read by the next step (derived fields such as atomic levels are left to the hardware)
+    void prefetchParticle(const Particle *particle) noexcept {
+        if (particle == nullptr) {
+            return;
+        }
+        const auto *bytes = reinterpret_cast<const char *>(particle);
+        for (std::size_t offset = 0; offset < sizeof(Particle); offset += k_cacheLineBytes) {
+            prefetch(bytes + offset);
+        }
+    }
+
+    // First stage, right after a step: the particle and the Object it is now in
+    void prefetchTrack(const Track &track) noexcept {
+        prefetchParticle(track.particle->get());
+        if (track.currentMedium != nullptr) {
+            prefetch(track.currentMedium);
+            prefetch(reinterpret_cast<const char *>(track.currentMedium) + k_cacheLineBytes);
+        }
+    }
+
+    // Second stage, one turn before the track runs: what the medium points at (by then the medium itself is cached),
+    // namely its child list for the geometry search and its material name for the database lookups
+    void prefetchMediumContents(const Track &track) noexcept {
+        if (const auto *medium = track.currentMedium; medium != nullptr) {
+            const auto &children = medium->getChildren();
+            if (!children.empty()) {
+                prefetch(children.data());
+                prefetch(children.front().get());
+            }
+            prefetch(medium->getMaterial().data());
+        }
+    }
+
     StepPoint buildStepPoint(const Particle &particle, const Object *medium) {
         StepPoint point{};
         point.position = particle.getPosition();
@@ -51,27 +165,24 @@ namespace {
         particle.setInteractionLengthRemaining(length, process);
     }
 
-    void stepParticle(
-        std::unique_ptr<Particle> &particle,
-        const Object *detector,
-        const Object *world,
-        const Quantity &targetTime,
-        SpawnQueue &spawned
-    ) {
+    // Set up the track for particle; returns false if there is nothing to step (no visit is recorded then)
+    bool beginTrack(Track &track, std::unique_ptr<Particle> &particle, const Object *world, const Quantity &targetTime) {
         if (!particle) {
-            return;
+            return false;
         }
-
         if (world == nullptr) {
             throw std::runtime_error("Active world is not available for particle stepping");
         }
 
         const auto initialTime = particle->getTime();
-        auto remainingTime = targetTime - initialTime;
-        if (!std::isfinite(remainingTime.value) || remainingTime.value < 0.0) {
-            remainingTime.value = 0.0;
+        track.particle = &particle;
+        track.remainingTime = targetTime - initialTime;
+        if (!std::isfinite(track.remainingTime.value) || track.remainingTime.value < 0.0) {
+            track.remainingTime.value = 0.0;
         }
-        const Object *currentMedium = step_utilities::resolveContainingMedium(world, particle->getPosition());
+        track.currentMedium = step_utilities::resolveContainingMedium(world, particle->getPosition());
+        track.steps = 0;
+        track.watchdog.emplace(initialTime, targetTime);
 
         if (particle->getLifetime().value > 0.0 && particle->hasDecayEnergy() && !particle->hasDecayClock()) {
             if (const auto decayTime = discrete_interaction::sampleDecayTime(*particle);
@@ -79,60 +190,107 @@ namespace {
                 particle->setDecayClock(decayTime);
             }
         }
+        return true;
+    }
 
-        while (remainingTime.value > 0.0 && particle && particle->getAlive()) {
-            StepPoint preStep = buildStepPoint(*particle, currentMedium);
-            if (preStep.medium == nullptr) {
-                particle->setAlive(false);
-                break;
-            }
+    // Take one step of the track
+    TrackStatus advanceTrack(
+        Track &track,
+        DetectorLogs &detectorLogs,
+        const Object *detector,
+        const Object *world,
+        SpawnQueue &spawned,
+        StepCounters &counters
+    ) {
+        auto &particle = *track.particle;
+        auto &remainingTime = track.remainingTime;
+        if (!(remainingTime.value > 0.0 && particle && particle->getAlive())) {
+            return TrackStatus::Finished;
+        }
+        TRACE_SCOPE("advanceTrack");
 
-            ensureInteractionSample(*particle, preStep.medium);
+        StepPoint preStep = buildStepPoint(*particle, track.currentMedium);
+        if (preStep.medium == nullptr) {
+            particle->setAlive(false);
+            return TrackStatus::Finished;
+        }
 
-            const auto event = determineStepEvent(*particle, remainingTime, preStep, world);
+        ensureInteractionSample(*particle, preStep.medium);
 
-            if (event.dt.value <= 0.0) {
-                remainingTime.value = 0.0;
-                break;
+        // Reflective particle confined to a convex cell: the rest of the interval is one closed-form update
+        if (const auto bounces = convex_bounces::advance(*particle, preStep.medium, remainingTime)) {
+            counters.recordStep(static_cast<std::size_t>(StepLimiter::Time), remainingTime.value, preStep.medium);
+            counters.analyticBounces += *bounces;
+            ++track.steps;
+            if (!step_utilities::updatePostEventState(particle, detectorLogs, detector, preStep.medium, preStep.medium)) {
+                return TrackStatus::Removed;
             }
+            remainingTime.value = 0.0;
+            return TrackStatus::Finished;
+        }
 
-            const auto travelledDistance = event.displacement.length();
+        const auto event = determineStepEvent(*particle, remainingTime, preStep, world);
 
-            particle->consumeInteractionLength(travelledDistance);
-            if (particle->hasDecayClock()) {
-                particle->consumeDecayTime(event.dt);
-            }
+        if (event.dt.value <= 0.0) {
+            remainingTime.value = 0.0;
+            return TrackStatus::Finished;
+        }
 
-            moveParticle(*particle, event.dt, event.displacement);
+        counters.recordStep(static_cast<std::size_t>(event.limiter), event.dt.value, preStep.medium);
+        ++track.steps;
 
-            if (!particle || !particle->getAlive()) {
-                return;
-            }
+        const auto travelledDistance = event.displacement.length();
 
-            if (event.limiter == StepLimiter::Boundary) {
-                processBoundaryResponse(*particle, event.boundaryEvent, event.displacement, travelledDistance);
-            }
-            else if (event.limiter == StepLimiter::Interaction || event.limiter == StepLimiter::Decay) {
-                processDiscreteLimiterEvent(particle, event.limiter, world, spawned);
-            }
+        particle->consumeInteractionLength(travelledDistance);
+        if (particle->hasDecayClock()) {
+            particle->consumeDecayTime(event.dt);
+        }
 
-            if (!particle || !particle->getAlive()) {
-                return;
-            }
+        moveParticle(*particle, event.dt, event.displacement);
 
-            const Object *mediumAfterStep = event.postStep.medium;
-            if (mediumAfterStep == nullptr) {
-                mediumAfterStep = step_utilities::resolveContainingMedium(world, particle->getPosition());
-            }
+        if (!particle || !particle->getAlive()) {
+            return TrackStatus::Removed;
+        }
 
-            if (!step_utilities::updatePostEventState(particle, detector, preStep.medium, mediumAfterStep)) {
-                return;
-            }
+        const Object *mediumAfterStep = event.postStep.medium;
+        if (event.limiter == StepLimiter::Boundary) {
+            mediumAfterStep = processBoundaryResponse(*particle, event.boundaryEvent, event.displacement, travelledDistance);
+        }
+        else if (event.limiter == StepLimiter::Interaction || event.limiter == StepLimiter::Decay) {
+            const auto spawnedBefore = spawned.size();
+            processDiscreteLimiterEvent(particle, event.limiter, world, spawned);
+            counters.recordSecondaries(spawned.size() - spawnedBefore);
+        }
 
-            remainingTime -= event.dt;
-            currentMedium = mediumAfterStep;
+        if (!particle || !particle->getAlive()) {
+            return TrackStatus::Removed;
         }
 
+        if (mediumAfterStep == nullptr) {
+            mediumAfterStep = step_utilities::resolveContainingMedium(world, particle->getPosition());
+        }
+
+        if (!step_utilities::updatePostEventState(particle, detectorLogs, detector, preStep.medium, mediumAfterStep)) {
+            return TrackStatus::Removed;
+        }
+
+        remainingTime -= event.dt;
+        track.currentMedium = mediumAfterStep;
+
+        if (track.watchdog->recordStep(*particle, event)) {
+            if (!step_watchdog::applyAction(*particle, *track.watchdog, track.currentMedium)) {
+                return TrackStatus::Removed;
+            }
+            if (step_watchdog::settings().action == step_watchdog::Action::Nudge) {
+                track.currentMedium = step_utilities::resolveContainingMedium(world, particle->getPosition());
+            }
+        }
+        return remainingTime.value > 0.0 && particle && particle->getAlive() ? TrackStatus::Running : TrackStatus::Finished;
+    }
+
+    // End-of-interval checks once the step loop has ended
+    void finishTrack(const Track &track, const Object *world, const Quantity &targetTime) {
+        auto &particle = *track.particle;
         if (!particle) {
             return;
         }
@@ -146,7 +304,116 @@ namespace {
         }
     }
 
-void stepAll(const Object *detector, const Quantity &dt) {
+    void stepParticle(
+        std::unique_ptr<Particle> &particle,
+        DetectorLogs &detectorLogs,
+        const Object *detector,
+        const Object *world,
+        const Quantity &targetTime,
+        SpawnQueue &spawned
+    ) {
+        if (!particle) {
+            return;
+        }
+        TRACE_SCOPE("stepParticle");
+
+        Track track{};
+        if (!beginTrack(track, particle, world, targetTime)) {
+            return;
+        }
+        auto &counters = StepStatistics::local();
+        VisitRecorder visit{counters, track.steps};
+
+        auto status = TrackStatus::Running;
+        while (status == TrackStatus::Running) {
+            status = advanceTrack(track, detectorLogs, detector, world, spawned, counters);
+        }
+        if (status == TrackStatus::Finished) {
+            finishTrack(track, world, targetTime);
+        }
+    }
+
+    // Step particles[begin, end) with up to config::program::interleavedTracks tracks in flight, taking one step of
+    // each in turn. A track's particle and medium are prefetched when it suspends and the medium's children and
+    // material one turn before it resumes, so the misses of one track overlap the steps of the others
+    void stepInterleaved(
+        std::vector<std::unique_ptr<Particle> > &particles,
+        const std::size_t begin,
+        const std::size_t end,
+        DetectorLogs &detectorLogs,
+        const Object *detector,
+        const Object *world,
+        const Quantity &targetTime,
+        SpawnQueue &spawned
+    ) {
+        constexpr std::size_t width = config::program::interleavedTracks;
+        if constexpr (width <= 1) {
+            for (std::size_t index = begin; index < end; ++index) {
+                stepParticle(particles[index], detectorLogs, detector, world, targetTime, spawned);
+            }
+            return;
+        } else {
+            TRACE_SCOPE("stepInterleaved");
+            auto &counters = StepStatistics::local();
+            std::array<Track, width> tracks{};
+            std::array<bool, width> active{};
+            const InFlightVisits<width> inFlightVisits{counters, tracks, active};
+
+            // Admissions run width particles ahead of their prefetch; the pointer array itself is read sequentially
+            for (std::size_t index = begin; index < std::min(end, begin + width); ++index) {
+                prefetchParticle(particles[index].get());
+            }
+            std::size_t next = begin;
+            const auto admit = [&](Track &track) {
+                while (next < end) {
+                    auto &particle = particles[next];
+                    if (next + width < end) {
+                        prefetchParticle(particles[next + width].get());
+                    }
+                    ++next;
+                    if (beginTrack(track, particle, world, targetTime)) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            std::size_t inFlight = 0;
+            for (std::size_t slot = 0; slot < width; ++slot) {
+                active[slot] = admit(tracks[slot]);
+                inFlight += active[slot] ? 1 : 0;
+            }
+
+            while (inFlight > 0) {
+                for (std::size_t slot = 0; slot < width; ++slot) {
+                    if (!active[slot]) {
+                        continue;
+                    }
+                    if (const std::size_t following = (slot + 1) % width; active[following]) {
+                        prefetchMediumContents(tracks[following]);
+                    }
+
+                    auto &track = tracks[slot];
+                    const auto status = advanceTrack(track, detectorLogs, detector, world, spawned, counters);
+                    if (status == TrackStatus::Running) {
+                        prefetchTrack(track);
+                        continue;
+                    }
+                    counters.recordVisit(track.steps);
+                    active[slot] = false;
+                    if (status == TrackStatus::Finished) {
+                        finishTrack(track, world, targetTime);
+                    }
+
+                    active[slot] = admit(track);
+                    inFlight -= active[slot] ? 0 : 1;
+                }
+            }
+        }
+    }
+
+void stepAll(SimulationContext &context, const Object *detector, const Quantity &dt) {
+    TRACE_SCOPE("stepAll");
     if (!Unit::hasTimeDimension(dt.unit)) {
         throw std::invalid_argument("Time step must have time dimensions");
     }
@@ -154,42 +421,49 @@ void stepAll(const Object *detector, const Quantity &dt) {
         throw std::invalid_argument("Time step must be finite and non-negative");
         }
 
-        const auto currentTime = simulation_clock::currentTime();
+        const auto currentTime = context.clock().currentTime();
         const auto targetTime = currentTime + dt;
-        const auto *world = g_objectManager.getActiveWorld("step all particles");
+        const auto *world = context.world("step all particles");
+        auto &statistics = context.statistics();
+        auto &detectorLogs = context.detectorLogs();
 
         if (world == nullptr) {
             throw std::runtime_error("Active world is not available while stepping particles");
         }
 
         step_utilities::validateDetector(detector, world);
+        const random_manager::ScopedThreadMasterSeed seedScope(context.randomSeed()); // Serial spawn stepping
 
+    const auto parallelStart = std::chrono::steady_clock::now();
     std::vector<std::unique_ptr<Particle>> spawnedParticles;
+    memory_accounting::TrackedBytes spawnMemory{memory_accounting::Category::SpawnBuffers};
+    constexpr std::size_t k_pointerBytes = sizeof(std::unique_ptr<Particle>);
 
     {
-        const auto particleHandle = g_particleManager.acquireReadHandle();
+        const auto particleHandle = context.particles().acquireReadHandle();
         auto &particles = particleHandle.particles();
+        TRACE_COUNTER("particles", particles.size());
         if (const auto particleCount = particles.size(); particleCount > 0) {
             std::vector<SpawnQueue> spawnBuffers;
 
-            // Ignore warnings about threads; they change based on maxWorkerThreads being 0 OR >= 1
-                constexpr auto requestedThreads = config::program::maxWorkerThreads;
-                const auto hardwareThreads = std::max<unsigned>(1, std::thread::hardware_concurrency());
-                if (requestedThreads > hardwareThreads) {
-                    throw std::runtime_error("Requested worker thread count exceeds hardware_concurrency");
-            }
-            const std::size_t availableThreads = requestedThreads > 0 ? requestedThreads : hardwareThreads;
-            const std::size_t workerCount = std::min<std::size_t>(availableThreads, particleCount);
+            const std::size_t workerCount = std::min<std::size_t>(context.workerThreads(), particleCount);
+            const std::size_t streamBase = context.randomStreamBase();
+            const auto seed = context.randomSeed();
 
             spawnBuffers.resize(workerCount);
+            std::vector<std::chrono::steady_clock::duration> busyTimes(workerCount);
 
-            const auto runChunk = [&, targetTime](const std::size_t begin, const std::size_t end, const std::size_t threadIndex) {
+            const auto runChunk = [&, targetTime, streamBase, seed](const std::size_t begin, const std::size_t end, const std::size_t threadIndex) {
+                const auto chunkStart = std::chrono::steady_clock::now();
+                const random_manager::ScopedThreadMasterSeed seedScope(seed);
                 const auto previousIndex = random_manager::getThreadStreamIndex();
-                random_manager::setThreadStreamIndex(threadIndex);
-                for (std::size_t index = begin; index < end; ++index) {
-                    stepParticle(particles[index], detector, world, targetTime, spawnBuffers[threadIndex]);
-                }
+                random_manager::setThreadStreamIndex(streamBase + threadIndex);
+                const allocation_tracking::AllocationScope allocationScope;
+                stepInterleaved(particles, begin, end, detectorLogs, detector, world, targetTime, spawnBuffers[threadIndex]);
+                recordAllocations(allocationScope);
                 random_manager::setThreadStreamIndex(previousIndex);
+                busyTimes[threadIndex] = std::chrono::steady_clock::now() - chunkStart;
+                statistics.flushLocal();
             };
 
                 std::vector<std::thread> workers;
@@ -216,18 +490,39 @@ void stepAll(const Object *detector, const Quantity &dt) {
                 }
             }
 
+            // Idle is worker capacity over the phase so far minus time spent stepping (load imbalance + thread start-up)
+            const auto joined = std::chrono::steady_clock::now() - parallelStart;
+            std::chrono::steady_clock::duration busy{};
+            for (const auto &time : busyTimes) {
+                busy += time;
+            }
+            const auto toNanoseconds = [](const std::chrono::steady_clock::duration duration) {
+                return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+            };
+            auto &counters = StepStatistics::local();
+            counters.workerBusyNanoseconds += toNanoseconds(busy);
+            counters.workerIdleNanoseconds += toNanoseconds(std::max(joined * static_cast<long>(workerCount) - busy, joined.zero()));
+
+            std::size_t bufferCapacity = 0;
             for (auto &buffer : spawnBuffers) {
                 for (auto &p : buffer) {
                     if (p) {
                         spawnedParticles.push_back(std::move(p));
                     }
                 }
+                bufferCapacity += buffer.capacity();
                 buffer.clear();
             }
+            spawnMemory.resize((bufferCapacity + spawnedParticles.capacity()) * k_pointerBytes);
         }
     }
 
+    const auto spawnStart = std::chrono::steady_clock::now();
+    statistics.recordPhase(StepPhase::ParallelStepping, spawnStart - parallelStart);
+
+    TRACE_COUNTER("spawned", spawnedParticles.size());
     if (!spawnedParticles.empty()) {
+        TRACE_SCOPE("stepAll/spawnProcessing");
         std::vector<std::unique_ptr<Particle>> survivors;
         std::vector<std::unique_ptr<Particle>> pending;
         pending.swap(spawnedParticles);
@@ -240,7 +535,9 @@ void stepAll(const Object *detector, const Quantity &dt) {
                 if (!particle) {
                     continue;
                 }
-                stepParticle(particle, detector, world, targetTime, newSpawns);
+                const allocation_tracking::AllocationScope allocationScope;
+                stepParticle(particle, detectorLogs, detector, world, targetTime, newSpawns);
+                recordAllocations(allocationScope);
 
                 if (particle && particle->getAlive()) {
                     particle->synchroniseTime(targetTime);
@@ -254,23 +551,69 @@ void stepAll(const Object *detector, const Quantity &dt) {
                 }
             }
 
+            spawnMemory.resize(
+                (pending.capacity() + nextPending.capacity() + newSpawns.capacity() + survivors.capacity()) * k_pointerBytes
+            );
             pending.swap(nextPending);
         }
 
         if (!survivors.empty()) {
-            g_particleManager.addParticles(std::move(survivors));
+            context.particles().addParticles(std::move(survivors));
         }
     }
 
-    simulation_clock::setTime(targetTime);
+    const auto clockStart = std::chrono::steady_clock::now();
+    statistics.recordPhase(StepPhase::SpawnProcessing, clockStart - spawnStart);
+
+    context.clock().setTime(targetTime);
 
-    g_particleManager.withExclusiveAccess([](auto &particles) {
+    const auto purgeStart = std::chrono::steady_clock::now();
+    statistics.recordPhase(StepPhase::ClockUpdate, purgeStart - clockStart);
+
+    std::size_t particlesAlive = 0;
+    context.particles().withExclusiveAccess([&particlesAlive, &context](auto &particles) {
+        TRACE_SCOPE("stepAll/purge");
         step_utilities::purgeDeadParticles(particles);
+        context.spill().balance(particles);
+        particlesAlive = particles.size();
     });
+
+    statistics.recordPhase(StepPhase::Purge, std::chrono::steady_clock::now() - purgeStart);
+
+    if (auto *readout = context.readout(); readout != nullptr && readout->due(targetTime)) {
+        const auto particleHandle = context.particles().acquireReadHandle();
+        readout->sample(particleHandle.particles(), targetTime, context.workerThreads());
+    }
+    ++StepStatistics::local().stepAllCalls;
+    statistics.flushLocal(); // Counters from the serial spawn loop
+    statistics.finishStepAll();
+    if (context.isGlobal()) {
+        statistics.publishMetrics(particlesAlive, targetTime.value); // One registry per process
+    }
 }
 } // namespace
 
-void stepUntilTime(const Object *detector, const Quantity &targetTime, const Quantity &dt) {
+void setWorkerThreadCount(const std::size_t count) {
+    if (const auto hardwareThreads = hardwareThreadCount(); count > hardwareThreads) {
+        throw std::invalid_argument(std::format(
+            "Requested worker thread count {} exceeds hardware_concurrency ({})",
+            count,
+            hardwareThreads
+        ));
+    }
+    g_workerThreadCount.store(count, std::memory_order_relaxed);
+}
+
+std::size_t workerThreadCount() {
+    const auto requestedThreads = g_workerThreadCount.load(std::memory_order_relaxed);
+    const auto hardwareThreads = hardwareThreadCount();
+    if (requestedThreads > hardwareThreads) {
+        throw std::runtime_error("Requested worker thread count exceeds hardware_concurrency");
+    }
+    return requestedThreads > 0 ? requestedThreads : hardwareThreads;
+}
+
+void stepUntilTime(SimulationContext &context, const Object *detector, const Quantity &targetTime, const Quantity &dt) {
     if (!Unit::hasTimeDimension(targetTime.unit)) {
         throw std::invalid_argument("Target time must have time dimensions");
     }
@@ -284,12 +627,15 @@ void stepUntilTime(const Object *detector, const Quantity &targetTime, const Qua
         throw std::invalid_argument("Time step must be finite and positive for stepUntilTime");
     }
 
+    cacheVolumeFields(context.world("cache volume fields"), context.backgroundField());
+
     const double tolerance = std::max(
         std::abs(targetTime.value) * config::program::timeSynchronisationTolerance,
         std::numeric_limits<double>::epsilon()
     );
 
-    auto current = simulation_clock::currentTime();
+    auto current = context.clock().currentTime();
+    step_controller::Controller controller(dt.value);
 
     while (current.value + tolerance < targetTime.value) {
         auto remaining = targetTime - current;
@@ -298,16 +644,21 @@ void stepUntilTime(const Object *detector, const Quantity &targetTime, const Qua
             break;
         }
 
-        if (remaining.value > dt.value) {
-            remaining = dt;
+        if (const auto interval = controller.timeStep(); remaining.value > interval.value) {
+            remaining = interval;
         }
 
-        stepAll(detector, remaining);
-        current = simulation_clock::currentTime();
+        stepAll(context, detector, remaining);
+        controller.update(context.statistics().lastStepAll());
+        current = context.clock().currentTime();
     }
 }
 
-void stepUntilEmpty(const Object *detector, const Quantity &dt) {
+void stepUntilTime(const Object *detector, const Quantity &targetTime, const Quantity &dt) {
+    stepUntilTime(SimulationContext::global(), detector, targetTime, dt);
+}
+
+void stepUntilEmpty(SimulationContext &context, const Object *detector, const Quantity &dt) {
     if (!Unit::hasTimeDimension(dt.unit)) {
         throw std::invalid_argument("Time step must have time dimensions");
     }
@@ -315,7 +666,15 @@ void stepUntilEmpty(const Object *detector, const Quantity &dt) {
         throw std::invalid_argument("Time step must be finite and positive for stepUntilEmpty");
     }
 
-    while (!g_particleManager.empty()) {
-        stepAll(detector, dt);
+    cacheVolumeFields(context.world("cache volume fields"), context.backgroundField());
+
+    step_controller::Controller controller(dt.value);
+    while (!context.particles().empty() || !context.spill().empty()) {
+        stepAll(context, detector, controller.timeStep());
+        controller.update(context.statistics().lastStepAll());
     }
 }
+
+void stepUntilEmpty(const Object *detector, const Quantity &dt) {
+    stepUntilEmpty(SimulationContext::global(), detector, dt);
+}
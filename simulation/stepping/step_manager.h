@@ -13,18 +13,44 @@
 #ifndef PHYSICS_SIMULATION_PROGRAM_STEP_MANAGER_H
 #define PHYSICS_SIMULATION_PROGRAM_STEP_MANAGER_H
 
+#include <cstddef>
+
 #include "core/quantities/quantity.h"
 #include "objects/object.h"
 
-// Advance simulation until the global clock reaches targetTime (inclusive, within tolerance)
+class SimulationContext;
+
+// Advance simulation until the context's clock reaches targetTime (inclusive, within tolerance)
+//
+// The form without a context steps SimulationContext::global(); with step_controller enabled dt is only the first
+// stepAll interval
+void stepUntilTime(
+    SimulationContext& context,
+    const Object* detector,
+    const Quantity& targetTime,
+    const Quantity& dt = quantityTable().at("time step"));
 void stepUntilTime(
     const Object* detector,
     const Quantity& targetTime,
     const Quantity& dt = quantityTable().at("time step"));
 
-// Advance simulation until all particles have been removed
+// Advance simulation until all of the context's particles, spilled ones included, have been removed
+//
+// The form without a context steps SimulationContext::global(); with step_controller enabled dt is only the first
+// stepAll interval
+void stepUntilEmpty(
+    SimulationContext& context,
+    const Object* detector,
+    const Quantity& dt = quantityTable().at("time step"));
 void stepUntilEmpty(
     const Object* detector,
     const Quantity& dt = quantityTable().at("time step"));
 
+// Set the number of worker threads used by subsequent steps; 0 -> hardware_concurrency
+// Defaults to config::program::maxWorkerThreads; throws std::invalid_argument if count exceeds hardware_concurrency
+void setWorkerThreadCount(std::size_t count);
+
+// Effective worker thread count (never 0)
+[[nodiscard]] std::size_t workerThreadCount();
+
 #endif //PHYSICS_SIMULATION_PROGRAM_STEP_MANAGER_H
@@ -0,0 +1,302 @@
+//
+// Physics Simulation Program
+// File: step_statistics.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of step_statistics.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/stepping/step_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <string>
+
+#include "core/tracing/metrics.h"
+#include "objects/object.h"
+
+namespace {
+    constexpr std::array<const char*, k_stepLimiterCount> k_limiterNames{"time", "boundary", "decay", "interaction"};
+    constexpr double k_fallbackWarningFraction = 0.01;  // Of boundary steps
+    constexpr std::uint64_t k_stepsPerVisitWarning = 10000;
+
+    template<std::size_t Size>
+    void mergeArray(std::array<std::uint64_t, Size>& into, const std::array<std::uint64_t, Size>& from) noexcept {
+        for (std::size_t i = 0; i < Size; ++i) {
+            into[i] += from[i];
+        }
+    }
+
+    template<std::size_t Size>
+    std::uint64_t sum(const std::array<std::uint64_t, Size>& values) noexcept {
+        std::uint64_t total = 0;
+        for (const auto value : values) {
+            total += value;
+        }
+        return total;
+    }
+
+    double percent(const std::uint64_t part, const std::uint64_t whole) noexcept {
+        return whole > 0 ? 100.0 * static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+    }
+
+    void printLimiterRow(std::ostream& stream, const std::string& label, const std::array<std::uint64_t, k_stepLimiterCount>& steps) {
+        const auto total = sum(steps);
+        stream << std::format(
+            "  {:<32} {:>14} {:>9.2f}% {:>9.2f}% {:>9.2f}% {:>9.2f}%\n",
+            label,
+            total,
+            percent(steps[0], total),
+            percent(steps[1], total),
+            percent(steps[2], total),
+            percent(steps[3], total)
+        );
+    }
+
+    // Histogram bars scaled to the largest bucket, skipping empty buckets at either end
+    template<std::size_t Size, typename Label>
+    void printHistogram(std::ostream& stream, const std::array<std::uint64_t, Size>& counts, Label&& label) {
+        constexpr std::size_t barWidth = 40;
+        const auto first = std::ranges::find_if(counts, [](const std::uint64_t count) { return count != 0; });
+        if (first == counts.end()) {
+            stream << "  (empty)\n";
+            return;
+        }
+        const auto last = std::ranges::find_if(counts.rbegin(), counts.rend(), [](const std::uint64_t count) { return count != 0; });
+        const auto peak = *std::ranges::max_element(counts);
+        const auto total = sum(counts);
+        const auto begin = static_cast<std::size_t>(first - counts.begin());
+        const auto end = Size - static_cast<std::size_t>(last - counts.rbegin());
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto bar = static_cast<std::size_t>(static_cast<double>(barWidth) * static_cast<double>(counts[i]) / static_cast<double>(peak));
+            stream << std::format("  {:<16} {:>14} {:>7.2f}% {}\n", label(i), counts[i], percent(counts[i], total), std::string(bar, '#'));
+        }
+    }
+
+    std::string mediumLabel(const Object* medium) {
+        if (medium == nullptr) {
+            return "(none)";
+        }
+        return std::format("{} ({})", medium->getName(), medium->getMaterial());
+    }
+} // namespace
+
+std::size_t timeStepBucket(const double seconds) noexcept {
+    if (!(seconds > 0.0)) {
+        return 0;
+    }
+    const auto decade = static_cast<long>(std::floor(std::log10(seconds))) - k_timeStepMinExponent;
+    return static_cast<std::size_t>(std::clamp<long>(decade, 0, static_cast<long>(k_timeStepBuckets) - 1));
+}
+
+void StepCounters::merge(const StepCounters& other) noexcept {
+    this->particleVisits += other.particleVisits;
+    this->steps += other.steps;
+    mergeArray(this->stepsByLimiter, other.stepsByLimiter);
+    this->secondaries += other.secondaries;
+    this->stepAllCalls += other.stepAllCalls;
+    mergeArray(this->phaseNanoseconds, other.phaseNanoseconds);
+    this->workerBusyNanoseconds += other.workerBusyNanoseconds;
+    this->workerIdleNanoseconds += other.workerIdleNanoseconds;
+    this->detectorLockWaitNanoseconds += other.detectorLockWaitNanoseconds;
+    this->allocations += other.allocations;
+    this->allocatedBytes += other.allocatedBytes;
+    this->boundaryFallbacks += other.boundaryFallbacks;
+    this->analyticBounces += other.analyticBounces;
+    this->maxStepsPerVisit = std::max(this->maxStepsPerVisit, other.maxStepsPerVisit);
+    this->watchdogTrips += other.watchdogTrips;
+    mergeArray(this->stepsPerVisit, other.stepsPerVisit);
+    mergeArray(this->timeSteps, other.timeSteps);
+    mergeArray(this->secondariesPerDiscreteStep, other.secondariesPerDiscreteStep);
+    for (const auto& slot : other.limitersByMedium) {
+        if (slot.medium == nullptr) {
+            break; // Slots are claimed in order
+        }
+        for (std::size_t limiter = 0; limiter < k_stepLimiterCount; ++limiter) {
+            if (slot.steps[limiter] != 0) {
+                this->addMediumLimiter(slot.medium, limiter, slot.steps[limiter]);
+            }
+        }
+    }
+    mergeArray(this->limitersOtherMedia, other.limitersOtherMedia);
+}
+
+StepCounters& StepStatistics::local() noexcept {
+    thread_local StepCounters counters;
+    return counters;
+}
+
+void StepStatistics::flushLocal() {
+    auto& counters = local();
+    {
+        std::scoped_lock lock(this->m_mutex);
+        this->m_pending.merge(counters);
+    }
+    counters = StepCounters{};
+}
+
+void StepStatistics::finishStepAll() {
+    std::scoped_lock lock(this->m_mutex);
+    this->m_totals.merge(this->m_pending);
+    this->m_lastStepAll = this->m_pending;
+    this->m_pending = StepCounters{};
+}
+
+void StepStatistics::recordPhase(const StepPhase phase, const std::chrono::steady_clock::duration duration) {
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::scoped_lock lock(this->m_mutex);
+    this->m_pending.phaseNanoseconds[static_cast<std::size_t>(phase)] += static_cast<std::uint64_t>(nanoseconds);
+}
+
+StepCounters StepStatistics::totals() const {
+    std::scoped_lock lock(this->m_mutex);
+    auto totals = this->m_totals;
+    totals.merge(this->m_pending);
+    return totals;
+}
+
+StepCounters StepStatistics::lastStepAll() const {
+    std::scoped_lock lock(this->m_mutex);
+    return this->m_lastStepAll;
+}
+
+void StepStatistics::printReport(std::ostream& stream) const {
+    const auto counters = this->totals();
+
+    stream << std::format(
+        "Steps: {} over {} particle visits in {} stepAll calls ({} secondaries)\n",
+        counters.steps,
+        counters.particleVisits,
+        counters.stepAllCalls,
+        counters.secondaries
+    );
+
+    stream << std::format(
+        "\nLimiter mix\n  {:<32} {:>14} {:>10} {:>10} {:>10} {:>10}\n",
+        "medium", "steps", k_limiterNames[0], k_limiterNames[1], k_limiterNames[2], k_limiterNames[3]
+    );
+    printLimiterRow(stream, "all", counters.stepsByLimiter);
+    for (const auto& slot : counters.limitersByMedium) {
+        if (slot.medium != nullptr) {
+            printLimiterRow(stream, mediumLabel(slot.medium), slot.steps);
+        }
+    }
+    if (sum(counters.limitersOtherMedia) > 0) {
+        printLimiterRow(stream, "(other media)", counters.limitersOtherMedia);
+    }
+
+    stream << "\nSteps per particle per stepAll\n";
+    printHistogram(stream, counters.stepsPerVisit, [](const std::size_t bucket) {
+        if (bucket <= 1) {
+            return std::format("{}", bucket);
+        }
+        if (bucket + 1 == k_stepsPerVisitBuckets) {
+            return std::format(">= {}", std::uint64_t{1} << (bucket - 1));
+        }
+        return std::format("{}-{}", std::uint64_t{1} << (bucket - 1), (std::uint64_t{1} << bucket) - 1);
+    });
+
+    stream << "\nTime step (s)\n";
+    printHistogram(stream, counters.timeSteps, [](const std::size_t bucket) {
+        const auto exponent = static_cast<int>(bucket) + k_timeStepMinExponent;
+        if (bucket == 0) {
+            return std::format("< 1e{}", exponent + 1);
+        }
+        if (bucket + 1 == k_timeStepBuckets) {
+            return std::format(">= 1e{}", exponent);
+        }
+        return std::format("1e{}", exponent);
+    });
+
+    stream << "\nSecondaries per decay/interaction step\n";
+    printHistogram(stream, counters.secondariesPerDiscreteStep, [](const std::size_t bucket) {
+        return bucket + 1 == k_secondaryBuckets ? std::format(">= {}", bucket) : std::format("{}", bucket);
+    });
+
+    const auto boundarySteps = counters.stepsByLimiter[1];
+    stream << std::format(
+        "\nBoundary fallbacks: {} ({:.3f}% of boundary steps)\nWall bounces applied in closed form: {}\n"
+        "Most steps by one particle in one stepAll: {}\nWatchdog trips: {}\n",
+        counters.boundaryFallbacks,
+        percent(counters.boundaryFallbacks, boundarySteps),
+        counters.analyticBounces,
+        counters.maxStepsPerVisit,
+        counters.watchdogTrips
+    );
+
+    if (boundarySteps > 0
+        && static_cast<double>(counters.boundaryFallbacks) > k_fallbackWarningFraction * static_cast<double>(boundarySteps)) {
+        stream << "Warning: frequent boundary fallbacks; check for coincident or overlapping surfaces and the geometry tolerance\n";
+    }
+    if (counters.maxStepsPerVisit >= k_stepsPerVisitWarning) {
+        stream << std::format(
+            "Warning: a particle took {} or more steps in one stepAll; check for particles trapped on a boundary\n",
+            k_stepsPerVisitWarning
+        );
+    }
+}
+
+void StepStatistics::publishMetrics(const std::size_t particlesAlive, const double simulationSeconds) const {
+    // Registered once; the references stay valid for the whole run
+    struct RunMetrics {
+        metrics::Metric& particlesAlive = metrics::metric(
+            "simulation_particles_alive", "Particles alive after the last stepAll", metrics::Type::Gauge);
+        metrics::Metric& simulationTime = metrics::metric(
+            "simulation_time_seconds", "Simulation clock after the last stepAll", metrics::Type::Gauge);
+        metrics::Metric& stepsPerSecond = metrics::metric(
+            "simulation_steps_per_second", "Steps per wall-clock second over the last stepAll", metrics::Type::Gauge);
+        metrics::Metric& spawnQueueDepth = metrics::metric(
+            "simulation_spawn_queue_depth", "Secondaries queued for serial stepping in the last stepAll", metrics::Type::Gauge);
+        metrics::Metric& stepAllCalls = metrics::metric(
+            "simulation_step_all_total", "stepAll calls", metrics::Type::Counter);
+        metrics::Metric& particleVisits = metrics::metric(
+            "simulation_particle_visits_total", "Particles stepped over a stepAll interval", metrics::Type::Counter);
+        metrics::Metric& secondaries = metrics::metric(
+            "simulation_secondaries_total", "Particles spawned by discrete events", metrics::Type::Counter);
+        metrics::Metric& boundaryFallbacks = metrics::metric(
+            "simulation_boundary_fallbacks_total", "Boundary steps trimmed because no intersection was found", metrics::Type::Counter);
+        metrics::Metric& watchdogTrips = metrics::metric(
+            "simulation_watchdog_trips_total", "Particles flagged by the step watchdog", metrics::Type::Counter);
+        std::array<metrics::Metric*, k_stepLimiterCount> steps{};
+
+        RunMetrics() {
+            for (std::size_t i = 0; i < k_stepLimiterCount; ++i) {
+                this->steps[i] = &metrics::metric(
+                    "simulation_steps_total", "Accepted steps by limiter", metrics::Type::Counter,
+                    metrics::label("limiter", k_limiterNames[i]));
+            }
+        }
+    };
+    static RunMetrics runMetrics;
+
+    // Counters take the last stepAll's counts as increments, so reset() never makes them go backwards
+    const auto last = this->lastStepAll();
+    const auto wallNanoseconds = sum(last.phaseNanoseconds);
+
+    runMetrics.particlesAlive.set(static_cast<double>(particlesAlive));
+    runMetrics.simulationTime.set(simulationSeconds);
+    runMetrics.stepsPerSecond.set(
+        wallNanoseconds > 0 ? static_cast<double>(last.steps) * 1e9 / static_cast<double>(wallNanoseconds) : 0.0);
+    runMetrics.spawnQueueDepth.set(static_cast<double>(last.secondaries));
+    runMetrics.stepAllCalls.add(static_cast<double>(last.stepAllCalls));
+    runMetrics.particleVisits.add(static_cast<double>(last.particleVisits));
+    runMetrics.secondaries.add(static_cast<double>(last.secondaries));
+    runMetrics.boundaryFallbacks.add(static_cast<double>(last.boundaryFallbacks));
+    runMetrics.watchdogTrips.add(static_cast<double>(last.watchdogTrips));
+    for (std::size_t i = 0; i < k_stepLimiterCount; ++i) {
+        runMetrics.steps[i]->add(static_cast<double>(last.stepsByLimiter[i]));
+    }
+}
+
+void StepStatistics::reset() {
+    std::scoped_lock lock(this->m_mutex);
+    this->m_pending = StepCounters{};
+    this->m_lastStepAll = StepCounters{};
+    this->m_totals = StepCounters{};
+    local() = StepCounters{};
+}
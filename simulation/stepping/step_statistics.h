@@ -0,0 +1,201 @@
+//
+// Physics Simulation Program
+// File: step_statistics.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Describes lightweight counters, histograms and phase timers collected while stepping
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_STEP_STATISTICS_H
+#define PHYSICS_SIMULATION_PROGRAM_STEP_STATISTICS_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+class Object;
+
+// Number of StepLimiter values (Time, Boundary, Decay, Interaction); kept here so the header stays free of step_events.h
+inline constexpr std::size_t k_stepLimiterCount = 4;
+
+// Histogram shapes
+inline constexpr std::size_t k_stepsPerVisitBuckets = 24; // 0, 1, [2, 4), [4, 8), ...; the last bucket is open-ended
+inline constexpr std::size_t k_timeStepBuckets = 24;      // Decades of dt in seconds from 1e-24 s; both ends clamp
+inline constexpr int k_timeStepMinExponent = -24;
+inline constexpr std::size_t k_secondaryBuckets = 8;      // 0 to 6 exactly, then 7 or more
+inline constexpr std::size_t k_maxTrackedMedia = 16;      // Media with their own limiter mix; the rest are pooled
+
+// Bucket of a steps-per-visit count: 0 for 0, otherwise the bit width (1 -> 1, 2-3 -> 2, 4-7 -> 3, ...)
+[[nodiscard]] constexpr std::size_t stepsPerVisitBucket(const std::uint64_t steps) noexcept {
+    std::size_t width = 0;
+    for (auto value = steps; value != 0; value >>= 1) {
+        ++width;
+    }
+    return width < k_stepsPerVisitBuckets ? width : k_stepsPerVisitBuckets - 1;
+}
+
+// Bucket of a time step: floor(log10(dt / s)) - k_timeStepMinExponent, clamped to the histogram
+[[nodiscard]] std::size_t timeStepBucket(double seconds) noexcept;
+
+// Phases of stepAll timed on the calling thread
+enum class StepPhase : std::uint8_t {
+    ParallelStepping = 0, // Worker threads stepping the resident particles
+    SpawnProcessing,      // Serial loop stepping newly spawned secondaries
+    ClockUpdate,          // Global simulation clock update
+    Purge,                // Removal of dead particles and spill balancing under exclusive access
+    Count
+};
+
+// Steps by limiter for one medium
+struct MediumLimiterCounts {
+    const Object* medium = nullptr;                      // nullptr marks an unused slot
+    std::array<std::uint64_t, k_stepLimiterCount> steps{}; // Indexed by StepLimiter
+};
+
+// Counters accumulated per thread while stepping and merged into the totals
+struct StepCounters {
+    std::uint64_t particleVisits = 0;                                                          // Particle steppings over a stepAll interval
+    std::uint64_t steps = 0;                                                                   // Accepted steps
+    std::array<std::uint64_t, k_stepLimiterCount> stepsByLimiter{};                            // Indexed by StepLimiter
+    std::uint64_t secondaries = 0;                                                             // Particles spawned by discrete events
+    std::uint64_t stepAllCalls = 0;                                                            // stepAll invocations
+    std::array<std::uint64_t, static_cast<std::size_t>(StepPhase::Count)> phaseNanoseconds{}; // Indexed by StepPhase
+    std::uint64_t workerBusyNanoseconds = 0;                                                   // Summed over workers stepping chunks
+    std::uint64_t workerIdleNanoseconds = 0;                                                   // Workers finished but waiting for the join
+    std::uint64_t detectorLockWaitNanoseconds = 0;                                             // Summed over threads waiting on detector locks
+    std::uint64_t allocations = 0;                                                             // Heap allocations while stepping particles
+    std::uint64_t allocatedBytes = 0;                                                          // Bytes of those allocations
+    std::uint64_t boundaryFallbacks = 0;                                                       // Boundary steps trimmed because no intersection was found
+    std::uint64_t analyticBounces = 0;                                                         // Wall bounces applied in closed form (see convex_bounces.h)
+    std::uint64_t maxStepsPerVisit = 0;                                                        // Most steps taken by one particle in one stepAll
+    std::uint64_t watchdogTrips = 0;                                                           // Particles flagged by step_watchdog
+    std::array<std::uint64_t, k_stepsPerVisitBuckets> stepsPerVisit{};                         // See stepsPerVisitBucket()
+    std::array<std::uint64_t, k_timeStepBuckets> timeSteps{};                                  // See timeStepBucket()
+    std::array<std::uint64_t, k_secondaryBuckets> secondariesPerDiscreteStep{};                // Decay and interaction steps only
+    std::array<MediumLimiterCounts, k_maxTrackedMedia> limitersByMedium{};                     // First k_maxTrackedMedia media seen
+    std::array<std::uint64_t, k_stepLimiterCount> limitersOtherMedia{};                        // Media beyond k_maxTrackedMedia
+
+    // Record an accepted step: limiter index, dt in seconds and the medium it started in
+    void recordStep(std::size_t limiter, double seconds, const Object* medium) noexcept {
+        ++this->steps;
+        ++this->stepsByLimiter[limiter];
+        ++this->timeSteps[timeStepBucket(seconds)];
+        this->addMediumLimiter(medium, limiter, 1);
+    }
+
+    // Record the secondaries produced by a decay or interaction step
+    void recordSecondaries(const std::size_t count) noexcept {
+        this->secondaries += count;
+        ++this->secondariesPerDiscreteStep[count < k_secondaryBuckets ? count : k_secondaryBuckets - 1];
+    }
+
+    // Record the steps one particle took during one stepAll
+    void recordVisit(const std::uint64_t visitSteps) noexcept {
+        ++this->particleVisits;
+        ++this->stepsPerVisit[stepsPerVisitBucket(visitSteps)];
+        this->maxStepsPerVisit = visitSteps > this->maxStepsPerVisit ? visitSteps : this->maxStepsPerVisit;
+    }
+
+    // Add count steps to the medium's slot, claiming a free slot on first sight
+    void addMediumLimiter(const Object* medium, const std::size_t limiter, const std::uint64_t count) noexcept {
+        for (auto& slot : this->limitersByMedium) {
+            if (slot.medium == medium || slot.medium == nullptr) {
+                slot.medium = medium;
+                slot.steps[limiter] += count;
+                return;
+            }
+        }
+        this->limitersOtherMedia[limiter] += count;
+    }
+
+    void merge(const StepCounters& other) noexcept;
+};
+
+// StepStatistics
+//
+// Notes on initialisation:
+//   - Default-constructible with zeroed totals; a global instance g_stepStatistics is provided
+//
+// Notes on algorithms:
+//   - Hot-path counters are written to a thread-local StepCounters (no atomics or locks) and merged into the totals
+//     under a mutex once per worker chunk via flushLocal(), so the cost while stepping is a handful of increments
+//   - Phase timings are recorded directly by the thread running stepAll
+//   - Worker busy/idle time splits the parallel phase per worker: idle = workers * phase wall time - busy, so load
+//     imbalance shows up as idle time; detector lock waits are part of busy time
+//   - Allocation counts cover stepParticle calls only and stay zero unless SIMULATION_TRACK_ALLOCATIONS is defined
+//   - Histograms are fixed arrays and media are tracked in a fixed table keyed by pointer (linear search, usually
+//     hitting the first slots), so recording never allocates
+//   - Counters flushed during a stepAll collect in a pending set; finishStepAll() publishes it as lastStepAll() and
+//     merges it into the run totals
+//
+// Notes on output:
+//   - printReport() writes the limiter mix overall and per medium, the histograms and warnings for patterns that
+//     usually mean a bad configuration (frequent boundary fallbacks, particles taking thousands of steps per stepAll)
+//
+// Supported overloads / operations and functions / methods:
+//   - Thread-local access:    local()
+//   - Merge:                  flushLocal(), finishStepAll()
+//   - Phase timing:           recordPhase()
+//   - Getters:                totals(), lastStepAll()
+//   - Output:                 printReport()
+//   - Reset:                  reset()
+//   - Global instance:        g_stepStatistics
+//
+// Example usage:
+//   g_stepStatistics.reset();
+//   stepUntilEmpty(detector, Quantity(1e-13, "s"));
+//   const auto totals = g_stepStatistics.totals();
+//   std::cout << totals.steps << " steps\n";
+class StepStatistics {
+    public:
+        StepStatistics() = default;
+
+        // Thread-local counters method
+        //
+        // Counters private to the calling thread; merged into the totals by flushLocal()
+        [[nodiscard]] static StepCounters& local() noexcept;
+
+        // Merge methods
+        //
+        // flushLocal() merges and clears the calling thread's counters into the pending stepAll set; finishStepAll()
+        // closes the stepAll, publishing the pending set as lastStepAll() and adding it to the totals
+        void flushLocal();
+        void finishStepAll();
+
+        // Phase timing method
+        void recordPhase(StepPhase phase, std::chrono::steady_clock::duration duration);
+
+        // Getters
+        [[nodiscard]] StepCounters totals() const;      // Whole run, including a stepAll still in progress
+        [[nodiscard]] StepCounters lastStepAll() const; // Most recently finished stepAll
+
+        // Output methods
+        //
+        // End-of-run summary of totals(); publishMetrics() adds the last stepAll to the registry counters and sets the
+        // gauges from it (plus the live particle count and simulation time supplied by the caller) for scraping. Call it
+        // once per finishStepAll(); the counters are unaffected by reset()
+        void printReport(std::ostream& stream) const;
+        void publishMetrics(std::size_t particlesAlive, double simulationSeconds) const;
+
+        // Reset method
+        //
+        // Clears the merged totals and the calling thread's counters
+        void reset();
+
+    private:
+        mutable std::mutex m_mutex;
+        StepCounters m_pending;
+        StepCounters m_lastStepAll;
+        StepCounters m_totals;
+};
+
+inline StepStatistics g_stepStatistics;
+
+#endif //PHYSICS_SIMULATION_PROGRAM_STEP_STATISTICS_H
@@ -49,6 +49,7 @@ namespace step_utilities {
 
     bool updatePostEventState(
         std::unique_ptr<Particle> &particle,
+        DetectorLogs &detectorLogs,
         const Object *detector,
         const Object *previousMedium,
         const Object *currentMedium
@@ -57,7 +58,7 @@ namespace step_utilities {
 
         particle->pruneInteractionAndDecayProcesses();
         resetInteractionOnMediumChange(*particle, previousMedium, currentMedium);
-        return logDetectorHit(particle, detector);
+        return logDetectorHit(particle, detectorLogs, detector);
     }
 
     bool ensureParticleInsideWorld(Particle &particle, const Object *world) {
@@ -73,8 +74,8 @@ namespace step_utilities {
         return true;
     }
 
-    bool logDetectorHit(std::unique_ptr<Particle> &particle, const Object *detector) {
-        logEnergyIfInside(particle, detector);
+    bool logDetectorHit(std::unique_ptr<Particle> &particle, DetectorLogs &detectorLogs, const Object *detector) {
+        detectorLogs.logEnergyIfInside(particle, detector);
         return static_cast<bool>(particle);
     }
 
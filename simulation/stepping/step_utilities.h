@@ -17,6 +17,8 @@
 #include "objects/object.h"
 #include "particles/particle.h"
 
+class DetectorLogs;
+
 namespace step_utilities {
     // Validate detector pointers before using them inside the step loop
     void validateDetector(const Object *detector, const Object *world);
@@ -33,6 +35,7 @@ namespace step_utilities {
     // Prune expired interaction/decay timers, reset sampling when mediums change, and log detector hits
     bool updatePostEventState(
         std::unique_ptr<Particle> &particle,
+        DetectorLogs &detectorLogs,
         const Object *detector,
         const Object *previousMedium,
         const Object *currentMedium
@@ -41,8 +44,8 @@ namespace step_utilities {
     // Verify particles remain in the active world
     bool ensureParticleInsideWorld(Particle &particle, const Object *world);
 
-    // Detector bookkeeping helper
-    bool logDetectorHit(std::unique_ptr<Particle> &particle, const Object *detector);
+    // Detector bookkeeping helper; logs under detectorLogs' output root
+    bool logDetectorHit(std::unique_ptr<Particle> &particle, DetectorLogs &detectorLogs, const Object *detector);
 
     // Collection helpers
     void purgeDeadParticles(std::vector<std::unique_ptr<Particle> > &particles);
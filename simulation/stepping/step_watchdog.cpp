@@ -0,0 +1,198 @@
+//
+// Physics Simulation Program
+// File: step_watchdog.cpp
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Implementation of step_watchdog.h
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#include "simulation/stepping/step_watchdog.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+
+#include "config/path_config.h"
+#include "core/linear-algebra/vector.h"
+#include "core/quantities/units.h"
+#include "core/tracing/lock_profiling.h"
+#include "simulation/stepping/step_statistics.h"
+
+namespace {
+    step_watchdog::Settings g_settings{};
+
+    lock_profiling::ProfiledMutex g_logMutex{"watchdog_log"};
+
+    constexpr std::string_view limiterName(const StepLimiter limiter) noexcept {
+        switch (limiter) {
+            case StepLimiter::Time:        return "time";
+            case StepLimiter::Boundary:    return "boundary";
+            case StepLimiter::Decay:       return "decay";
+            case StepLimiter::Interaction: return "interaction";
+        }
+        return "unknown";
+    }
+
+    constexpr std::string_view actionName(const step_watchdog::Action action) noexcept {
+        switch (action) {
+            case step_watchdog::Action::Report: return "report";
+            case step_watchdog::Action::Kill:   return "kill";
+            case step_watchdog::Action::Nudge:  return "nudge";
+        }
+        return "unknown";
+    }
+
+    std::string describeMedium(const Object* medium) {
+        return medium != nullptr ? std::format("{} ({})", medium->getName(), medium->getMaterial()) : "(none)";
+    }
+
+    std::string formatVector(const Vector<3>& vector) {
+        return std::format("({:.9e}, {:.9e}, {:.9e})", vector[0].value, vector[1].value, vector[2].value);
+    }
+} // namespace
+
+void step_watchdog::setSettings(const Settings& settings) noexcept {
+    g_settings = settings;
+}
+
+const step_watchdog::Settings& step_watchdog::settings() noexcept {
+    return g_settings;
+}
+
+step_watchdog::TrackMonitor::TrackMonitor(const Quantity& initialTime, const Quantity& targetTime) noexcept :
+    m_initialTime(initialTime.value),
+    m_interval(std::max(targetTime.value - initialTime.value, 0.0)),
+    m_windowStartTime(initialTime.value) {}
+
+bool step_watchdog::TrackMonitor::recordStep(const Particle& particle, const StepEvent& event) {
+    auto& record = this->m_recent[this->m_steps % k_recentSteps];
+    const auto& position = particle.getPosition();
+    record.limiter = event.limiter;
+    record.dtSeconds = event.dt.value;
+    record.position = {position[0].value, position[1].value, position[2].value};
+    record.medium = event.preStep.medium;
+    record.boundaryHasNormal = event.boundaryEvent.hasNormal;
+    ++this->m_steps;
+
+    if (this->m_tripped) {
+        return false;
+    }
+
+    const auto& active = settings();
+    if (active.maxSteps > 0 && this->m_steps > active.maxSteps) {
+        this->m_reason = std::format("exceeded {} steps in one stepAll", active.maxSteps);
+    }
+    else if (active.progressWindow > 0 && this->m_steps % active.progressWindow == 0) {
+        const double time = particle.getTime().value;
+        const double progress = time - this->m_windowStartTime;
+        if (progress < active.minProgressFraction * this->m_interval) {
+            this->m_reason = std::format(
+                "advanced {:.3e} s over the last {} steps (minimum {:.3e} s)",
+                progress,
+                active.progressWindow,
+                active.minProgressFraction * this->m_interval
+            );
+        }
+        this->m_windowStartTime = time;
+    }
+
+    this->m_tripped = !this->m_reason.empty();
+    return this->m_tripped;
+}
+
+bool step_watchdog::applyAction(Particle& particle, const TrackMonitor& monitor, const Object* medium) {
+    const auto& active = settings();
+    auto action = active.action;
+    const auto& momentum = particle.getMomentum();
+    if (action == Action::Nudge && momentum.length().value <= 0.0) {
+        action = Action::Kill; // No direction to nudge along
+    }
+
+    ++StepStatistics::local().watchdogTrips;
+
+    std::string dump = std::format(
+        "Watchdog trip: {}\n"
+        "  action:     {}\n"
+        "  particle:   {} (alive {})\n"
+        "  time:       {:.9e} s (stepAll interval {:.9e} s from {:.9e} s)\n"
+        "  position:   {} m\n"
+        "  momentum:   {} kg m/s\n"
+        "  energy:     {:.9e} J\n"
+        "  medium:     {}\n"
+        "  steps:      {}\n"
+        "  recent steps (oldest first):\n",
+        monitor.m_reason,
+        actionName(action),
+        particle.getType(),
+        particle.getAlive(),
+        particle.getTime().value,
+        monitor.m_interval,
+        monitor.m_initialTime,
+        formatVector(particle.getPosition()),
+        formatVector(momentum),
+        particle.getEnergy().value,
+        describeMedium(medium),
+        monitor.m_steps
+    );
+
+    const auto recorded = std::min<std::uint64_t>(monitor.m_steps, k_recentSteps);
+    for (std::uint64_t i = monitor.m_steps - recorded; i < monitor.m_steps; ++i) {
+        const auto& record = monitor.m_recent[i % k_recentSteps];
+        dump += std::format(
+            "    #{:<10} {:<11} dt {:.3e} s  to ({:.9e}, {:.9e}, {:.9e}) m  in {}{}\n",
+            i + 1,
+            limiterName(record.limiter),
+            record.dtSeconds,
+            record.position[0],
+            record.position[1],
+            record.position[2],
+            describeMedium(record.medium),
+            record.limiter == StepLimiter::Boundary && !record.boundaryHasNormal ? "  [fallback]" : ""
+        );
+    }
+
+    const auto logPath = std::filesystem::path(config::paths::outputDirectory) / "watchdog.log";
+    {
+        std::scoped_lock lock(g_logMutex);
+        std::error_code ec;
+        std::filesystem::create_directories(logPath.parent_path(), ec);
+        if (std::ofstream log(logPath, std::ios::app); log) {
+            log << dump << '\n';
+        }
+        else {
+            std::cerr << std::format("Failed to open watchdog log '{}'\n", logPath.string());
+        }
+    }
+
+    std::cerr << std::format(
+        "Warning: step watchdog tripped for {} in {} ({}); action {}, details in '{}'\n",
+        particle.getType(),
+        describeMedium(medium),
+        monitor.m_reason,
+        actionName(action),
+        logPath.string()
+    );
+
+    switch (action) {
+        case Action::Report:
+            return true;
+        case Action::Kill:
+            particle.kill();
+            return false;
+        case Action::Nudge:
+            particle.setPosition(particle.getPosition()
+                                 + momentum.unitVector() * Quantity(config::program::geometryTolerance * active.nudgeScale,
+                                                                    Unit::lengthDimension()));
+            particle.clearInteractionLength();
+            return true;
+    }
+    return true;
+}
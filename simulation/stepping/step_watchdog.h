@@ -0,0 +1,115 @@
+//
+// Physics Simulation Program
+// File: step_watchdog.h
+// Created by Tobias Sharman on 18/10/2026
+//
+// Description:
+//   - Detects particles taking runaway numbers of steps within one stepAll (typically stuck on an edge or corner)
+//   - Dumps the particle state and its recent steps to a diagnostics file and optionally kills or nudges the particle
+//
+// Copyright (c) 2025, Tobias Sharman
+// Licensed under a Non-Commercial License. See LICENSE file for details
+//
+
+#ifndef PHYSICS_SIMULATION_PROGRAM_STEP_WATCHDOG_H
+#define PHYSICS_SIMULATION_PROGRAM_STEP_WATCHDOG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "config/program_config.h"
+#include "core/quantities/quantity.h"
+#include "objects/object.h"
+#include "particles/particle.h"
+#include "simulation/stepping/step_events.h"
+
+// step_watchdog
+//
+// Notes on initialisation:
+//   - Settings default to the watchdog values in config/program_config.h and may be replaced with setSettings() before
+//     stepping; they are read without synchronisation, so do not change them while stepAll is running
+//   - The default action only reports, so enabling the watchdog never changes which particles a run keeps; killing or
+//     nudging stuck particles is opted into through setSettings()
+//
+// Notes on algorithms:
+//   - A TrackMonitor lives for one particle visit in stepParticle and keeps the last k_recentSteps steps in a fixed
+//     ring buffer (no allocation per step)
+//   - It trips when the visit exceeds maxSteps, or when over a window of progressWindow steps the particle's time
+//     advanced by less than minProgressFraction of the stepAll interval (the signature of tolerance-sized steps)
+//   - A monitor trips at most once per visit; Nudge moves the particle along its momentum by nudgeScale *
+//     geometryTolerance and clears its pending interaction so it is resampled in whatever medium it lands in;
+//     particles with zero momentum cannot be nudged and are killed instead
+//
+// Notes on output:
+//   - Each trip appends a block to <outputDirectory>/watchdog.log (particle state, reason and recent steps oldest
+//     first), writes a one-line warning to std::cerr and is counted in StepCounters::watchdogTrips
+//
+// Supported overloads / operations and functions / methods:
+//   - Settings:               setSettings(), settings()
+//   - Monitoring:             TrackMonitor::recordStep()
+//   - Actions:                applyAction()
+//
+// Example usage:
+//   step_watchdog::setSettings({.maxSteps = 100000, .action = step_watchdog::Action::Nudge});
+//   stepUntilEmpty(detector, Quantity(1e-13, "s"));
+namespace step_watchdog {
+    inline constexpr std::size_t k_recentSteps = 16;
+
+    enum class Action : std::uint8_t {
+        Report, // Log only; the particle keeps stepping
+        Kill,   // Log and kill the particle (removed by the next purge)
+        Nudge   // Log and move the particle off the surface it is stuck on
+    };
+
+    struct Settings {
+        std::uint64_t maxSteps = config::program::watchdogMaxSteps;               // 0 disables the step limit
+        std::uint64_t progressWindow = config::program::watchdogProgressWindow;   // 0 disables the progress check
+        double minProgressFraction = config::program::watchdogMinProgressFraction;
+        double nudgeScale = config::program::watchdogNudgeScale;
+        Action action = Action::Report;                                           // Kill and Nudge are opt-in
+    };
+
+    void setSettings(const Settings& settings) noexcept;
+    [[nodiscard]] const Settings& settings() noexcept;
+
+    // Compact copy of a step kept for the diagnostics dump
+    struct StepRecord {
+        StepLimiter limiter = StepLimiter::Time;
+        double dtSeconds = 0.0;
+        std::array<double, 3> position{}; // After the step, in metres
+        const Object* medium = nullptr;   // Medium the step started in
+        bool boundaryHasNormal = false;   // False for boundary fallbacks (no intersection found)
+    };
+
+    // TrackMonitor
+    //
+    // Watches one particle for the duration of one stepParticle call (interval = targetTime - initialTime)
+    class TrackMonitor {
+        public:
+            TrackMonitor(const Quantity& initialTime, const Quantity& targetTime) noexcept;
+
+            // Record an accepted step; returns true once if the particle should be acted on
+            [[nodiscard]] bool recordStep(const Particle& particle, const StepEvent& event);
+
+            [[nodiscard]] std::uint64_t steps() const noexcept { return this->m_steps; }
+
+        private:
+            friend bool applyAction(Particle& particle, const TrackMonitor& monitor, const Object* medium);
+
+            std::array<StepRecord, k_recentSteps> m_recent{};
+            std::uint64_t m_steps = 0;
+            double m_initialTime;
+            double m_interval;            // stepAll interval in seconds
+            double m_windowStartTime;     // Particle time at the start of the current progress window
+            std::string m_reason;         // Set when tripped
+            bool m_tripped = false;
+    };
+
+    // Dump the particle (in medium) and the monitor's recent steps, then apply settings().action; returns false if the
+    // particle was killed. After a nudge the caller must re-resolve the particle's medium
+    bool applyAction(Particle& particle, const TrackMonitor& monitor, const Object* medium);
+} // namespace step_watchdog
+
+#endif //PHYSICS_SIMULATION_PROGRAM_STEP_WATCHDOG_H